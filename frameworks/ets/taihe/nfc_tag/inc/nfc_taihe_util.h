@@ -25,9 +25,11 @@
 class NfcTaiheUtil {
 public:
     static std::string TaiheArrayToHexString(const ::taihe::array_view<int32_t> &data);
+    static bool TaiheArrayToBytes(const ::taihe::array_view<int32_t> &data, std::vector<uint8_t> &bytes);
     static std::vector<std::string> TaiheStringArrayToStringVec(const ::taihe::array_view<::taihe::string> &data);
     static std::vector<int> TaiheIntArrayToIntVec(const ::taihe::array<int32_t> &data);
 
     static ::taihe::array<int32_t> HexStringToTaiheArray(const std::string &src);
+    static ::taihe::array<int32_t> BytesToTaiheArray(const std::vector<uint8_t> &bytes);
 };
 #endif // #define NFC_TAIHE_UTIL_H
\ No newline at end of file
@@ -122,10 +122,12 @@ public:
             ErrorLog("TagSession nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -238,10 +240,12 @@ public:
             ErrorLog("tagA nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -347,10 +351,12 @@ public:
             ErrorLog("tagB nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -456,10 +462,12 @@ public:
             ErrorLog("tagF nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -565,10 +573,12 @@ public:
             ErrorLog("tagV nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -685,10 +695,12 @@ public:
             ErrorLog("IsoDepTag nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -942,10 +954,12 @@ public:
             ErrorLog("NdefTag nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -1163,10 +1177,12 @@ public:
             ErrorLog("MifareClassicTag nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -1284,10 +1300,12 @@ public:
             ErrorLog("mifareul nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -1407,10 +1425,12 @@ public:
             ErrorLog("NdefFormatableTag nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -1511,10 +1531,12 @@ public:
             ErrorLog("BarcodeTag nullptr");
             return array<int32_t>(array_view<int32_t>());
         }
-        std::string hexRespData;
-        std::string hexCmdData = NfcTaiheUtil::TaiheArrayToHexString(data);
-        tagSession_->SendCommand(hexCmdData, true, hexRespData);
-        return NfcTaiheUtil::HexStringToTaiheArray(hexRespData);
+        std::vector<uint8_t> cmdData;
+        std::vector<uint8_t> respData;
+        if (NfcTaiheUtil::TaiheArrayToBytes(data, cmdData)) {
+            tagSession_->SendCommand(cmdData, true, respData);
+        }
+        return NfcTaiheUtil::BytesToTaiheArray(respData);
     }
 
     int64_t getTagSessionImpl()
@@ -43,6 +43,24 @@ std::string NfcTaiheUtil::TaiheArrayToHexString(const array_view<int32_t> &data)
     return NfcSdkCommon::BytesVecToHexString(&dataBytes[0], dataBytes.size());
 }
 
+bool NfcTaiheUtil::TaiheArrayToBytes(const array_view<int32_t> &data, std::vector<uint8_t> &bytes)
+{
+    if (data.size() > MAX_ARRAY_LENGTH) {
+        ErrorLog("data size exceed.");
+        return false;
+    }
+    bytes.reserve(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        if (data[i] < 0 || data[i] > DATA_MAX_VALUE) {
+            ErrorLog("data value out of range");
+            bytes.clear();
+            return false;
+        }
+        bytes.push_back(static_cast<uint8_t>(data[i]));
+    }
+    return true;
+}
+
 std::vector<std::string> NfcTaiheUtil::TaiheStringArrayToStringVec(const array_view<::taihe::string> &data)
 {
     std::vector<std::string> ret;
@@ -94,3 +112,13 @@ array<int32_t> NfcTaiheUtil::HexStringToTaiheArray(const std::string &src)
     }
     return array<int32_t>(array_view<int32_t>(dataVec));
 }
+
+array<int32_t> NfcTaiheUtil::BytesToTaiheArray(const std::vector<uint8_t> &bytes)
+{
+    if (bytes.size() > MAX_ARRAY_LENGTH) {
+        ErrorLog("data size exceed.");
+        return array<int32_t>(array_view<int32_t>());
+    }
+    std::vector<int32_t> dataVec(bytes.begin(), bytes.end());
+    return array<int32_t>(array_view<int32_t>(dataVec));
+}
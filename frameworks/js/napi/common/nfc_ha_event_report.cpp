@@ -13,33 +13,107 @@
  * limitations under the License.
  */
 #include "nfc_ha_event_report.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "nfc_sdk_common.h"
 #include "loghelper.h"
-#include <random>
 namespace OHOS {
 namespace NFC {
 namespace KITS {
 const int64_t REPORT_CONFIG_TIMEOUT = 90; // report once every 90s
 const int64_t REPORT_CONFIG_ROW = 30; // or report once every 30 data entries
-const int64_t MAX_RAMDOM_VALUE = 999999;
-const int64_t PROCESSOR_ID_NOT_CREATE = -1;
-static int64_t g_processorID = PROCESSOR_ID_NOT_CREATE;
+const int64_t MS_PER_SECOND = 1000;
+const uint32_t DEFAULT_SAMPLE_INTERVAL = 10; // report the detailed event once every 10 successful calls
+const uint32_t MAX_SAMPLE_INTERVAL = 10000;
+// the upper bounds in ms of the cost time buckets, the last bucket counts the rest.
+const int64_t COST_BUCKET_BOUNDS[] = {1, 5, 10, 50, 100, 500, 1000};
+const size_t COST_BUCKET_NUM = sizeof(COST_BUCKET_BOUNDS) / sizeof(COST_BUCKET_BOUNDS[0]) + 1;
+static int64_t g_processorID = 0;
+static uint32_t g_sampleInterval = DEFAULT_SAMPLE_INTERVAL;
+static std::once_flag g_initFlag;
+static std::atomic<uint64_t> g_transSeq {0};
+static std::atomic<int64_t> g_pendingCalls {0};
+
+struct ApiCallStats {
+    std::string sdkName = "";
+    int64_t beginTime = 0;
+    int32_t callTimes = 0;
+    int32_t successTimes = 0;
+    int64_t minCostTime = 0;
+    int64_t maxCostTime = 0;
+    int64_t totalCostTime = 0;
+    std::vector<int32_t> costTimeDist = std::vector<int32_t>(COST_BUCKET_NUM, 0);
+};
+
+// only accessed by its own thread, no lock is needed. flushed when the thread exits, so the calls counted
+// by a thread that stops calling are not lost.
+struct ApiStatsSlot {
+    ~ApiStatsSlot();
+
+    std::map<std::string, ApiCallStats> stats {};
+    int64_t rows = 0;
+    int64_t lastFlushTime = 0;
+};
+static thread_local ApiStatsSlot g_statsSlot;
+
+static int64_t GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static size_t GetCostBucket(int64_t costTime)
+{
+    size_t bucket = 0;
+    while (bucket < COST_BUCKET_NUM - 1 && costTime > COST_BUCKET_BOUNDS[bucket]) {
+        bucket++;
+    }
+    return bucket;
+}
+
+static void FlushApiStats(ApiStatsSlot &slot, int64_t now)
+{
+    for (const auto &[apiName, stats] : slot.stats) {
+        OHOS::HiviewDFX::HiAppEvent::Event event("api_diagnostic", "api_called_stat",
+            OHOS::HiviewDFX::HiAppEvent::BEHAVIOR);
+        event.AddParam("api_name", apiName);
+        event.AddParam("sdk_name", stats.sdkName);
+        event.AddParam("begin_time", stats.beginTime);
+        event.AddParam("call_times", stats.callTimes);
+        event.AddParam("success_times", stats.successTimes);
+        event.AddParam("min_cost_time", stats.minCostTime);
+        event.AddParam("max_cost_time", stats.maxCostTime);
+        event.AddParam("total_cost_time", stats.totalCostTime);
+        event.AddParam("cost_time_dist", stats.costTimeDist);
+        int ret = Write(event);
+        DebugLog("FlushApiStats: apiName:%{public}s, callTimes:%{public}d, successTimes:%{public}d, ret:%{public}d",
+            apiName.c_str(), stats.callTimes, stats.successTimes, ret);
+    }
+    g_pendingCalls.fetch_sub(slot.rows, std::memory_order_relaxed);
+    slot.stats.clear();
+    slot.rows = 0;
+    slot.lastFlushTime = now;
+}
+
+ApiStatsSlot::~ApiStatsSlot()
+{
+    if (rows > 0) {
+        FlushApiStats(*this, GetCurrentTime());
+    }
+}
 
 NfcHaEventReport::NfcHaEventReport(const std::string &sdk, const std::string &api)
 {
     apiName_ = api;
     sdkName_ = sdk;
-    std::random_device randSeed;
-    std::mt19937 gen(randSeed());
-    std::uniform_int_distribution<> dis(0, MAX_RAMDOM_VALUE);
-    transId_ = std::string("transId_") + std::to_string(dis(gen));
-
-    beginTime_ =
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
-        .count();
-    if (g_processorID == PROCESSOR_ID_NOT_CREATE) {
-        g_processorID = AddProcessor();
-    }
+    transSeq_ = g_transSeq.fetch_add(1, std::memory_order_relaxed);
+    beginTime_ = GetCurrentTime();
+    std::call_once(g_initFlag, &NfcHaEventReport::Init);
 }
 
 NfcHaEventReport::~NfcHaEventReport()
@@ -48,11 +122,45 @@ NfcHaEventReport::~NfcHaEventReport()
 
 void NfcHaEventReport::ReportSdkEvent(const int result, const int errCode)
 {
-    int64_t endTime =
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
-        .count();
+    int64_t endTime = GetCurrentTime();
+    int64_t costTime = std::max<int64_t>(endTime - beginTime_, 0);
+    ApiStatsSlot &slot = g_statsSlot;
+    if (slot.lastFlushTime == 0) {
+        slot.lastFlushTime = endTime;
+    }
+    auto iter = slot.stats.find(apiName_);
+    if (iter == slot.stats.end()) {
+        iter = slot.stats.emplace(apiName_, ApiCallStats()).first;
+        iter->second.sdkName = sdkName_;
+        iter->second.beginTime = beginTime_;
+        iter->second.minCostTime = costTime;
+    }
+    ApiCallStats &stats = iter->second;
+    stats.callTimes++;
+    if (result == RESULT_SUCCESS) {
+        stats.successTimes++;
+    }
+    stats.minCostTime = std::min(stats.minCostTime, costTime);
+    stats.maxCostTime = std::max(stats.maxCostTime, costTime);
+    stats.totalCostTime += costTime;
+    stats.costTimeDist[GetCostBucket(costTime)]++;
+    slot.rows++;
+    g_pendingCalls.fetch_add(1, std::memory_order_relaxed);
+    if (slot.rows >= REPORT_CONFIG_ROW || endTime - slot.lastFlushTime >= REPORT_CONFIG_TIMEOUT * MS_PER_SECOND) {
+        FlushApiStats(slot, endTime);
+    }
+
+    // the failures are always reported in detail, the successes are sampled.
+    if (result != RESULT_SUCCESS || transSeq_ % g_sampleInterval == 0) {
+        WriteExecEndEvent(result, errCode, endTime);
+    }
+}
+
+void NfcHaEventReport::WriteExecEndEvent(const int result, const int errCode, int64_t endTime)
+{
+    std::string transId = std::string("transId_") + std::to_string(transSeq_);
     OHOS::HiviewDFX::HiAppEvent::Event event("api_diagnostic", "api_exec_end", OHOS::HiviewDFX::HiAppEvent::BEHAVIOR);
-    event.AddParam("trans_id", this->transId_);
+    event.AddParam("trans_id", transId);
     event.AddParam("api_name", this->apiName_);
     event.AddParam("sdk_name", this->sdkName_);
     event.AddParam("begin_time", this->beginTime_);
@@ -62,10 +170,30 @@ void NfcHaEventReport::ReportSdkEvent(const int result, const int errCode)
     int ret = Write(event);
     InfoLog("transId:%{public}s, apiName:%{public}s, sdkName:%{public}s, "
         "startTime:%{public}ld, endTime:%{public}ld, result:%{public}d, errCode:%{public}d, ret:%{public}d",
-        this->transId_.c_str(), this->apiName_.c_str(), this->sdkName_.c_str(),
+        transId.c_str(), this->apiName_.c_str(), this->sdkName_.c_str(),
         this->beginTime_, endTime, result, errCode, ret);
 }
 
+int64_t NfcHaEventReport::GetPendingCalls()
+{
+    return g_pendingCalls.load(std::memory_order_relaxed);
+}
+
+void NfcHaEventReport::Init()
+{
+    g_processorID = AddProcessor();
+    std::string sampleInterval = "";
+    if (NfcSdkCommon::GetConfigFromJson(KEY_REPORT_SAMPLE_INTERVAL, sampleInterval)) {
+        char *end = nullptr;
+        unsigned long value = std::strtoul(sampleInterval.c_str(), &end, 10); // 10 for decimal
+        if (end != sampleInterval.c_str() && *end == '\0' && value > 0 && value <= MAX_SAMPLE_INTERVAL) {
+            g_sampleInterval = static_cast<uint32_t>(value);
+        }
+    }
+    InfoLog("NfcHaEventReport::Init processorID:%{public}ld, sampleInterval:%{public}u",
+        g_processorID, g_sampleInterval);
+}
+
 int64_t NfcHaEventReport::AddProcessor()
 {
     OHOS::HiviewDFX::HiAppEvent::ReportConfig config;
@@ -21,21 +21,31 @@
 namespace OHOS {
 namespace NFC {
 namespace KITS {
+/**
+ * @brief Reports the api calls. Each call is counted into the per-thread statistics of its api, which are
+ * written as one api_called_stat event per api when the flush timeout or row threshold is reached, or when
+ * the thread exits. The detailed api_exec_end event is written for every failed call and for the sampled
+ * successful calls.
+ */
 class NfcHaEventReport {
 public:
     NfcHaEventReport(const std::string &sdk, const std::string &api);
     ~NfcHaEventReport();
     void ReportSdkEvent(const int result, const int errCode);
+    // the calls counted by all threads and not written yet.
+    static int64_t GetPendingCalls();
 
 private:
-    int64_t AddProcessor();
+    static void Init();
+    static int64_t AddProcessor();
+    void WriteExecEndEvent(const int result, const int errCode, int64_t endTime);
 
     int64_t beginTime_ = 0;
-    std::string transId_ = "";
+    uint64_t transSeq_ = 0;
     std::string apiName_ = "";
     std::string sdkName_ = "";
 };
 } // namespace KITS
 } // namespace NFC
 } // namespace OHOS
-#endif // NFC_SDK_REPORT
\ No newline at end of file
+#endif // NFC_SDK_REPORT
@@ -254,6 +254,39 @@ bool ParseArrayBuffer(napi_env env, uint8_t **data, size_t &size, napi_value arg
     return true;
 }
 
+// parse the bytes of Uint8Array or ArrayBuffer with one copy, instead of reading the elements one by one.
+bool ParseByteBuffer(napi_env env, std::vector<unsigned char> &vec, napi_value args)
+{
+    void *data = nullptr;
+    size_t length = 0;
+    bool isTypedArray = false;
+    napi_is_typedarray(env, args, &isTypedArray);
+    if (isTypedArray) {
+        napi_typedarray_type type = napi_int8_array;
+        napi_value arrayBuffer = nullptr;
+        size_t byteOffset = 0;
+        napi_status status = napi_get_typedarray_info(env, args, &type, &length, &data, &arrayBuffer, &byteOffset);
+        if (status != napi_ok || type != napi_uint8_array) {
+            ErrorLog("ParseByteBuffer, not Uint8Array");
+            return false;
+        }
+    } else {
+        bool isArrayBuffer = false;
+        napi_is_arraybuffer(env, args, &isArrayBuffer);
+        if (!isArrayBuffer || napi_get_arraybuffer_info(env, args, &data, &length) != napi_ok) {
+            ErrorLog("ParseByteBuffer, not ArrayBuffer");
+            return false;
+        }
+    }
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    if (bytes == nullptr) {
+        vec.clear();
+        return true;
+    }
+    vec.assign(bytes, bytes + length);
+    return true;
+}
+
 napi_value UndefinedNapiValue(const napi_env &env)
 {
     napi_value result;
@@ -348,6 +381,37 @@ void BytesVectorToJS(napi_env env, napi_value &result, std::vector<unsigned char
     }
 }
 
+// the bytes are moved into an external ArrayBuffer and released by its finalizer, no copy is made.
+void BytesVectorToUint8Array(napi_env env, napi_value &result, std::vector<unsigned char> &&src)
+{
+    auto buffer = new (std::nothrow) std::vector<unsigned char>(std::move(src));
+    if (buffer == nullptr) {
+        ErrorLog("BytesVectorToUint8Array, alloc failed");
+        return;
+    }
+    napi_value arrayBuffer = nullptr;
+    size_t length = buffer->size();
+    napi_status status = napi_ok;
+    if (length == 0) {
+        delete buffer;
+        void *data = nullptr;
+        status = napi_create_arraybuffer(env, 0, &data, &arrayBuffer);
+    } else {
+        status = napi_create_external_arraybuffer(env, buffer->data(), length,
+            [](napi_env env, void *data, void *hint) {
+                delete static_cast<std::vector<unsigned char> *>(hint);
+            }, buffer, &arrayBuffer);
+        if (status != napi_ok) {
+            delete buffer;
+        }
+    }
+    if (status != napi_ok) {
+        ErrorLog("BytesVectorToUint8Array, create arraybuffer failed, status = %{public}d", status);
+        return;
+    }
+    napi_create_typedarray(env, napi_uint8_array, length, arrayBuffer, 0, &result);
+}
+
 void ConvertStringToNumberArray(napi_env env, napi_value &result, std::string srcValue)
 {
     if (srcValue.empty()) {
@@ -566,6 +630,24 @@ bool IsNumberArray(const napi_env &env, const napi_value &param)
     return true;
 }
 
+bool IsByteBuffer(const napi_env &env, const napi_value &param)
+{
+    bool isArrayBuffer = false;
+    napi_is_arraybuffer(env, param, &isArrayBuffer);
+    if (isArrayBuffer) {
+        return true;
+    }
+    bool isTypedArray = false;
+    napi_is_typedarray(env, param, &isTypedArray);
+    if (!isTypedArray) {
+        return false;
+    }
+    napi_typedarray_type type = napi_int8_array;
+    size_t length = 0;
+    napi_get_typedarray_info(env, param, &type, &length, nullptr, nullptr, nullptr);
+    return type == napi_uint8_array;
+}
+
 bool IsObjectArray(const napi_env &env, const napi_value &param)
 {
     if (!IsArray(env, param)) {
@@ -171,6 +171,7 @@ bool ParseUInt32Vector(napi_env &env, std::vector<uint32_t> &vec, napi_value &ar
 bool ParseStringVector(napi_env& env, std::vector<std::string>& vec, napi_value &args, uint32_t maxLen);
 bool ParseElementName(napi_env &env, ElementName &element, napi_value &args);
 bool ParseArrayBuffer(napi_env env, uint8_t **data, size_t &size, napi_value args);
+bool ParseByteBuffer(napi_env env, std::vector<unsigned char> &vec, napi_value args);
 napi_value CreateErrorMessage(napi_env env, const std::string &msg, int32_t errorCode = 0);
 napi_value CreateUndefined(napi_env env);
 std::string GetStringFromValue(napi_env env, napi_value value);
@@ -178,6 +179,7 @@ napi_value GetNamedProperty(napi_env env, napi_value object, const std::string &
 int32_t GetNapiInt32Value(napi_env env, napi_value napiValue, const std::string &name, const int32_t &defValue = 0);
 void JsStringToBytesVector(napi_env env, napi_value &src, std::vector<unsigned char> &values);
 void BytesVectorToJS(napi_env env, napi_value &result, std::vector<unsigned char> &src);
+void BytesVectorToUint8Array(napi_env env, napi_value &result, std::vector<unsigned char> &&src);
 void ConvertStringToNumberArray(napi_env env, napi_value &result, std::string srcValue);
 void ConvertNdefRecordVectorToJS(napi_env env, napi_value &result,
                                  std::vector<std::shared_ptr<NdefRecord>> &ndefRecords);
@@ -188,6 +190,7 @@ napi_value HandleAsyncWork(napi_env env, BaseContext *baseContext, const std::st
 void DoAsyncCallbackOrPromise(const napi_env &env, BaseContext *baseContext, napi_value callbackValue);
 void ThrowAsyncError(const napi_env &env, BaseContext *baseContext, int errCode, const std::string &errMsg);
 bool IsNumberArray(const napi_env &env, const napi_value &param);
+bool IsByteBuffer(const napi_env &env, const napi_value &param);
 bool IsObjectArray(const napi_env &env, const napi_value &param);
 bool IsArray(const napi_env &env, const napi_value &param);
 bool IsNumber(const napi_env &env, const napi_value &param);
@@ -181,8 +181,10 @@ void NapiEvent::EventNotify(AsyncEventData *asyncEvent, const std::string &type)
 
 static void SetTagExtraData(const napi_env &env, napi_value &tagInfoObj, TagInfoParcelable &tagInfo)
 {
-    uint32_t length = tagInfo.GetTechExtrasDataList().size();
-    if (length > MAX_NUM_TECH_LIST) {
+    const std::vector<KITS::TagTechExtras>& extrasList = tagInfo.GetTechExtrasList();
+    std::vector<int> techList = tagInfo.GetTechList();
+    uint32_t length = extrasList.size();
+    if (length > MAX_NUM_TECH_LIST || length > techList.size()) {
         ErrorLog("SetTagExtraData: invalid tag extras data length");
         return;
     }
@@ -194,67 +196,67 @@ static void SetTagExtraData(const napi_env &env, napi_value &tagInfoObj, TagInfo
     for (uint32_t i = 0; i < length; i++) {
         napi_value eachElement;
         napi_create_object(env, &eachElement);
-        AppExecFwk::PacMap extra = tagInfo.GetTechExtrasDataList()[i];
-        int technology = tagInfo.GetTechList()[i];
+        const KITS::TagTechExtras& extra = extrasList[i];
+        int technology = techList[i];
         if (technology == static_cast<int>(TagTechnology::NFC_A_TECH) ||
             technology == static_cast<int>(TagTechnology::NFC_MIFARE_CLASSIC_TECH)) {
             // for NFCA, parse extra SAK and ATQA
-            napi_create_uint32(env, extra.GetIntValue(KITS::TagInfo::SAK, 0), &propValue);
+            napi_create_uint32(env, extra.GetIntValue(KITS::TagTechExtras::SAK, 0), &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::SAK, propValue);
 
-            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagInfo::ATQA, "").c_str(),
+            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagTechExtras::ATQA, "").c_str(),
                 NAPI_AUTO_LENGTH, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::ATQA, propValue);
         } else if (technology == static_cast<int>(TagTechnology::NFC_B_TECH)) {
             // parse app data and protocol info of nfcb.
-            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagInfo::APP_DATA, "").c_str(),
+            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagTechExtras::APP_DATA, "").c_str(),
                 NAPI_AUTO_LENGTH, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::APP_DATA, propValue);
 
-            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagInfo::PROTOCOL_INFO, "").c_str(),
+            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagTechExtras::PROTOCOL_INFO, "").c_str(),
                 NAPI_AUTO_LENGTH, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::PROTOCOL_INFO, propValue);
         } else if (technology == static_cast<int>(TagTechnology::NFC_F_TECH)) {
             // parse pmm and sc of nfcf
-            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagInfo::NFCF_PMM, "").c_str(),
+            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagTechExtras::NFCF_PMM, "").c_str(),
                 NAPI_AUTO_LENGTH, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::NFCF_PMM, propValue);
 
-            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagInfo::NFCF_SC, "").c_str(),
+            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagTechExtras::NFCF_SC, "").c_str(),
                 NAPI_AUTO_LENGTH, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::NFCF_SC, propValue);
         } else if (technology == static_cast<int>(TagTechnology::NFC_V_TECH)) {
             // parse response flag and dsf id of nfcv.
-            napi_create_uint32(env, extra.GetIntValue(KITS::TagInfo::RESPONSE_FLAGS, 0), &propValue);
+            napi_create_uint32(env, extra.GetIntValue(KITS::TagTechExtras::RESPONSE_FLAGS, 0), &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::RESPONSE_FLAGS, propValue);
 
-            napi_create_uint32(env, extra.GetIntValue(KITS::TagInfo::DSF_ID, 0), &propValue);
+            napi_create_uint32(env, extra.GetIntValue(KITS::TagTechExtras::DSF_ID, 0), &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::DSF_ID, propValue);
         } else if (technology == static_cast<int>(TagTechnology::NFC_ISODEP_TECH)) {
             // for ISODEP, parse extra HistoryBytes and HilayerResponse
-            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagInfo::HISTORICAL_BYTES, "").c_str(),
+            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagTechExtras::HISTORICAL_BYTES, "").c_str(),
                 NAPI_AUTO_LENGTH, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::HISTORICAL_BYTES, propValue);
 
-            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagInfo::HILAYER_RESPONSE, "").c_str(),
+            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagTechExtras::HILAYER_RESPONSE, "").c_str(),
                 NAPI_AUTO_LENGTH, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::HILAYER_RESPONSE, propValue);
         } else if (technology == static_cast<int>(TagTechnology::NFC_MIFARE_ULTRALIGHT_TECH)) {
-            napi_get_boolean(env, extra.GetBooleanValue(KITS::TagInfo::MIFARE_ULTRALIGHT_C_TYPE, false), &propValue);
+            napi_get_boolean(env, extra.GetIntValue(KITS::TagTechExtras::MIFARE_ULTRALIGHT_C_TYPE, 0) != 0, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::MIFARE_ULTRALIGHT_C_TYPE, propValue);
         } else if (technology == static_cast<int>(TagTechnology::NFC_NDEF_TECH)) {
             // parse ndef message/type/max size/read mode for ndef tag
-            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagInfo::NDEF_MSG, "").c_str(),
+            napi_create_string_utf8(env, extra.GetStringValue(KITS::TagTechExtras::NDEF_MSG, "").c_str(),
                 NAPI_AUTO_LENGTH, &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::NDEF_MSG, propValue);
 
-            napi_create_uint32(env, extra.GetIntValue(KITS::TagInfo::NDEF_FORUM_TYPE, 0), &propValue);
+            napi_create_uint32(env, extra.GetIntValue(KITS::TagTechExtras::NDEF_FORUM_TYPE, 0), &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::NDEF_FORUM_TYPE, propValue);
 
-            napi_create_uint32(env, extra.GetIntValue(KITS::TagInfo::NDEF_TAG_LENGTH, 0), &propValue);
+            napi_create_uint32(env, extra.GetIntValue(KITS::TagTechExtras::NDEF_TAG_LENGTH, 0), &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::NDEF_TAG_LENGTH, propValue);
 
-            napi_create_uint32(env, extra.GetIntValue(KITS::TagInfo::NDEF_TAG_MODE, 0), &propValue);
+            napi_create_uint32(env, extra.GetIntValue(KITS::TagTechExtras::NDEF_TAG_MODE, 0), &propValue);
             napi_set_named_property(env, eachElement, KITS::TagInfo::NDEF_TAG_MODE, propValue);
         } else {
             // set extrasData[i] empty if no tech matches to keep one-to-one mapping of techList and extras
@@ -459,6 +459,8 @@ static napi_property_descriptor g_baseClassDesc[] = {
     DECLARE_NAPI_FUNCTION("setTimeout", NapiNfcTagSession::SetTimeout),
     DECLARE_NAPI_FUNCTION("sendData", NapiNfcTagSession::SendData),
     DECLARE_NAPI_FUNCTION("transmit", NapiNfcTagSession::Transmit),
+    DECLARE_NAPI_FUNCTION("transmitBatch", NapiNfcTagSession::TransmitBatch),
+    DECLARE_NAPI_FUNCTION("getTagInventory", NapiNfcTagSession::GetTagInventory),
 };
 
 // merge the functions of sub class and the functions of base class.
@@ -1007,6 +1009,10 @@ static napi_value InitJs(napi_env env, napi_value exports)
         DECLARE_NAPI_STATIC_PROPERTY("RTD_URI", GetNapiValue(env, HEX_RTD_TYPE.at(NdefMessage::EmRtdType::RTD_URI))),
         DECLARE_NAPI_STATIC_PROPERTY("SKIP_NDEF",
             GetNapiValue(env, static_cast<int32_t>(TagTechnology::NFC_SKIP_NDEF_CHECK_TECH))),
+        DECLARE_NAPI_STATIC_PROPERTY("LOW_LATENCY_READER",
+            GetNapiValue(env, static_cast<int32_t>(TagTechnology::NFC_LOW_LATENCY_READER_TECH))),
+        DECLARE_NAPI_STATIC_PROPERTY("SKIP_PRESENCE_CHECK",
+            GetNapiValue(env, static_cast<int32_t>(TagTechnology::NFC_SKIP_PRESENCE_CHECK_TECH))),
         DECLARE_NAPI_FUNCTION("registerForegroundDispatch", RegisterForegroundDispatch),
         DECLARE_NAPI_FUNCTION("unregisterForegroundDispatch", UnregisterForegroundDispatch),
         DECLARE_NAPI_FUNCTION("on", On),
@@ -144,6 +144,18 @@ napi_value NapiNdefTag::CreateNdefMessage(napi_env env, napi_callback_info info)
         std::string rawData = NfcSdkCommon::BytesVecToHexString(static_cast<unsigned char *>(dataVec.data()),
                                                                 dataVec.size());
         napiNdefMessage->ndefMessage = NdefMessage::GetNdefMessage(rawData);
+    } else if (IsByteBuffer(env, argv[ARGV_INDEX_0])) {
+        // data: Uint8Array | ArrayBuffer
+        std::vector<unsigned char> dataVec;
+        if (!ParseByteBuffer(env, dataVec, argv[ARGV_INDEX_0])) {
+            ErrorLog("CreateNdefMessage, failed to parse the buffer");
+            napi_throw(env, GenerateBusinessError(env, BUSI_ERR_PARAM,
+                BuildErrorMessage(BUSI_ERR_PARAM, "", "", "data", "Uint8Array | ArrayBuffer")));
+            return nullptr;
+        }
+        std::string rawData = NfcSdkCommon::BytesVecToHexString(static_cast<unsigned char *>(dataVec.data()),
+                                                                dataVec.size());
+        napiNdefMessage->ndefMessage = NdefMessage::GetNdefMessage(rawData);
     } else if (IsObjectArray(env, argv[ARGV_INDEX_0])) {
         // ndefRecords: NdefRecord[]
         std::vector<std::shared_ptr<NdefRecord>> ndefRecords ;
@@ -151,7 +163,7 @@ napi_value NapiNdefTag::CreateNdefMessage(napi_env env, napi_callback_info info)
         napiNdefMessage->ndefMessage = NdefMessage::GetNdefMessage(ndefRecords);
     } else {
         napi_throw(env, GenerateBusinessError(env, BUSI_ERR_PARAM,
-            BuildErrorMessage(BUSI_ERR_PARAM, "", "", "data | ndefRecords", "number[] | NdefRecord[]")));
+            BuildErrorMessage(BUSI_ERR_PARAM, "", "", "data | ndefRecords", "number[] | Uint8Array | NdefRecord[]")));
         return CreateUndefined(env);
     }
 
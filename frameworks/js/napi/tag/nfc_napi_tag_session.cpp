@@ -23,7 +23,11 @@ namespace KITS {
 static const int32_t DEFAULT_REF_COUNT = 1;
 constexpr const char* VAR_UID = "uid";
 constexpr const char* VAR_TECH = "technology";
+constexpr const char* VAR_RF_DISC_ID = "rfDiscId";
+constexpr const char* VAR_DATA = "data";
+constexpr const char* VAR_ERROR_CODE = "errorCode";
 const int32_t MAX_ARRAY_LEN = 4096;
+const uint32_t MAX_BATCH_LEN = 16;
 
 std::shared_ptr<BasicTagSession> NapiNfcTagSession::GetTag(napi_env env, napi_callback_info info,
     size_t argc, napi_value argv[])
@@ -237,18 +241,63 @@ static bool MatchSendDataParameters(napi_env env, const napi_value parameters[],
         }
     }
     if (isTypeMatched) {
-        isTypeMatched = IsNumberArray(env, parameters[ARGV_NUM_0]);
+        isTypeMatched = IsNumberArray(env, parameters[ARGV_NUM_0]) || IsByteBuffer(env, parameters[ARGV_NUM_0]);
     }
     return isTypeMatched;
 }
 
+// parse the data of number[], or Uint8Array and ArrayBuffer which are copied once and kept in bytes.
+static bool ParseTransmitData(napi_env env, napi_value data,
+    NfcTagSessionContext<std::string, NapiNfcTagSession> *context)
+{
+    if (IsByteBuffer(env, data)) {
+        if (!ParseByteBuffer(env, context->cmdBytes, data) ||
+            context->cmdBytes.size() > static_cast<size_t>(MAX_ARRAY_LEN)) {
+            ErrorLog("ParseTransmitData, invalid buffer, length is: %{public}zu", context->cmdBytes.size());
+            return false;
+        }
+        context->isByteBuffer = true;
+        return true;
+    }
+    int32_t hexCmdData = 0;
+    napi_value hexCmdDataValue = nullptr;
+    uint32_t arrayLength = 0;
+    std::vector<unsigned char> dataBytes = {};
+    NAPI_CALL_BASE(env, napi_get_array_length(env, data, &arrayLength), false);
+    if (arrayLength > MAX_ARRAY_LEN) {
+        ErrorLog("The arrayLength is out of MAX_ARRAY_LEN.arrayLength is: %{public}u", arrayLength);
+        return false;
+    }
+    for (uint32_t i = 0; i < arrayLength; ++i) {
+        NAPI_CALL_BASE(env, napi_get_element(env, data, i, &hexCmdDataValue), false);
+        NAPI_CALL_BASE(env, napi_get_value_int32(env, hexCmdDataValue, &hexCmdData), false);
+        dataBytes.push_back(hexCmdData);
+    }
+    context->dataBytes = NfcSdkCommon::BytesVecToHexString(static_cast<unsigned char *>(dataBytes.data()),
+        dataBytes.size());
+    return true;
+}
+
+// the response is returned in the same form as the data, Uint8Array for the bytes, otherwise number[].
+static void BuildTransmitResponse(napi_env env, napi_value &result,
+    NfcTagSessionContext<std::string, NapiNfcTagSession> *context)
+{
+    if (context->isByteBuffer) {
+        BytesVectorToUint8Array(env, result, std::move(context->respBytes));
+        return;
+    }
+    ConvertStringToNumberArray(env, result, context->value.c_str());
+}
+
 // native function called, add the 'inner_api' calling to request to service.
 static void NativeTransmit(napi_env env, void *data)
 {
     auto context = static_cast<NfcTagSessionContext<std::string, NapiNfcTagSession> *>(data);
     context->errorCode = BUSI_ERR_TAG_STATE_INVALID;
     std::shared_ptr<BasicTagSession> nfcTagSessionPtr = context->objectInfo->tagSession;
-    if (nfcTagSessionPtr != nullptr) {
+    if (nfcTagSessionPtr != nullptr && context->isByteBuffer) {
+        context->errorCode = nfcTagSessionPtr->SendCommand(context->cmdBytes, true, context->respBytes);
+    } else if (nfcTagSessionPtr != nullptr) {
         std::string hexRespData;
         context->errorCode = nfcTagSessionPtr->SendCommand(context->dataBytes, true, hexRespData);
         context->value = hexRespData;
@@ -268,8 +317,8 @@ static void SendDataCallback(napi_env env, napi_status status, void *data)
     auto context = static_cast<NfcTagSessionContext<std::string, NapiNfcTagSession> *>(data);
     napi_value callbackValue = nullptr;
     if (status == napi_ok && context->resolved && context->errorCode == ErrorCode::ERR_NONE) {
-        // the return is number[].
-        ConvertStringToNumberArray(env, callbackValue, context->value.c_str());
+        // the return is number[], or Uint8Array if the data is Uint8Array or ArrayBuffer.
+        BuildTransmitResponse(env, callbackValue, context);
         context->eventReport = nfcHaEventReport;
         DoAsyncCallbackOrPromise(env, context, callbackValue);
     } else {
@@ -284,6 +333,7 @@ napi_value NapiNfcTagSession::SendData(napi_env env, napi_callback_info info)
 {
     // JS API define1: sendData(data: number[]): Promise<number[]>
     // JS API define2: sendData(data: number[], callback: AsyncCallback<number[]>): void
+    // JS API define3: sendData(data: Uint8Array | ArrayBuffer): Promise<Uint8Array>
     size_t paramsCount = ARGV_NUM_2;
     napi_value params[ARGV_NUM_2] = {0};
     void *data = nullptr;
@@ -306,22 +356,10 @@ napi_value NapiNfcTagSession::SendData(napi_env env, napi_callback_info info)
     }
 
     // parse the params
-    int32_t hexCmdData = 0;
-    napi_value hexCmdDataValue = nullptr;
-    uint32_t arrayLength = 0;
-    std::vector<unsigned char> dataBytes = {};
-    NAPI_CALL(env, napi_get_array_length(env, params[ARGV_INDEX_0], &arrayLength));
-    if (arrayLength > MAX_ARRAY_LEN) {
-        ErrorLog("The arrayLength is out of MAX_ARRAY_LEN.arrayLength is: %{public}u", arrayLength);
+    if (!ParseTransmitData(env, params[ARGV_INDEX_0], context)) {
+        delete context;
         return CreateUndefined(env);
     }
-    for (uint32_t i = 0; i < arrayLength; ++i) {
-        NAPI_CALL(env, napi_get_element(env, params[ARGV_INDEX_0], i, &hexCmdDataValue));
-        NAPI_CALL(env, napi_get_value_int32(env, hexCmdDataValue, &hexCmdData));
-        dataBytes.push_back(hexCmdData);
-    }
-    context->dataBytes = NfcSdkCommon::BytesVecToHexString(static_cast<unsigned char *>(dataBytes.data()),
-        dataBytes.size());
     if (paramsCount == ARGV_NUM_2) {
         napi_create_reference(env, params[ARGV_INDEX_1], DEFAULT_REF_COUNT, &context->callbackRef);
     }
@@ -455,17 +493,19 @@ napi_value NapiNfcTagSession::GetMaxTransmitSize(napi_env env, napi_callback_inf
 static bool CheckTransmitParametersAndThrow(napi_env env, const napi_value parameters[], size_t parameterCount)
 {
     if (parameterCount == ARGV_NUM_1) {
-        if (!CheckParametersAndThrow(env, parameters, {napi_object}, "data", "number[]")) {
+        if (!CheckParametersAndThrow(env, parameters, {napi_object}, "data", "number[] | Uint8Array")) {
             return false;
         }
         return true;
     } else if (parameterCount == ARGV_NUM_2) {
         if (!CheckParametersAndThrow(env, parameters, {napi_object, napi_function},
-            "data & callback", "number[] & function") ||
-            !CheckArrayNumberAndThrow(env, parameters[ARGV_NUM_0], "data", "number[]")) {
+            "data & callback", "number[] & function")) {
             return false;
         }
-        return true;
+        if (IsByteBuffer(env, parameters[ARGV_NUM_0])) {
+            return true;
+        }
+        return CheckArrayNumberAndThrow(env, parameters[ARGV_NUM_0], "data", "number[]");
     } else {
         napi_throw(env, GenerateBusinessError(env, BUSI_ERR_PARAM,
             BuildErrorMessage(BUSI_ERR_PARAM, "", "", "", "")));
@@ -484,8 +524,8 @@ static void TransmitCallback(napi_env env, napi_status status, void *data)
     auto context = static_cast<NfcTagSessionContext<std::string, NapiNfcTagSession> *>(data);
     napi_value callbackValue = nullptr;
     if (status == napi_ok && context->resolved && context->errorCode == ErrorCode::ERR_NONE) {
-        // the return is number[].
-        ConvertStringToNumberArray(env, callbackValue, context->value.c_str());
+        // the return is number[], or Uint8Array if the data is Uint8Array or ArrayBuffer.
+        BuildTransmitResponse(env, callbackValue, context);
         context->eventReport = nfcHaEventReport;
         DoAsyncCallbackOrPromise(env, context, callbackValue);
     } else {
@@ -500,6 +540,7 @@ napi_value NapiNfcTagSession::Transmit(napi_env env, napi_callback_info info)
 {
     // JS API define1: Transmit(data: number[]): Promise<number[]>
     // JS API define2: Transmit(data: number[], callback: AsyncCallback<number[]>): void
+    // JS API define3: Transmit(data: Uint8Array | ArrayBuffer): Promise<Uint8Array>
     size_t paramsCount = ARGV_NUM_2;
     napi_value params[ARGV_NUM_2] = {0};
     void *data = nullptr;
@@ -520,22 +561,10 @@ napi_value NapiNfcTagSession::Transmit(napi_env env, napi_callback_info info)
     }
 
     // parse the params
-    int32_t hexCmdData = 0;
-    napi_value hexCmdDataValue = nullptr;
-    uint32_t arrayLength = 0;
-    std::vector<unsigned char> dataBytes = {};
-    NAPI_CALL(env, napi_get_array_length(env, params[ARGV_INDEX_0], &arrayLength));
-    if (arrayLength > MAX_ARRAY_LEN) {
-        ErrorLog("The length of arrayLength is out of MAX_ARRAY_LEN, arrayLength is: %{public}u", arrayLength);
+    if (!ParseTransmitData(env, params[ARGV_INDEX_0], context)) {
+        delete context;
         return CreateUndefined(env);
     }
-    for (uint32_t i = 0; i < arrayLength; ++i) {
-        NAPI_CALL(env, napi_get_element(env, params[ARGV_INDEX_0], i, &hexCmdDataValue));
-        NAPI_CALL(env, napi_get_value_int32(env, hexCmdDataValue, &hexCmdData));
-        dataBytes.push_back(hexCmdData);
-    }
-    context->dataBytes = NfcSdkCommon::BytesVecToHexString(static_cast<unsigned char *>(dataBytes.data()),
-        dataBytes.size());
     if (paramsCount == ARGV_NUM_2) {
         napi_create_reference(env, params[ARGV_INDEX_1], DEFAULT_REF_COUNT, &context->callbackRef);
     }
@@ -544,6 +573,156 @@ napi_value NapiNfcTagSession::Transmit(napi_env env, napi_callback_info info)
     napi_value result = HandleAsyncWork(env, context, "Transmit", NativeTransmit, TransmitCallback);
     return result;
 }
+
+napi_value NapiNfcTagSession::GetTagInventory(napi_env env, napi_callback_info info)
+{
+    // JS API define: getTagInventory(): Array<{rfDiscId: number, uid: number[], technology: number[]}>
+    napi_value argv[] = {nullptr};
+    std::shared_ptr<BasicTagSession> nfcTag = GetTag(env, info, 0, argv);
+    if (!CheckTagSessionAndThrow(env, nfcTag)) {
+        return CreateUndefined(env);
+    }
+    std::vector<int> rfDiscIds;
+    std::vector<std::string> uids;
+    std::vector<std::vector<int>> techLists;
+    int statusCode = nfcTag->GetTagInventory(rfDiscIds, uids, techLists);
+    if (!CheckTagStatusCodeAndThrow(env, statusCode, "getTagInventory")) {
+        return CreateUndefined(env);
+    }
+    napi_value result = nullptr;
+    napi_create_array_with_length(env, rfDiscIds.size(), &result);
+    for (uint32_t i = 0; i < rfDiscIds.size(); i++) {
+        napi_value tagObj = nullptr;
+        napi_value rfDiscIdValue = nullptr;
+        napi_value uidValue = nullptr;
+        napi_value techValue = nullptr;
+        napi_create_object(env, &tagObj);
+        napi_create_int32(env, rfDiscIds[i], &rfDiscIdValue);
+        std::vector<unsigned char> uidBytes;
+        NfcSdkCommon::HexStringToBytes(uids[i], uidBytes);
+        BytesVectorToJS(env, uidValue, uidBytes);
+        napi_create_array_with_length(env, techLists[i].size(), &techValue);
+        for (uint32_t j = 0; j < techLists[i].size(); j++) {
+            napi_value tech = nullptr;
+            napi_create_uint32(env, techLists[i][j], &tech);
+            napi_set_element(env, techValue, j, tech);
+        }
+        napi_set_named_property(env, tagObj, VAR_RF_DISC_ID, rfDiscIdValue);
+        napi_set_named_property(env, tagObj, VAR_UID, uidValue);
+        napi_set_named_property(env, tagObj, VAR_TECH, techValue);
+        napi_set_element(env, result, i, tagObj);
+    }
+    return result;
+}
+
+// parse the commands of 'transmitBatch', each is {rfDiscId: number, data: number[] | Uint8Array}.
+static bool ParseTransmitBatch(napi_env env, napi_value commands, NfcTagBatchContext *context)
+{
+    uint32_t arrayLength = 0;
+    NAPI_CALL_BASE(env, napi_get_array_length(env, commands, &arrayLength), false);
+    if (arrayLength == 0 || arrayLength > MAX_BATCH_LEN) {
+        ErrorLog("ParseTransmitBatch, invalid batch length: %{public}u", arrayLength);
+        return false;
+    }
+    for (uint32_t i = 0; i < arrayLength; ++i) {
+        napi_value command = nullptr;
+        NAPI_CALL_BASE(env, napi_get_element(env, commands, i, &command), false);
+        napi_value data = GetNamedProperty(env, command, VAR_DATA);
+        std::vector<unsigned char> dataBytes;
+        bool isParsed = (data != nullptr) &&
+            (IsByteBuffer(env, data) ? ParseByteBuffer(env, dataBytes, data) : ParseBytesVector(env, dataBytes, data));
+        if (!isParsed || dataBytes.empty() || dataBytes.size() > static_cast<size_t>(MAX_ARRAY_LEN)) {
+            ErrorLog("ParseTransmitBatch, invalid data of command %{public}u", i);
+            return false;
+        }
+        context->rfDiscIds.push_back(GetNapiInt32Value(env, command, VAR_RF_DISC_ID));
+        context->hexCmds.push_back(NfcSdkCommon::BytesVecToHexString(dataBytes.data(), dataBytes.size()));
+    }
+    return true;
+}
+
+static void NativeTransmitBatch(napi_env env, void *data)
+{
+    auto context = static_cast<NfcTagBatchContext *>(data);
+    context->errorCode = BUSI_ERR_TAG_STATE_INVALID;
+    std::shared_ptr<BasicTagSession> nfcTagSessionPtr = context->objectInfo->tagSession;
+    if (nfcTagSessionPtr != nullptr) {
+        context->errorCode = nfcTagSessionPtr->SendCommandBatch(context->rfDiscIds, context->hexCmds,
+            context->hexResps, context->results);
+    } else {
+        ErrorLog("NativeTransmitBatch, nfcTagSessionPtr failed.");
+    }
+    context->resolved = true;
+}
+
+static void TransmitBatchCallback(napi_env env, napi_status status, void *data)
+{
+    auto nfcHaEventReport = std::make_shared<NfcHaEventReport>(SDK_NAME, "TransmitBatch");
+    if (nfcHaEventReport == nullptr) {
+        ErrorLog("nfcHaEventReport is nullptr");
+        return;
+    }
+    auto context = static_cast<NfcTagBatchContext *>(data);
+    napi_value callbackValue = nullptr;
+    if (status == napi_ok && context->resolved && context->errorCode == ErrorCode::ERR_NONE &&
+        context->results.size() == context->hexResps.size()) {
+        // each command is resolved with its own error code, the data is empty if it failed.
+        napi_create_array_with_length(env, context->results.size(), &callbackValue);
+        for (uint32_t i = 0; i < context->results.size(); i++) {
+            napi_value rspObj = nullptr;
+            napi_value errorCodeValue = nullptr;
+            napi_value dataValue = nullptr;
+            napi_create_object(env, &rspObj);
+            napi_create_int32(env, BuildOutputErrorCode(context->results[i]), &errorCodeValue);
+            ConvertStringToNumberArray(env, dataValue, context->hexResps[i]);
+            napi_set_named_property(env, rspObj, VAR_ERROR_CODE, errorCodeValue);
+            napi_set_named_property(env, rspObj, VAR_DATA, dataValue);
+            napi_set_element(env, callbackValue, i, rspObj);
+        }
+        context->eventReport = nfcHaEventReport;
+        DoAsyncCallbackOrPromise(env, context, callbackValue);
+    } else {
+        int errCode = BuildOutputErrorCode(context->errorCode);
+        nfcHaEventReport->ReportSdkEvent(RESULT_FAIL, errCode);
+        std::string errMessage = BuildErrorMessage(errCode, "transmitBatch", TAG_PERM_DESC, "", "");
+        ThrowAsyncError(env, context, errCode, errMessage);
+    }
+}
+
+napi_value NapiNfcTagSession::TransmitBatch(napi_env env, napi_callback_info info)
+{
+    // JS API define: transmitBatch(commands: Array<{rfDiscId: number, data: number[] | Uint8Array}>):
+    //     Promise<Array<{errorCode: number, data: number[]}>>
+    size_t paramsCount = ARGV_NUM_1;
+    napi_value params[ARGV_NUM_1] = {0};
+    void *data = nullptr;
+    napi_value thisVar = nullptr;
+    NapiNfcTagSession *objectInfoCb = nullptr;
+    napi_get_cb_info(env, info, &paramsCount, params, &thisVar, &data);
+
+    // unwrap from thisVar to retrieve the native instance
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&objectInfoCb));
+    if (!CheckUnwrapStatusAndThrow(env, status, BUSI_ERR_TAG_STATE_INVALID) ||
+        !CheckArgCountAndThrow(env, paramsCount, ARGV_NUM_1) ||
+        !CheckParametersAndThrow(env, params, {napi_object}, "commands", "TransmitCommand[]")) {
+        return CreateUndefined(env);
+    }
+
+    auto context = std::make_unique<NfcTagBatchContext>().release();
+    if (!CheckContextAndThrow(env, context, BUSI_ERR_TAG_STATE_INVALID)) {
+        return CreateUndefined(env);
+    }
+    if (!IsObjectArray(env, params[ARGV_INDEX_0]) || !ParseTransmitBatch(env, params[ARGV_INDEX_0], context)) {
+        delete context;
+        napi_throw(env, GenerateBusinessError(env, BUSI_ERR_PARAM,
+            BuildErrorMessage(BUSI_ERR_PARAM, "", "", "commands", "TransmitCommand[]")));
+        return CreateUndefined(env);
+    }
+
+    context->objectInfo = objectInfoCb;
+    napi_value result = HandleAsyncWork(env, context, "TransmitBatch", NativeTransmitBatch, TransmitBatchCallback);
+    return result;
+}
 } // namespace KITS
 } // namespace NFC
 } // namespace OHOS
\ No newline at end of file
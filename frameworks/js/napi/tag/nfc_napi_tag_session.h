@@ -45,6 +45,8 @@ struct NapiNfcTagSession {
     static napi_value GetTimeout(napi_env env, napi_callback_info info);
     static napi_value Transmit(napi_env env, napi_callback_info info);
     static napi_value GetMaxTransmitSize(napi_env env, napi_callback_info info);
+    static napi_value GetTagInventory(napi_env env, napi_callback_info info);
+    static napi_value TransmitBatch(napi_env env, napi_callback_info info);
     std::shared_ptr<BasicTagSession> tagSession = nullptr;
     std::shared_ptr<KITS::TagInfo> tagInfo = nullptr;
 };
@@ -54,6 +56,19 @@ struct NfcTagSessionContext : BaseContext {
     T value;
     D *objectInfo;
     std::string dataBytes;
+    // set if the data is Uint8Array or ArrayBuffer, the bytes are sent without the hex string conversion.
+    bool isByteBuffer = false;
+    std::vector<unsigned char> cmdBytes;
+    std::vector<unsigned char> respBytes;
+};
+
+// the commands of 'transmitBatch' to the tags of the field, and the response and error code of each.
+struct NfcTagBatchContext : BaseContext {
+    NapiNfcTagSession *objectInfo = nullptr;
+    std::vector<int> rfDiscIds;
+    std::vector<std::string> hexCmds;
+    std::vector<std::string> hexResps;
+    std::vector<int> results;
 };
 } // namespace KITS
 } // namespace NFC
@@ -175,15 +175,38 @@ int HceService::GetPaymentServices(std::vector<AbilityInfo> &abilityInfos)
         return ErrorCode::ERR_HCE_STATE_UNBIND;
     }
 
+    std::lock_guard<std::mutex> lock(paymentServicesMutex_);
     KITS::CePaymentServicesParcelable paymentServices;
-    ErrCode errCode = hceSession->GetPaymentServices(paymentServices);
-
-    std::vector<AbilityInfo> paymentAbilityInfos = paymentServices.paymentAbilityInfos;
-    InfoLog("size %{public}zu", paymentAbilityInfos.size());
-    abilityInfos = std::move(paymentAbilityInfos);
+    ErrCode errCode = hceSession->GetPaymentServicesIfChanged(paymentServicesVersion_, paymentServices);
+    if (errCode != ErrorCode::ERR_NONE) {
+        ErrorLog("HceService::GetPaymentServices, errCode = %{public}d", errCode);
+        return static_cast<int>(errCode);
+    }
+    if (!paymentServices.isUnchanged) {
+        paymentServicesVersion_ = paymentServices.version;
+        paymentAbilityInfos_ = std::move(paymentServices.paymentAbilityInfos);
+    }
+    InfoLog("size %{public}zu, unchanged %{public}d", paymentAbilityInfos_.size(), paymentServices.isUnchanged);
+    abilityInfos = paymentAbilityInfos_;
     return static_cast<int>(errCode);
 }
 
+int HceService::GetCeCapture(uint64_t sinceSequence, std::vector<std::string> &records)
+{
+    InfoLog("HceService::GetCeCapture");
+    int32_t res = ErrorCode::ERR_NONE;
+    OHOS::sptr<IHceSession> hceSession = GetHceSessionProxy(res);
+    if (res == ErrorCode::ERR_NO_PERMISSION) {
+        ErrorLog("HceService::GetCeCapture, ERR_NO_PERMISSION");
+        return ErrorCode::ERR_NO_PERMISSION;
+    }
+    if (hceSession == nullptr || hceSession->AsObject() == nullptr) {
+        ErrorLog("HceService::GetCeCapture, ERR_HCE_STATE_UNBIND");
+        return ErrorCode::ERR_HCE_STATE_UNBIND;
+    }
+    return static_cast<int>(hceSession->GetCeCapture(sinceSequence, records));
+}
+
 KITS::ErrorCode HceService::StartHce(const ElementName &element, const std::vector<std::string> &aids)
 {
     InfoLog("HceService::StartHce");
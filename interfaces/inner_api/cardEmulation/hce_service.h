@@ -16,6 +16,8 @@
 #ifndef HCE_SERVICE_H
 #define HCE_SERVICE_H
 
+#include <mutex>
+#include <vector>
 #include "nfc_sdk_common.h"
 #include "ihce_cmd_callback.h"
 #include "ihce_session.h"
@@ -39,6 +41,12 @@ public:
     ErrorCode IsDefaultService(ElementName &element, const std::string &type, bool &isDefaultService);
     int SendRawFrame(std::string hexCmdData, bool raw, std::string &hexRespData);
     int GetPaymentServices(std::vector<AbilityInfo> &abilityInfos);
+    /**
+     * @brief Get the card emulation capture after a sequence, for the diagnostics of the system apps.
+     * @param sinceSequence The sequence of the last record got, 0 for the whole capture.
+     * @param records The records, "<sequence> <time us> <type> <frame length> <captured bytes>" each.
+     */
+    int GetCeCapture(uint64_t sinceSequence, std::vector<std::string> &records);
     KITS::ErrorCode StartHce(const ElementName &element, const std::vector<std::string> &aids);
 
 protected:
@@ -46,6 +54,10 @@ protected:
 
 private:
     OHOS::sptr<IHceSession> hceSessionProxy_;
+    // the last payment services got from the service, returned as is while the service reports it unchanged
+    std::mutex paymentServicesMutex_ {};
+    uint64_t paymentServicesVersion_ = 0;
+    std::vector<AbilityInfo> paymentAbilityInfos_ {};
 };
 } // namespace KITS
 } // namespace NFC
@@ -38,6 +38,10 @@ bool CePaymentServicesParcelable::Marshalling(Parcel &parcel) const
             return false;
         }
     }
+    if (!parcel.WriteUint64(version) || !parcel.WriteBool(isUnchanged)) {
+        ErrorLog("write version failed");
+        return false;
+    }
     return true;
 }
 CePaymentServicesParcelable *CePaymentServicesParcelable::Unmarshalling(Parcel &parcel)
@@ -65,6 +69,8 @@ CePaymentServicesParcelable *CePaymentServicesParcelable::Unmarshalling(Parcel &
         return nullptr;
     }
     paymentService->paymentAbilityInfos = std::move(abilityInfos);
+    paymentService->version = parcel.ReadUint64();
+    paymentService->isUnchanged = parcel.ReadBool();
     return paymentService;
 }
 } // namespace KITS
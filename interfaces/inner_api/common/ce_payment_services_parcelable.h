@@ -27,6 +27,8 @@ struct CePaymentServicesParcelable : public Parcelable {
     bool Marshalling(Parcel &parcel) const override;
     static CePaymentServicesParcelable *Unmarshalling(Parcel &parcel);
     std::vector<AbilityInfo> paymentAbilityInfos;
+    uint64_t version = 0; // the version of the payment services catalog
+    bool isUnchanged = false; // the catalog is still the version known by the client, the list is left empty
 };
 } // namespace KITS
 } // namespace NFC
@@ -50,6 +50,11 @@ public:
          * @note
          */
         virtual void OnCardEmulationDeactivated() = 0;
+        /**
+         * @brief  the EE info changed after the routes are applied, the routing needs to be committed again
+         * @note
+         */
+        virtual void OnEeInfoChanged() = 0;
     };
 
     virtual ~INciCeInterface() = default;
@@ -96,6 +101,19 @@ public:
      */
     virtual bool ClearAidTable() = 0;
 
+    /**
+     * @brief get the size of the listen mode routing table left for the aid entries
+     * @return the size in bytes, 0 if unknown
+     */
+    virtual uint32_t GetAidRoutingTableSize() = 0;
+
+    /**
+     * @brief get the route of the aids not in the aid table
+     * @param defaultPaymentType see enum DefaultPaymentType
+     * @return the route location of the zero length aid entry
+     */
+    virtual int GetDefaultAidRoute(int defaultPaymentType) = 0;
+
     /**
      * @brief get sim bundle name of the vendor
      * @return sim bundle name of the vendor
@@ -87,6 +87,12 @@ public:
      * @brief Send want to vendor update
     */
     virtual void UpdateWantExtInfoByVendor(AAFwk::Want& want, const std::string& uri) = 0;
+
+    /**
+     * @brief Dump the debug info of the nfc controller, such as the trace of the nci events
+     * @param fd File descriptor to write the debug info
+    */
+    virtual void Dump(int fd) = 0;
 };
 }  // namespace NCI
 }  // namespace NFC
@@ -14,9 +14,12 @@
  */
 #ifndef I_NCI_TAG_INTERFACE_H
 #define I_NCI_TAG_INTERFACE_H
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 #include "pac_map.h"
+#include "tag_tech_extras.h"
 
 namespace OHOS {
 namespace NFC {
@@ -29,6 +32,24 @@ public:
         virtual void OnTagLost(uint32_t tagDiscId) = 0;
     };
 
+    // uid and technologies of one tag in the field.
+    struct TagInventoryItem {
+        uint32_t rfDiscId = 0;
+        std::string uid {};
+        std::vector<int> techList {};
+    };
+
+    // one command to one tag in the field, response and status are filled after transceived.
+    struct TagTransceiveItem {
+        uint32_t rfDiscId = 0;
+        std::string command {};
+        std::string response {};
+        int status = 0;
+    };
+
+    // completion of an asynchronous tag operation, status is the nci status and response is in hex string.
+    using TagOpCallback = std::function<void(int status, const std::string& response)>;
+
     virtual ~INciTagInterface() = default;
 
     /**
@@ -58,6 +79,20 @@ public:
      */
     virtual std::vector<AppExecFwk::PacMap> GetTechExtrasData(uint32_t tagDiscId) = 0;
 
+    /**
+     * @brief Get the extra data of all discovered technologies in fixed fields.
+     * @param tagDiscId The tag discovered id given from nci stack.
+     * @return The extra data of all discovered technologies, in the order of the technologies.
+     */
+    virtual std::vector<KITS::TagTechExtras> GetTechExtras(uint32_t tagDiscId)
+    {
+        std::vector<KITS::TagTechExtras> tagTechExtras;
+        for (AppExecFwk::PacMap& pacMap : GetTechExtrasData(tagDiscId)) {
+            tagTechExtras.push_back(KITS::TagTechExtras::FromPacMap(pacMap));
+        }
+        return tagTechExtras;
+    }
+
     /**
      * @brief Get the uid of discovered tag.
      * @param tagDiscId The tag discovered id given from nci stack.
@@ -96,6 +131,18 @@ public:
      */
     virtual int Transceive(uint32_t tagDiscId, const std::string& command, std::string& response) = 0;
 
+    /**
+     * @brief Send commands to the tags in the field, the commands of each tag are sent in order and each tag
+     * is selected once at most.
+     * @param tagDiscId The tag discovered id given from nci stack.
+     * @param items The commands to send, the responses and status codes are filled in.
+     * @return The count of commands transceived successfully.
+     */
+    virtual int TransceiveBatch(uint32_t tagDiscId, std::vector<TagTransceiveItem>& items)
+    {
+        return 0;
+    }
+
     /**
      * @brief Read the NDEF tag.
      * @param tagDiscId The tag discovered id given from nci stack.
@@ -103,6 +150,40 @@ public:
      */
     virtual std::string ReadNdef(uint32_t tagDiscId) = 0;
 
+    /**
+     * @brief Send command to tag without waiting the response, the callback is called once with the response
+     * or the timeout.
+     * @param tagDiscId The tag discovered id given from nci stack.
+     * @param command The command to send.
+     * @param callback The callback to receive the status code and the response.
+     * @return True if the command is sent, otherwise the callback is not called.
+     */
+    virtual bool TransceiveAsync(uint32_t tagDiscId, const std::string& command, TagOpCallback callback)
+    {
+        if (callback == nullptr) {
+            return false;
+        }
+        std::string response;
+        int status = Transceive(tagDiscId, command, response);
+        callback(status, response);
+        return true;
+    }
+
+    /**
+     * @brief Read the NDEF tag without waiting the data, the callback is called once with the data or the timeout.
+     * @param tagDiscId The tag discovered id given from nci stack.
+     * @param callback The callback to receive the status code and the data read from NDEF tag.
+     * @return True if the read is started, otherwise the callback is not called.
+     */
+    virtual bool ReadNdefAsync(uint32_t tagDiscId, TagOpCallback callback)
+    {
+        if (callback == nullptr) {
+            return false;
+        }
+        callback(0, ReadNdef(tagDiscId));
+        return true;
+    }
+
     /**
      * @brief Find the NDEF tag technology from the NDEF tag data.
      * @param tagDiscId The tag discovered id given from nci stack.
@@ -196,6 +277,15 @@ public:
      */
     virtual uint32_t GetIsoDepMaxTransceiveLength() = 0;
 
+    /**
+     * @brief Get the uid and technologies of all tags discovered in the field in one pass.
+     * @return The inventory of the discovered tags, empty if not supported.
+     */
+    virtual std::vector<TagInventoryItem> GetTagInventory()
+    {
+        return {};
+    }
+
     /**
      * @brief Check if the nfc controller support extended APDU or not.
      * @return True if the nfc controller support extended APDU, otherwise false.
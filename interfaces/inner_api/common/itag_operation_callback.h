@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_I_TAG_OPERATION_CALLBACK_H
+#define OHOS_I_TAG_OPERATION_CALLBACK_H
+
+#include <iremote_broker.h>
+#include <string>
+#include <string_ex.h>
+
+#include "message_parcel.h"
+#include "message_option.h"
+
+namespace OHOS {
+namespace NFC {
+namespace KITS {
+class ITagOperationCallback : public IRemoteBroker {
+public:
+    /**
+     * @brief Called once when the asynchronous tag operation completes or times out.
+     * @param errorCode ERR_NONE if succeeded, otherwise the error code same as the synchronous operation.
+     * @param hexRespData the response or the NDEF message in hex string.
+     */
+    virtual void OnTagOperationComplete(int errorCode, const std::string& hexRespData) = 0;
+
+public:
+    DECLARE_INTERFACE_DESCRIPTOR(u"ohos.nfc.kits.ITagOperationCallback");
+};
+}  // namespace KITS
+}  // namespace NFC
+}  // namespace OHOS
+#endif // OHOS_I_TAG_OPERATION_CALLBACK_H
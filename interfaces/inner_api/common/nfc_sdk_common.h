@@ -32,6 +32,8 @@ inline constexpr uint32_t NFC_MANAGER_SYS_ABILITY_ID = 1140;
 
 constexpr const char* SDK_NAME = "ConnectivityKit";
 constexpr const char* KEY_REPORT_APPID = "report_appId";
+// the detailed api event is reported once every N successful calls
+constexpr const char* KEY_REPORT_SAMPLE_INTERVAL = "report_sample_interval";
 
 enum ErrorCode : int {
     ERR_NONE = 0,
@@ -145,6 +147,13 @@ inline constexpr int BUNDLE_MGR_SERVICE_SYS_ABILITY_ID = 401;
 
 /** type const of readermode skip ndef check */
 const uint16_t SKIP_NDEF_CHECK_TECH_MASK = 0x80;
+/** type const of readermode low latency, no ndef detection or read, the tag is sent once activated */
+const uint16_t LOW_LATENCY_READER_TECH_MASK = 0x100;
+/**
+ * type const of readermode skip presence check, the reader app closes the tag to resume the polling. no presence
+ * check runs, so the tag lost is never reported to the app, until the app closes the tag.
+ */
+const uint16_t SKIP_PRESENCE_CHECK_TECH_MASK = 0x200;
 
 #ifdef VENDOR_APPLICATIONS_ENABLED
 inline constexpr int VENDOR_APP_INIT_DONE = 1;
@@ -173,6 +182,8 @@ enum class TagTechnology {
     NFC_MIFARE_ULTRALIGHT_TECH = 9,
     NFC_BARCODE = 10,
     NFC_SKIP_NDEF_CHECK_TECH = 11,
+    NFC_LOW_LATENCY_READER_TECH = 12,
+    NFC_SKIP_PRESENCE_CHECK_TECH = 13,
 };
 
 enum EmNfcForumType {
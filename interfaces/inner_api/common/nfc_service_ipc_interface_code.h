@@ -46,6 +46,7 @@ public:
         COMMAND_REG_READER_MODE,
         COMMAND_UNREG_READER_MODE,
         COMMAND_TAG_FOUND_READER_MODE,
+        COMMAND_TAG_OPERATION_COMPLETE,
         // The last code, if you want to add a new code, please add it before this
         COMMAND_NFC_CONTROLLER_CALLBACK_STUB_BOTTOM
     };
@@ -69,7 +70,12 @@ public:
         COMMAND_SET_TIMEOUT,
         COMMAND_GET_TIMEOUT,
         COMMAND_RESET_TIMEOUT,
-        COMMAND_IS_CONNECTED
+        COMMAND_IS_CONNECTED,
+        COMMAND_SEND_RAW_FRAME_ASYNC,
+        COMMAND_NDEF_READ_ASYNC,
+        COMMAND_SEND_RAW_FRAME_BYTES,
+        COMMAND_SEND_RAW_FRAME_BATCH,
+        COMMAND_GET_TAG_INVENTORY
     };
     enum HceSessionCode {
         COMMAND_CE_UNKNOW = 300,
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tag_tech_extras.h"
+#include "loghelper.h"
+#include "taginfo.h"
+
+namespace OHOS {
+namespace NFC {
+namespace KITS {
+static const uint32_t MAX_EXTRAS_STRING_LEN = 0xFFFF;
+
+// PacMap keys of the fields, in the order of the enums.
+static const char* const INT_FIELD_KEYS[TagTechExtras::INT_FIELD_NUM] = {
+    TagInfo::SAK,
+    TagInfo::RESPONSE_FLAGS,
+    TagInfo::DSF_ID,
+    TagInfo::MIFARE_ULTRALIGHT_C_TYPE,
+    TagInfo::NDEF_FORUM_TYPE,
+    TagInfo::NDEF_TAG_LENGTH,
+    TagInfo::NDEF_TAG_MODE,
+};
+
+static const char* const STRING_FIELD_KEYS[TagTechExtras::STRING_FIELD_NUM] = {
+    TagInfo::ATQA,
+    TagInfo::APP_DATA,
+    TagInfo::PROTOCOL_INFO,
+    TagInfo::HISTORICAL_BYTES,
+    TagInfo::HILAYER_RESPONSE,
+    TagInfo::NFCF_PMM,
+    TagInfo::NFCF_SC,
+    TagInfo::NDEF_MSG,
+};
+
+void TagTechExtras::PutIntValue(IntField field, int value)
+{
+    if (field < 0 || field >= INT_FIELD_NUM) {
+        return;
+    }
+    intValues_[field] = value;
+    intMask_ |= (1u << field);
+}
+
+int TagTechExtras::GetIntValue(IntField field, int defaultValue) const
+{
+    return HasIntValue(field) ? intValues_[field] : defaultValue;
+}
+
+bool TagTechExtras::HasIntValue(IntField field) const
+{
+    return (field >= 0 && field < INT_FIELD_NUM && (intMask_ & (1u << field)) != 0);
+}
+
+void TagTechExtras::PutStringValue(StringField field, const std::string& value)
+{
+    if (field < 0 || field >= STRING_FIELD_NUM) {
+        return;
+    }
+    stringValues_[field] = value;
+    stringMask_ |= (1u << field);
+}
+
+std::string TagTechExtras::GetStringValue(StringField field, const std::string& defaultValue) const
+{
+    return HasStringValue(field) ? stringValues_[field] : defaultValue;
+}
+
+bool TagTechExtras::HasStringValue(StringField field) const
+{
+    return (field >= 0 && field < STRING_FIELD_NUM && (stringMask_ & (1u << field)) != 0);
+}
+
+bool TagTechExtras::IsEmpty() const
+{
+    return intMask_ == 0 && stringMask_ == 0;
+}
+
+void TagTechExtras::Clear()
+{
+    *this = TagTechExtras();
+}
+
+bool TagTechExtras::Marshalling(Parcel &parcel) const
+{
+    if (!parcel.WriteUint32(intMask_) || !parcel.WriteUint32(stringMask_)) {
+        return false;
+    }
+    for (int i = 0; i < INT_FIELD_NUM; i++) {
+        if (((intMask_ & (1u << i)) != 0) && !parcel.WriteInt32(intValues_[i])) {
+            return false;
+        }
+    }
+    for (int i = 0; i < STRING_FIELD_NUM; i++) {
+        if (((stringMask_ & (1u << i)) != 0) && !parcel.WriteString(stringValues_[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TagTechExtras::Unmarshalling(Parcel &parcel)
+{
+    Clear();
+    uint32_t intMask = 0;
+    uint32_t stringMask = 0;
+    if (!parcel.ReadUint32(intMask) || !parcel.ReadUint32(stringMask) ||
+        (intMask >> INT_FIELD_NUM) != 0 || (stringMask >> STRING_FIELD_NUM) != 0) {
+        ErrorLog("TagTechExtras::Unmarshalling: invalid mask");
+        return false;
+    }
+    for (int i = 0; i < INT_FIELD_NUM; i++) {
+        int32_t value = 0;
+        if ((intMask & (1u << i)) == 0) {
+            continue;
+        }
+        if (!parcel.ReadInt32(value)) {
+            return false;
+        }
+        PutIntValue(static_cast<IntField>(i), value);
+    }
+    for (int i = 0; i < STRING_FIELD_NUM; i++) {
+        std::string value;
+        if ((stringMask & (1u << i)) == 0) {
+            continue;
+        }
+        if (!parcel.ReadString(value) || value.size() > MAX_EXTRAS_STRING_LEN) {
+            return false;
+        }
+        PutStringValue(static_cast<StringField>(i), value);
+    }
+    return true;
+}
+
+AppExecFwk::PacMap TagTechExtras::ToPacMap() const
+{
+    AppExecFwk::PacMap pacMap;
+    for (int i = 0; i < INT_FIELD_NUM; i++) {
+        if ((intMask_ & (1u << i)) == 0) {
+            continue;
+        }
+        if (i == MIFARE_ULTRALIGHT_C_TYPE) {
+            pacMap.PutBooleanValue(INT_FIELD_KEYS[i], intValues_[i] != 0);
+        } else {
+            pacMap.PutIntValue(INT_FIELD_KEYS[i], intValues_[i]);
+        }
+    }
+    for (int i = 0; i < STRING_FIELD_NUM; i++) {
+        if ((stringMask_ & (1u << i)) != 0) {
+            pacMap.PutStringValue(STRING_FIELD_KEYS[i], stringValues_[i]);
+        }
+    }
+    return pacMap;
+}
+
+TagTechExtras TagTechExtras::FromPacMap(AppExecFwk::PacMap& map)
+{
+    TagTechExtras extras;
+    for (int i = 0; i < INT_FIELD_NUM; i++) {
+        if (!map.HasKey(INT_FIELD_KEYS[i])) {
+            continue;
+        }
+        int value = (i == MIFARE_ULTRALIGHT_C_TYPE) ?
+            static_cast<int>(map.GetBooleanValue(INT_FIELD_KEYS[i], false)) : map.GetIntValue(INT_FIELD_KEYS[i], 0);
+        extras.PutIntValue(static_cast<IntField>(i), value);
+    }
+    for (int i = 0; i < STRING_FIELD_NUM; i++) {
+        if (map.HasKey(STRING_FIELD_KEYS[i])) {
+            extras.PutStringValue(static_cast<StringField>(i), map.GetStringValue(STRING_FIELD_KEYS[i], ""));
+        }
+    }
+    return extras;
+}
+}  // namespace KITS
+}  // namespace NFC
+}  // namespace OHOS
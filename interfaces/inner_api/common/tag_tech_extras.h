@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TAG_TECH_EXTRAS_H
+#define TAG_TECH_EXTRAS_H
+#include <string>
+#include "pac_map.h"
+#include "parcel.h"
+
+namespace OHOS {
+namespace NFC {
+namespace KITS {
+/**
+ * @brief Extra data of one technology of the tag, such as SAK/ATQA of NfcA. The values are kept in fixed slots
+ * and marshalled with a presence mask, PacMap is built only for the legacy consumers.
+ */
+class TagTechExtras {
+public:
+    enum IntField {
+        SAK = 0,
+        RESPONSE_FLAGS,
+        DSF_ID,
+        MIFARE_ULTRALIGHT_C_TYPE,
+        NDEF_FORUM_TYPE,
+        NDEF_TAG_LENGTH,
+        NDEF_TAG_MODE,
+        INT_FIELD_NUM
+    };
+
+    enum StringField {
+        ATQA = 0,
+        APP_DATA,
+        PROTOCOL_INFO,
+        HISTORICAL_BYTES,
+        HILAYER_RESPONSE,
+        NFCF_PMM,
+        NFCF_SC,
+        NDEF_MSG,
+        STRING_FIELD_NUM
+    };
+
+    TagTechExtras() = default;
+    ~TagTechExtras() = default;
+
+    void PutIntValue(IntField field, int value);
+    int GetIntValue(IntField field, int defaultValue) const;
+    bool HasIntValue(IntField field) const;
+    void PutStringValue(StringField field, const std::string& value);
+    std::string GetStringValue(StringField field, const std::string& defaultValue) const;
+    bool HasStringValue(StringField field) const;
+    bool IsEmpty() const;
+    void Clear();
+
+    bool Marshalling(Parcel &parcel) const;
+    bool Unmarshalling(Parcel &parcel);
+
+    // conversion for the consumers still using PacMap.
+    AppExecFwk::PacMap ToPacMap() const;
+    static TagTechExtras FromPacMap(AppExecFwk::PacMap& map);
+
+private:
+    uint32_t intMask_ = 0;
+    uint32_t stringMask_ = 0;
+    int intValues_[INT_FIELD_NUM] = {0};
+    std::string stringValues_[STRING_FIELD_NUM] {};
+};
+}  // namespace KITS
+}  // namespace NFC
+}  // namespace OHOS
+#endif  // TAG_TECH_EXTRAS_H
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TAG_TECH_TRAITS_H
+#define TAG_TECH_TRAITS_H
+#include <cstdint>
+#include <iterator>
+#include "nfc_sdk_common.h"
+
+namespace OHOS {
+namespace NFC {
+namespace KITS {
+/**
+ * @brief The constant traits of a tag technology. A technology is added by one entry of TAG_TECH_TRAITS, it's
+ * the only place of the defaults in the nfc service. The tag classes of the inner api keep no defaults, they get
+ * them from TagSession.
+ */
+struct TagTechTraits {
+    TagTechnology tech;
+    uint32_t defaultTimeout; // ms, 0 for the technologies without commands of their own
+    int maxTransceiveLength; // bytes, 0 if the technology can not send raw commands
+};
+
+// indexed by the value of TagTechnology.
+inline constexpr TagTechTraits TAG_TECH_TRAITS[] = {
+    { TagTechnology::NFC_INVALID_TECH, 0, 0 },
+    { TagTechnology::NFC_A_TECH, 618, 253 },
+    { TagTechnology::NFC_B_TECH, 1000, 253 },
+    { TagTechnology::NFC_ISODEP_TECH, 618, 0xFEFF },
+    { TagTechnology::NFC_F_TECH, 255, 255 },
+    { TagTechnology::NFC_V_TECH, 1000, 253 },
+    { TagTechnology::NFC_NDEF_TECH, 1000, 0 },
+    { TagTechnology::NFC_NDEF_FORMATABLE_TECH, 1000, 0 },
+    { TagTechnology::NFC_MIFARE_CLASSIC_TECH, 618, 253 },
+    { TagTechnology::NFC_MIFARE_ULTRALIGHT_TECH, 618, 253 },
+    { TagTechnology::NFC_BARCODE, 0, 0 },
+};
+
+/**
+ * @brief Get the traits of the technology, the traits of NFC_INVALID_TECH for an unknown technology.
+ */
+inline constexpr const TagTechTraits& GetTagTechTraits(int tech)
+{
+    if (tech <= 0 || tech >= static_cast<int>(std::size(TAG_TECH_TRAITS))) {
+        return TAG_TECH_TRAITS[0];
+    }
+    return TAG_TECH_TRAITS[tech];
+}
+
+inline constexpr bool IsTagTechTraitsIndexed()
+{
+    for (size_t i = 0; i < std::size(TAG_TECH_TRAITS); i++) {
+        if (static_cast<size_t>(TAG_TECH_TRAITS[i].tech) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(IsTagTechTraitsIndexed(), "TAG_TECH_TRAITS must be in the order of TagTechnology");
+}  // namespace KITS
+}  // namespace NFC
+}  // namespace OHOS
+#endif  // TAG_TECH_TRAITS_H
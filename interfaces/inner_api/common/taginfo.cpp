@@ -30,7 +30,22 @@ TagInfo::TagInfo(std::vector<int> tagTechList,
     tagRfDiscId_ = tagRfDiscId;
     tagUid_ = tagUid;
     tagTechList_ = std::move(tagTechList);
-    tagTechExtrasData_ = std::move(tagTechExtrasData);
+    for (AppExecFwk::PacMap& pacMap : tagTechExtrasData) {
+        tagTechExtras_.push_back(TagTechExtras::FromPacMap(pacMap));
+    }
+    connectedTagTech_ = KITS::TagTechnology::NFC_INVALID_TECH;
+}
+
+TagInfo::TagInfo(std::vector<int> tagTechList,
+                 std::vector<TagTechExtras> tagTechExtras,
+                 std::string& tagUid,
+                 int tagRfDiscId,
+                 OHOS::sptr<IRemoteObject> tagServiceIface)
+{
+    tagRfDiscId_ = tagRfDiscId;
+    tagUid_ = tagUid;
+    tagTechList_ = std::move(tagTechList);
+    tagTechExtras_ = std::move(tagTechExtras);
     connectedTagTech_ = KITS::TagTechnology::NFC_INVALID_TECH;
 }
 
@@ -86,33 +101,40 @@ std::string TagInfo::GetStringTech(int tech)
     return "";
 }
 
-AppExecFwk::PacMap TagInfo::GetTechExtrasByIndex(size_t techIndex)
+TagTechExtras TagInfo::GetTechExtrasAt(size_t techIndex) const
 {
-    AppExecFwk::PacMap pacmap;
-    if (tagTechList_.size() == 0 || tagTechList_.size() != tagTechExtrasData_.size()) {
-        ErrorLog("Taginfo:: tagTechList_lenth != tagTechExtrasData_length.");
-        return pacmap;
+    if (tagTechList_.size() == 0 || tagTechList_.size() != tagTechExtras_.size()) {
+        ErrorLog("Taginfo:: tagTechList_lenth != tagTechExtras_length.");
+        return TagTechExtras();
     }
-    if (techIndex >= tagTechExtrasData_.size()) {
-        return pacmap;
+    if (techIndex >= tagTechExtras_.size()) {
+        return TagTechExtras();
     }
-    return tagTechExtrasData_[techIndex];
+    return tagTechExtras_[techIndex];
 }
 
-AppExecFwk::PacMap TagInfo::GetTechExtrasByTech(KITS::TagTechnology tech)
+TagTechExtras TagInfo::GetTechExtras(KITS::TagTechnology tech) const
 {
-    AppExecFwk::PacMap pacmap;
-    if (tagTechList_.size() == 0 || tagTechList_.size() != tagTechExtrasData_.size()) {
-        return pacmap;
+    if (tagTechList_.size() == 0 || tagTechList_.size() != tagTechExtras_.size()) {
+        return TagTechExtras();
     }
 
     for (size_t i = 0; i < tagTechList_.size(); i++) {
         if (static_cast<int>(tech) == tagTechList_[i]) {
-            pacmap = tagTechExtrasData_[i];
-            break;
+            return tagTechExtras_[i];
         }
     }
-    return pacmap;
+    return TagTechExtras();
+}
+
+AppExecFwk::PacMap TagInfo::GetTechExtrasByIndex(size_t techIndex)
+{
+    return GetTechExtrasAt(techIndex).ToPacMap();
+}
+
+AppExecFwk::PacMap TagInfo::GetTechExtrasByTech(KITS::TagTechnology tech)
+{
+    return GetTechExtras(tech).ToPacMap();
 }
 
 std::string TagInfo::GetStringExtrasData(AppExecFwk::PacMap& extrasData, const std::string& extrasName)
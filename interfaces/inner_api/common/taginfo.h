@@ -17,6 +17,7 @@
 #include "nfc_sdk_common.h"
 #include "pac_map.h"
 #include "parcel.h"
+#include "tag_tech_extras.h"
 
 namespace OHOS {
 namespace NFC {
@@ -57,11 +58,21 @@ public:
         std::string& tagUid,
         int tagRfDiscId,
         OHOS::sptr<IRemoteObject> tagServiceIface);
+    TagInfo(std::vector<int> tagTechList,
+        std::vector<TagTechExtras> tagTechExtras,
+        std::string& tagUid,
+        int tagRfDiscId,
+        OHOS::sptr<IRemoteObject> tagServiceIface);
     ~TagInfo();
 
     std::string GetTagUid() const;
     std::vector<int> GetTagTechList() const;
 
+    // the extras of the technology, empty if the technology is not found.
+    TagTechExtras GetTechExtras(KITS::TagTechnology tech) const;
+    TagTechExtras GetTechExtrasAt(size_t techIndex) const;
+
+    // legacy PacMap form, built on each call.
     AppExecFwk::PacMap GetTechExtrasByIndex(size_t techIndex);
     AppExecFwk::PacMap GetTechExtrasByTech(KITS::TagTechnology tech);
     std::string GetStringExtrasData(AppExecFwk::PacMap& extrasData, const std::string& extrasName);
@@ -78,7 +89,7 @@ private:
     KITS::TagTechnology connectedTagTech_;
     std::string tagUid_;
     std::vector<int> tagTechList_;
-    std::vector<AppExecFwk::PacMap> tagTechExtrasData_;
+    std::vector<TagTechExtras> tagTechExtras_;
 };
 }  // namespace KITS
 }  // namespace NFC
@@ -32,14 +32,29 @@ TagInfoParcelable::TagInfoParcelable(std::vector<int> tagTechList,
     tagUid_ = tagUid;
     tagTechList_ = std::move(tagTechList);
     tagServiceIface_ = tagServiceIface;
-    tagTechExtrasData_ = std::move(tagTechExtrasData);
+    for (AppExecFwk::PacMap& pacMap : tagTechExtrasData) {
+        tagTechExtras_.push_back(TagTechExtras::FromPacMap(pacMap));
+    }
+}
+
+TagInfoParcelable::TagInfoParcelable(std::vector<int> tagTechList,
+                                     std::vector<TagTechExtras> tagTechExtras,
+                                     std::string& tagUid,
+                                     int tagRfDiscId,
+                                     OHOS::sptr<IRemoteObject> tagServiceIface)
+{
+    tagRfDiscId_ = tagRfDiscId;
+    tagUid_ = tagUid;
+    tagTechList_ = std::move(tagTechList);
+    tagServiceIface_ = tagServiceIface;
+    tagTechExtras_ = std::move(tagTechExtras);
 }
 
 TagInfoParcelable::~TagInfoParcelable()
 {
     tagUid_.clear();
     tagTechList_.clear();
-    tagTechExtrasData_.clear();
+    tagTechExtras_.clear();
     tagRfDiscId_ = 0;
     tagServiceIface_ = nullptr;
 }
@@ -48,9 +63,9 @@ bool TagInfoParcelable::Marshalling(Parcel &parcel) const
 {
     const std::vector<int> tagTechList = std::move(tagTechList_);
     parcel.WriteInt32Vector(tagTechList);
-    parcel.WriteInt32(tagTechExtrasData_.size());
-    for (unsigned int i = 0; i < tagTechExtrasData_.size(); i++) {
-        tagTechExtrasData_[i].Marshalling(parcel);
+    parcel.WriteInt32(tagTechExtras_.size());
+    for (unsigned int i = 0; i < tagTechExtras_.size(); i++) {
+        tagTechExtras_[i].Marshalling(parcel);
     }
     parcel.WriteString(tagUid_);
     parcel.WriteInt32(tagRfDiscId_);
@@ -68,24 +83,20 @@ TagInfoParcelable *TagInfoParcelable::Unmarshalling(Parcel &parcel)
         tagTechList.size() > MAX_TECH_LIST_SIZE) {
         return nullptr;
     }
-    std::vector<AppExecFwk::PacMap> tagTechExtrasData;
+    std::vector<TagTechExtras> tagTechExtras(extraLen);
     for (int i = 0; i < extraLen; i++) {
-        AppExecFwk::PacMap* pacMap = AppExecFwk::PacMap::Unmarshalling(parcel);
-        if (pacMap == nullptr) {
-            tagTechExtrasData.clear();
-            ErrorLog("fail to unmarshall pacMap");
+        if (!tagTechExtras[i].Unmarshalling(parcel)) {
+            ErrorLog("fail to unmarshall tech extras");
             return nullptr;
         }
-        std::unique_ptr<AppExecFwk::PacMap> pacMapPtr(pacMap);
-        tagTechExtrasData.push_back(*pacMapPtr);
     }
     std::string tagUid;
     parcel.ReadString(tagUid);
 
     int tagRfDiscId = 0;
     parcel.ReadInt32(tagRfDiscId);
-    TagInfoParcelable *taginfo = new (std::nothrow) TagInfoParcelable(tagTechList, tagTechExtrasData,
-        tagUid, tagRfDiscId, nullptr);
+    TagInfoParcelable *taginfo = new (std::nothrow) TagInfoParcelable(std::move(tagTechList),
+        std::move(tagTechExtras), tagUid, tagRfDiscId, nullptr);
 
     if (taginfo == nullptr) {
         ErrorLog("taginfo is nullptr");
@@ -108,9 +119,18 @@ int TagInfoParcelable::GetDiscId()
     return tagRfDiscId_;
 }
 
+const std::vector<TagTechExtras>& TagInfoParcelable::GetTechExtrasList() const
+{
+    return tagTechExtras_;
+}
+
 std::vector<AppExecFwk::PacMap> TagInfoParcelable::GetTechExtrasDataList()
 {
-    return tagTechExtrasData_;
+    std::vector<AppExecFwk::PacMap> tagTechExtrasData;
+    for (const TagTechExtras& extras : tagTechExtras_) {
+        tagTechExtrasData.push_back(extras.ToPacMap());
+    }
+    return tagTechExtrasData;
 }
 
 std::string TagInfoParcelable::ToString()
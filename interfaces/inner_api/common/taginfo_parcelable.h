@@ -16,6 +16,7 @@
 #define TAG_INFO_PARCELABLE_H
 #include "pac_map.h"
 #include "parcel.h"
+#include "tag_tech_extras.h"
 
 namespace OHOS {
 namespace NFC {
@@ -27,6 +28,11 @@ public:
         std::string &tagUid,
         int tagRfDiscId,
         OHOS::sptr<IRemoteObject> tagServiceIface);
+    TagInfoParcelable(std::vector<int> tagTechList,
+        std::vector<TagTechExtras> tagTechExtras,
+        std::string &tagUid,
+        int tagRfDiscId,
+        OHOS::sptr<IRemoteObject> tagServiceIface);
     ~TagInfoParcelable();
 
     bool Marshalling(Parcel &parcel) const override;
@@ -35,13 +41,15 @@ public:
     std::string GetUid();
     std::vector<int> GetTechList();
     int GetDiscId();
+    const std::vector<TagTechExtras>& GetTechExtrasList() const;
+    // legacy PacMap form, built on each call.
     std::vector<AppExecFwk::PacMap> GetTechExtrasDataList();
 
 private:
     int tagRfDiscId_;
     std::string tagUid_;
     std::vector<int> tagTechList_;
-    std::vector<AppExecFwk::PacMap> tagTechExtrasData_;
+    std::vector<TagTechExtras> tagTechExtras_;
     OHOS::sptr<IRemoteObject> tagServiceIface_;
 
     static constexpr size_t MAX_TECH_LIST_SIZE = 20;
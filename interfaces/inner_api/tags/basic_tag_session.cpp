@@ -16,6 +16,7 @@
 #include "loghelper.h"
 #include "nfc_controller.h"
 #include "nfc_sdk_common.h"
+#include "tag_operation_callback_stub.h"
 #include "tag_session_proxy.h"
 
 namespace OHOS {
@@ -137,6 +138,80 @@ int BasicTagSession::SendCommand(const std::string& hexCmdData, bool raw, std::s
     return static_cast<int>(tagSession->SendRawFrame(GetTagRfDiscId(), hexCmdData, raw, hexRespData));
 }
 
+int BasicTagSession::SendCommand(const std::vector<uint8_t>& cmdData, bool raw, std::vector<uint8_t> &respData)
+{
+    OHOS::sptr<ITagSession> tagSession = GetTagSessionProxy();
+    if (tagSession == nullptr || tagSession->AsObject() == nullptr) {
+        ErrorLog("BasicTagSession::SendCommand tagSession invalid");
+        return ErrorCode::ERR_TAG_STATE_UNBIND;
+    }
+    return static_cast<int>(tagSession->SendRawFrameBytes(GetTagRfDiscId(), cmdData, raw, respData));
+}
+
+int BasicTagSession::SendCommandBatch(const std::vector<int>& rfDiscIds, const std::vector<std::string>& hexCmds,
+    std::vector<std::string>& hexResps, std::vector<int>& results)
+{
+    OHOS::sptr<ITagSession> tagSession = GetTagSessionProxy();
+    if (tagSession == nullptr || tagSession->AsObject() == nullptr) {
+        ErrorLog("BasicTagSession::SendCommandBatch tagSession invalid");
+        return ErrorCode::ERR_TAG_STATE_UNBIND;
+    }
+    return static_cast<int>(tagSession->SendRawFrameBatch(GetTagRfDiscId(), rfDiscIds, hexCmds, hexResps, results));
+}
+
+int BasicTagSession::GetTagInventory(std::vector<int>& rfDiscIds, std::vector<std::string>& uids,
+    std::vector<std::vector<int>>& techLists)
+{
+    techLists.clear();
+    OHOS::sptr<ITagSession> tagSession = GetTagSessionProxy();
+    if (tagSession == nullptr || tagSession->AsObject() == nullptr) {
+        ErrorLog("BasicTagSession::GetTagInventory tagSession invalid");
+        return ErrorCode::ERR_TAG_STATE_UNBIND;
+    }
+    std::vector<int> techCounts;
+    std::vector<int> techs;
+    int statusCode = tagSession->GetTagInventory(rfDiscIds, uids, techCounts, techs);
+    if (statusCode != ErrorCode::ERR_NONE) {
+        return statusCode;
+    }
+    if (uids.size() != rfDiscIds.size() || techCounts.size() != rfDiscIds.size()) {
+        ErrorLog("BasicTagSession::GetTagInventory size mismatch");
+        return ErrorCode::ERR_TAG_STATE_IO_FAILED;
+    }
+    // the technologies come flattened, split them to each tag.
+    auto techIter = techs.begin();
+    for (int techCount : techCounts) {
+        if (techCount < 0 || techs.end() - techIter < techCount) {
+            ErrorLog("BasicTagSession::GetTagInventory invalid tech count");
+            techLists.clear();
+            return ErrorCode::ERR_TAG_STATE_IO_FAILED;
+        }
+        techLists.emplace_back(techIter, techIter + techCount);
+        techIter += techCount;
+    }
+    return ErrorCode::ERR_NONE;
+}
+
+int BasicTagSession::SendCommandAsync(const std::string& hexCmdData, bool raw,
+    std::function<void(int errorCode, const std::string& hexRespData)> onResponse)
+{
+    if (onResponse == nullptr) {
+        ErrorLog("BasicTagSession::SendCommandAsync onResponse is null");
+        return ErrorCode::ERR_TAG_PARAMETERS;
+    }
+    OHOS::sptr<ITagSession> tagSession = GetTagSessionProxy();
+    if (tagSession == nullptr || tagSession->AsObject() == nullptr) {
+        ErrorLog("BasicTagSession::SendCommandAsync tagSession invalid");
+        return ErrorCode::ERR_TAG_STATE_UNBIND;
+    }
+    sptr<ITagOperationCallback> callback = new (std::nothrow) TAG::TagOperationCallbackStub(onResponse);
+    if (callback == nullptr) {
+        ErrorLog("BasicTagSession::SendCommandAsync alloc callback failed");
+        return ErrorCode::ERR_TAG_PARAMETERS;
+    }
+    return static_cast<int>(tagSession->SendRawFrameAsync(GetTagRfDiscId(), hexCmdData, raw, callback));
+}
+
 int BasicTagSession::GetMaxSendCommandLength(int &maxSize)
 {
     if (tagInfo_.expired() || (tagTechnology_ == KITS::TagTechnology::NFC_INVALID_TECH)) {
@@ -15,6 +15,7 @@
 #ifndef BASIC_TAG_SESSION_H
 #define BASIC_TAG_SESSION_H
 
+#include <functional>
 #include "itag_session.h"
 #include "taginfo.h"
 
@@ -34,7 +35,19 @@ public:
     void ResetTimeout();
     std::string GetTagUid();
     int SendCommand(const std::string& hexCmdData, bool raw, std::string &hexRespData);
+    // same as above but the command and the response are kept in bytes, without the hex string conversion.
+    int SendCommand(const std::vector<uint8_t>& cmdData, bool raw, std::vector<uint8_t> &respData);
+    // returns without waiting the response, onResponse is called once with the error code and the response.
+    int SendCommandAsync(const std::string& hexCmdData, bool raw,
+        std::function<void(int errorCode, const std::string& hexRespData)> onResponse);
     int GetMaxSendCommandLength(int &maxSize);
+    // sends each command to the tag of the field with its rf disc id, each tag is selected once at most.
+    // results has the error code of each command, same as SendCommand.
+    int SendCommandBatch(const std::vector<int>& rfDiscIds, const std::vector<std::string>& hexCmds,
+        std::vector<std::string>& hexResps, std::vector<int>& results);
+    // the rf disc id, uid and technologies of each tag in the field.
+    int GetTagInventory(std::vector<int>& rfDiscIds, std::vector<std::string>& uids,
+        std::vector<std::vector<int>>& techLists);
     std::weak_ptr<TagInfo> GetTagInfo() const;
 
 protected:
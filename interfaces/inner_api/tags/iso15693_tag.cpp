@@ -26,13 +26,13 @@ Iso15693Tag::Iso15693Tag(std::weak_ptr<TagInfo> tag) : BasicTagSession(tag, KITS
         ErrorLog("tag is null.");
         return;
     }
-    AppExecFwk::PacMap extraData = tagPtr->GetTechExtrasByTech(KITS::TagTechnology::NFC_V_TECH);
+    TagTechExtras extraData = tagPtr->GetTechExtras(KITS::TagTechnology::NFC_V_TECH);
     if (extraData.IsEmpty()) {
         ErrorLog("Iso15693Tag::Iso15693Tag extra data invalid");
         return;
     }
-    dsfId_ = char(tagPtr->GetIntExtrasData(extraData, TagInfo::DSF_ID));
-    respFlags_ = char(tagPtr->GetIntExtrasData(extraData, TagInfo::RESPONSE_FLAGS));
+    dsfId_ = char(extraData.GetIntValue(TagTechExtras::DSF_ID, 0));
+    respFlags_ = char(extraData.GetIntValue(TagTechExtras::RESPONSE_FLAGS, 0));
 }
 
 Iso15693Tag::~Iso15693Tag()
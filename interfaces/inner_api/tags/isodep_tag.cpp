@@ -26,13 +26,13 @@ IsoDepTag::IsoDepTag(std::weak_ptr<TagInfo> tag) : BasicTagSession(tag, KITS::Ta
         ErrorLog("tag is null.");
         return;
     }
-    AppExecFwk::PacMap extraData = tagPtr->GetTechExtrasByTech(KITS::TagTechnology::NFC_ISODEP_TECH);
+    TagTechExtras extraData = tagPtr->GetTechExtras(KITS::TagTechnology::NFC_ISODEP_TECH);
     if (extraData.IsEmpty()) {
         ErrorLog("IsoDepTag::IsoDepTag extra data invalid");
         return;
     }
-    historicalBytes_ = tagPtr->GetStringExtrasData(extraData, TagInfo::HISTORICAL_BYTES);
-    hiLayerResponse_ = tagPtr->GetStringExtrasData(extraData, TagInfo::HILAYER_RESPONSE);
+    historicalBytes_ = extraData.GetStringValue(TagTechExtras::HISTORICAL_BYTES, "");
+    hiLayerResponse_ = extraData.GetStringValue(TagTechExtras::HILAYER_RESPONSE, "");
     DebugLog("IsoDepTag::IsoDepTag historicalBytes_(%{public}s) hiLayerResponse_(%{public}s)",
         historicalBytes_.c_str(), hiLayerResponse_.c_str());
 }
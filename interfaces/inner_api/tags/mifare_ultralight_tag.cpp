@@ -40,8 +40,8 @@ MifareUltralightTag::MifareUltralightTag(std::weak_ptr<TagInfo> tag)
 
     if (nfcA->GetSak() == 0x00 &&
         KITS::NfcSdkCommon::GetByteFromHexStr(tagPtr->GetTagUid(), 0) == NXP_MANUFACTURER_ID) {
-        AppExecFwk::PacMap extraData = tagPtr->GetTechExtrasByTech(KITS::TagTechnology::NFC_MIFARE_ULTRALIGHT_TECH);
-        if (tagPtr->GetBoolExtrasData(extraData, TagInfo::MIFARE_ULTRALIGHT_C_TYPE)) {
+        TagTechExtras extraData = tagPtr->GetTechExtras(KITS::TagTechnology::NFC_MIFARE_ULTRALIGHT_TECH);
+        if (extraData.GetIntValue(TagTechExtras::MIFARE_ULTRALIGHT_C_TYPE, 0) != 0) {
             type_ = EmType::TYPE_ULTRALIGHT_C;
         } else {
             type_ = EmType::TYPE_ULTRALIGHT;
@@ -25,16 +25,16 @@ NdefTag::NdefTag(std::weak_ptr<TagInfo> tag) : BasicTagSession(tag, KITS::TagTec
         ErrorLog("tag is null.");
         return;
     }
-    AppExecFwk::PacMap extraData = tagPtr->GetTechExtrasByTech(KITS::TagTechnology::NFC_NDEF_TECH);
+    TagTechExtras extraData = tagPtr->GetTechExtras(KITS::TagTechnology::NFC_NDEF_TECH);
     if (extraData.IsEmpty()) {
         ErrorLog("NdefTag::NdefTag extra data invalid");
         return;
     }
 
-    nfcForumType_ = (EmNfcForumType)tagPtr->GetIntExtrasData(extraData, TagInfo::NDEF_FORUM_TYPE);
-    ndefTagMode_ = (EmNdefTagMode)tagPtr->GetIntExtrasData(extraData, TagInfo::NDEF_TAG_MODE);
-    ndefMsg_ = tagPtr->GetStringExtrasData(extraData, TagInfo::NDEF_MSG);
-    maxTagSize_ = static_cast<uint32_t>(tagPtr->GetIntExtrasData(extraData, TagInfo::NDEF_TAG_LENGTH));
+    nfcForumType_ = (EmNfcForumType)extraData.GetIntValue(TagTechExtras::NDEF_FORUM_TYPE, 0);
+    ndefTagMode_ = (EmNdefTagMode)extraData.GetIntValue(TagTechExtras::NDEF_TAG_MODE, 0);
+    ndefMsg_ = extraData.GetStringValue(TagTechExtras::NDEF_MSG, "");
+    maxTagSize_ = static_cast<uint32_t>(extraData.GetIntValue(TagTechExtras::NDEF_TAG_LENGTH, 0));
 
     InfoLog("NdefTag::NdefTag nfcForumType_(%{public}d) ndefTagMode_(%{public}d) maxTagSize_(%{public}d)",
         nfcForumType_, ndefTagMode_, maxTagSize_);
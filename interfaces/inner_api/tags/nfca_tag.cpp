@@ -26,20 +26,19 @@ NfcATag::NfcATag(std::weak_ptr<TagInfo> tag) : BasicTagSession(tag, KITS::TagTec
         ErrorLog("tag is null.");
         return;
     }
-    AppExecFwk::PacMap extraData = tagPtr->GetTechExtrasByTech(KITS::TagTechnology::NFC_A_TECH);
+    TagTechExtras extraData = tagPtr->GetTechExtras(KITS::TagTechnology::NFC_A_TECH);
     if (extraData.IsEmpty()) {
         ErrorLog("NfcATag::NfcATag extra data invalid");
         return;
     }
     if (tagPtr->IsTechSupported(KITS::TagTechnology::NFC_MIFARE_CLASSIC_TECH)) {
-        AppExecFwk::PacMap mifareExtra = tagPtr->GetTechExtrasByTech(
-            KITS::TagTechnology::NFC_MIFARE_CLASSIC_TECH);
-        sak_ = tagPtr->GetIntExtrasData(mifareExtra, TagInfo::SAK);
+        TagTechExtras mifareExtra = tagPtr->GetTechExtras(KITS::TagTechnology::NFC_MIFARE_CLASSIC_TECH);
+        sak_ = mifareExtra.GetIntValue(TagTechExtras::SAK, 0);
         InfoLog("NfcATag::NfcATag mifare tech found, sak_ (0x%{public}x)", sak_);
     }
     sak_ = static_cast<uint32_t>(sak_) |
-           static_cast<uint32_t>(tagPtr->GetIntExtrasData(extraData, TagInfo::SAK));
-    atqa_ = tagPtr->GetStringExtrasData(extraData, TagInfo::ATQA);
+           static_cast<uint32_t>(extraData.GetIntValue(TagTechExtras::SAK, 0));
+    atqa_ = extraData.GetStringValue(TagTechExtras::ATQA, "");
     InfoLog("NfcATag::NfcATag sak_ (0x%{public}x), atqa_(%{public}s)", sak_, atqa_.c_str());
 }
 
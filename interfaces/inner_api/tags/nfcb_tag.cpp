@@ -26,14 +26,14 @@ NfcBTag::NfcBTag(std::weak_ptr<TagInfo> tag) : BasicTagSession(tag, KITS::TagTec
         ErrorLog("tag is null.");
         return;
     }
-    AppExecFwk::PacMap extraData = tagPtr->GetTechExtrasByTech(KITS::TagTechnology::NFC_B_TECH);
+    TagTechExtras extraData = tagPtr->GetTechExtras(KITS::TagTechnology::NFC_B_TECH);
     if (extraData.IsEmpty()) {
         ErrorLog("NfcBTag::NfcBTag extra data invalid");
         return;
     }
 
-    appData_ = tagPtr->GetStringExtrasData(extraData, TagInfo::APP_DATA);
-    protocolInfo_ = tagPtr->GetStringExtrasData(extraData, TagInfo::PROTOCOL_INFO);
+    appData_ = extraData.GetStringValue(TagTechExtras::APP_DATA, "");
+    protocolInfo_ = extraData.GetStringValue(TagTechExtras::PROTOCOL_INFO, "");
     InfoLog("NfcBTag::NfcBTag appData_(%{public}s) protocolInfo_(%{public}s)",
         appData_.c_str(), protocolInfo_.c_str());
 }
@@ -25,13 +25,13 @@ NfcFTag::NfcFTag(std::weak_ptr<TagInfo> tag) : BasicTagSession(tag, KITS::TagTec
         ErrorLog("NfcFTag::NfcFTag tag invalid.");
         return;
     }
-    AppExecFwk::PacMap extraData = tagPtr->GetTechExtrasByTech(KITS::TagTechnology::NFC_F_TECH);
+    TagTechExtras extraData = tagPtr->GetTechExtras(KITS::TagTechnology::NFC_F_TECH);
     if (extraData.IsEmpty()) {
         ErrorLog("NfcFTag::NfcFTag extra data invalid");
         return;
     }
-    pmm_ = tagPtr->GetStringExtrasData(extraData, TagInfo::NFCF_PMM);
-    systemCode_ = tagPtr->GetStringExtrasData(extraData, TagInfo::NFCF_SC);
+    pmm_ = extraData.GetStringValue(TagTechExtras::NFCF_PMM, "");
+    systemCode_ = extraData.GetStringValue(TagTechExtras::NFCF_SC, "");
 }
 
 std::shared_ptr<NfcFTag> NfcFTag::GetTag(std::weak_ptr<TagInfo> tag)
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tag_operation_callback_stub.h"
+
+#include "nfc_sdk_common.h"
+#include "nfc_service_ipc_interface_code.h"
+#include "loghelper.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TAG {
+TagOperationCallbackStub::TagOperationCallbackStub(OnCompleteFunc onComplete) : onComplete_(onComplete)
+{
+    DebugLog("TagOperationCallbackStub");
+}
+
+TagOperationCallbackStub::~TagOperationCallbackStub()
+{
+    DebugLog("~TagOperationCallbackStub");
+}
+
+void TagOperationCallbackStub::OnTagOperationComplete(int errorCode, const std::string& hexRespData)
+{
+    OnCompleteFunc onComplete = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(callbackMutex_);
+        onComplete.swap(onComplete_);
+    }
+    if (onComplete == nullptr) {
+        WarnLog("TagOperationCallbackStub::OnTagOperationComplete: already completed");
+        return;
+    }
+    onComplete(errorCode, hexRespData);
+}
+
+int TagOperationCallbackStub::OnRemoteRequest(
+    uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
+{
+    DebugLog("TagOperationCallbackStub::OnRemoteRequest,code = %{public}d", code);
+    if (data.ReadInterfaceToken() != GetDescriptor()) {
+        ErrorLog("nfc callback stub token verification error");
+        return KITS::ERR_NFC_PARAMETERS;
+    }
+    int exception = data.ReadInt32();
+    if (exception) {
+        ErrorLog("TagOperationCallbackStub::OnRemoteRequest, got exception: (%{public}d))", exception);
+        return exception;
+    }
+    int ret = KITS::ERR_TAG_STATE_UNBIND;
+    switch (code) {
+        case static_cast<uint32_t>(NfcServiceIpcInterfaceCode::COMMAND_TAG_OPERATION_COMPLETE): {
+            ret = RemoteTagOperationComplete(data, reply);
+            break;
+        }
+        default: {
+            ret = IPCObjectStub::OnRemoteRequest(code, data, reply, option);
+            break;
+        }
+    }
+    return ret;
+}
+
+int TagOperationCallbackStub::RemoteTagOperationComplete(MessageParcel &data, MessageParcel &reply)
+{
+    int errorCode = data.ReadInt32();
+    std::string hexRespData = data.ReadString();
+    OnTagOperationComplete(errorCode, hexRespData);
+    reply.WriteInt32(KITS::ERR_NONE); /* Reply 0 to indicate that no exception occurs. */
+    return KITS::ERR_NONE;
+}
+}  // namespace TAG
+}  // namespace NFC
+}  // namespace OHOS
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_TAG_OPERATION_CALLBACK_STUB_H
+#define OHOS_TAG_OPERATION_CALLBACK_STUB_H
+
+#include <functional>
+#include <mutex>
+#include "nfc_sdk_common.h"
+#include "itag_operation_callback.h"
+#include "iremote_object.h"
+#include "iremote_stub.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TAG {
+// one stub per asynchronous operation, the completion is delivered once and then dropped.
+class TagOperationCallbackStub : public IRemoteStub<KITS::ITagOperationCallback> {
+public:
+    using OnCompleteFunc = std::function<void(int errorCode, const std::string& hexRespData)>;
+
+    explicit TagOperationCallbackStub(OnCompleteFunc onComplete);
+    virtual ~TagOperationCallbackStub();
+
+    int OnRemoteRequest(
+        uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override;
+
+private:
+    void OnTagOperationComplete(int errorCode, const std::string& hexRespData) override;
+    int RemoteTagOperationComplete(MessageParcel &data, MessageParcel &reply);
+    OnCompleteFunc onComplete_;
+    std::mutex callbackMutex_;
+};
+}  // namespace TAG
+}  // namespace NFC
+}  // namespace OHOS
+#endif
@@ -32,6 +32,22 @@ struct TransportCardInfo {
     std::string rspContain;
 };
 
+struct CardCheckBranch;
+// a check apdu sent once for all the cards whose check apdus start with the same commands.
+struct CardCheckNode {
+    std::string cmdApdu;
+    uint8_t minCardIndex;
+    std::vector<CardCheckBranch> branches;
+};
+
+// the cards expecting the same rspContains in the response of the node.
+struct CardCheckBranch {
+    std::vector<uint8_t> rspContain;
+    uint8_t cardIndex; // the card whose check apdus end here, INVALID_CARD_INDEX if none
+    uint8_t minCardIndex;
+    std::vector<CardCheckNode> children;
+};
+
 static const uint8_t INVALID_CARD_INDEX = 0xFF;
 static const int INVALID_BALANCE = -1;
 static const int APDU_RSP_OK_STR_LEN = 4;
@@ -51,11 +67,21 @@ public:
     bool IsSupportedTransportCard(uint32_t rfDiscId, uint8_t &cardIndex);
     void GetBalance(uint32_t rfDiscId, uint8_t cardIndex, int &balance);
     void GetCardName(uint8_t cardIndex, std::string &cardName);
+    // the rspContains of the config is matched in bytes, so it must be an even-length hex string.
+    static bool IsValidRspContain(const std::string &rspContain);
 
 private:
+    void BuildCheckTree();
+    bool MatchCheckNode(uint32_t rfDiscId, const CardCheckNode &node, uint8_t &cardIndex,
+        std::vector<uint8_t> &replayCards);
+    bool MatchCheckBranch(uint32_t rfDiscId, const CardCheckBranch &branch, uint8_t &cardIndex,
+        std::vector<uint8_t> &replayCards, bool &isStateLeft);
+    static void CollectCards(const CardCheckNode &node, std::vector<uint8_t> &cards);
+    static void CollectCards(const CardCheckBranch &branch, std::vector<uint8_t> &cards);
     bool MatchCity(uint32_t rfDiscId, uint8_t cardIndex, std::string &rspApdu);
     bool CheckApduResponse(const std::string &response, uint8_t cardIndex);
     bool CheckApduResponse(const std::string &response);
+    static bool CheckApduResponse(const std::vector<unsigned char> &response, const std::vector<uint8_t> &rspContain);
     void GetBalanceValue(const std::string &balanceStr, int &balanceValue);
     bool DoJsonRead();
 
@@ -63,6 +89,8 @@ private:
 
     // transport card info
     std::vector<TransportCardInfo> cardInfoVec_;
+    // the check apdus of cardInfoVec_ sharing their identical leading commands, in the order of the cards.
+    std::vector<CardCheckNode> checkTree_;
     bool isInitialized_ = false;
 
     static const int BYTE_ZERO = 0;
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NDEF_DISPATCH_RULES_H
+#define NDEF_DISPATCH_RULES_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "bundle_info.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TAG {
+/**
+ * @brief The skills of the abilities and extension abilities of the installed applications (bundle names,
+ * MIME types and URI schemes) compiled into lookup tables, so the NDEF dispatch stages that cannot match any
+ * application are skipped without querying the bundle manager. When several applications match, AMS still
+ * chooses the ability to launch.
+ */
+class NdefDispatchRules {
+public:
+    enum MatchResult {
+        RULES_NOT_COMPILED = 0, // the tables are not built yet, the caller falls back to the bundle manager
+        RULES_MATCHED,
+        RULES_NOT_MATCHED,
+    };
+
+    static NdefDispatchRules &GetInstance();
+
+    /**
+     * @brief Compile the rules of all installed applications from the bundle manager.
+     */
+    void Compile();
+
+    /**
+     * @brief Replace the rules of all applications with the given bundles.
+     * @param bundleInfos The bundles, with hap modules, abilities and skills.
+     */
+    void Compile(const std::vector<AppExecFwk::BundleInfo> &bundleInfos);
+
+    /**
+     * @brief Recompile the rules of one application after it is installed or updated.
+     * @param bundleName The bundle name of the application.
+     */
+    void UpdateBundle(const std::string &bundleName);
+    void RemoveBundle(const std::string &bundleName);
+
+    MatchResult MatchBundle(const std::string &bundleName) const;
+    MatchResult MatchMimeType(const std::string &mimeType) const;
+    MatchResult MatchUriScheme(const std::string &scheme) const;
+
+private:
+    struct BundleRules {
+        std::vector<std::string> mimeTypes {};
+        std::vector<std::string> schemes {};
+    };
+
+    struct RuleTables {
+        std::unordered_set<std::string> bundles {};
+        std::unordered_set<std::string> mimeTypes {};
+        std::unordered_set<std::string> mimeWildcards {};  // the top level type of "type/*"
+        std::unordered_set<std::string> schemes {};
+        bool anyMimeType = false;
+    };
+
+    NdefDispatchRules() = default;
+    ~NdefDispatchRules() = default;
+
+    static void AddSkillRules(const std::vector<AppExecFwk::Skill> &skills, BundleRules &rules);
+    static BundleRules BuildBundleRules(const AppExecFwk::BundleInfo &bundleInfo);
+    void PublishRuleTables();
+    std::shared_ptr<const RuleTables> GetRuleTables() const;
+
+    std::mutex mutex_ {};
+    std::map<std::string, BundleRules> bundleRules_ {};
+    std::shared_ptr<const RuleTables> ruleTables_ {nullptr};
+};
+} // namespace TAG
+} // namespace NFC
+} // namespace OHOS
+#endif // NDEF_DISPATCH_RULES_H
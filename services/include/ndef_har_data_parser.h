@@ -77,12 +77,13 @@ private:
     NdefHarDataParser();
     ~NdefHarDataParser() {}
     uint16_t DispatchByHarBundleName(
-        const std::vector<std::shared_ptr<NdefRecord>> &records, const std::shared_ptr<KITS::TagInfo> &tagInfo);
+        std::vector<std::string> &harPackages, const std::shared_ptr<KITS::TagInfo> &tagInfo);
     bool ParseHarPackage(std::vector<std::string> harPackages, const std::shared_ptr<KITS::TagInfo> &tagInfo,
         const std::string &mimeType, const std::string &uri);
     bool DispatchAllHarPackage(const std::vector<std::string> &harPackages,
         const std::shared_ptr<KITS::TagInfo> &tagInfo, const std::string &mimeType, const std::string &uri);
-    void ParseMimeTypeAndStr(const std::vector<std::shared_ptr<NdefRecord>> &records);
+    void ParseRecords(
+        const std::vector<std::shared_ptr<NdefRecord>> &records, std::vector<std::string> &harPackages);
     bool StartsWith(const std::string &str, const std::string &prefix);
     void ParseRecordsProperty(const std::vector<std::shared_ptr<NdefRecord>> &records);
     uint16_t DispatchByAppLinkMode(const std::shared_ptr<KITS::TagInfo> &tagInfo);
@@ -99,6 +100,7 @@ private:
     RecordsType schemeType_ {RecordsType::TYPE_RTP_UNKNOWN};
     std::string uriAddress_ {};
     std::string uriSchemeValue_ {};
+    std::string uriScheme_ {};
     std::vector<std::pair<RecordsType, std::string>> mimeTypeVec_ {};
 
     std::weak_ptr<NfcService> nfcService_ {};
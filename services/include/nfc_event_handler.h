@@ -14,6 +14,10 @@
  */
 #ifndef NFC_EVENT_HANDLER_H
 #define NFC_EVENT_HANDLER_H
+#include <array>
+#include <functional>
+#include <map>
+#include <mutex>
 #include "common_event_manager.h"
 #include "event_handler.h"
 #include "nfc_service.h"
@@ -27,6 +31,19 @@ class NfcPollingManager;
 class NfcRoutingManager;
 class NfcEventHandler final : public AppExecFwk::EventHandler {
 public:
+    // the events run on three lanes, each on its own runner and in the order sent. the rf lane runs the tag,
+    // screen and power events, the tag dispatch blocked by the ndef reads and the ipc can't hold the ce lane back,
+    // which runs the field, card emulation, routing and package events touching the ce service and the routing.
+    // the two lanes share only the polling and routing managers, which lock their own state. the dispatch lane
+    // runs the wifi and bt connection events, whose managers lock their own state, and the tasks posted after a
+    // tag dispatch.
+    enum EventLane {
+        LANE_RF = 0,
+        LANE_CE,
+        LANE_DISPATCH,
+        LANE_COUNT,
+    };
+
     explicit NfcEventHandler(const std::shared_ptr<AppExecFwk::EventRunner>& runner,
                              std::weak_ptr<NfcService> service);
     ~NfcEventHandler();
@@ -40,6 +57,24 @@ public:
                    std::weak_ptr<NCI::INciNfccInterface> nciNfccProxy);
     void ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event) override;
 
+    // the sends and removes by event id go to the lane of the event.
+    using AppExecFwk::EventHandler::SendEvent;
+    using AppExecFwk::EventHandler::RemoveEvent;
+    bool SendEvent(uint32_t innerEventId, int64_t delayTime = 0, Priority priority = Priority::LOW);
+    bool SendEvent(uint32_t innerEventId, int64_t param, int64_t delayTime);
+    template<typename T>
+    bool SendEvent(uint32_t innerEventId, const std::shared_ptr<T>& object, int64_t delayTime = 0)
+    {
+        auto event = AppExecFwk::InnerEvent::Get(innerEventId, object);
+        return SendLaneEvent(event, delayTime, Priority::LOW);
+    }
+    void RemoveEvent(uint32_t innerEventId);
+    void RemoveEvent(uint32_t innerEventId, int64_t param);
+    static EventLane GetEventLane(uint32_t innerEventId);
+    // run a task on the dispatch lane after its pending events, false if the lane is not running.
+    bool PostDispatchTask(const std::function<void()>& task);
+    void Dump(int fd);
+
     void SubscribeScreenChangedEvent();
     void SubscribePackageChangedEvent();
     void SubscribeShutdownEvent();
@@ -57,8 +92,27 @@ protected:
     class ShutdownEventReceiver;
     // DataShare changed Receiver
     class DataShareChangedReceiver;
+    // Handler of the ce and the dispatch lanes
+    class LaneHandler;
 
 private:
+    struct LaneStats {
+        std::mutex mutex {};
+        std::map<std::pair<uint32_t, int64_t>, uint32_t> pendingEvents {}; // by event id and param
+        uint32_t depth = 0;
+        uint32_t maxDepth = 0;
+        uint64_t handledCount = 0;
+        uint64_t totalWaitUs = 0;
+        uint64_t maxWaitUs = 0;
+    };
+
+    // the handler of a lane off the rf runner, nullptr for the rf lane or a lane not running.
+    std::shared_ptr<AppExecFwk::EventHandler> GetLaneHandler(EventLane lane) const;
+    bool SendLaneEvent(AppExecFwk::InnerEvent::Pointer& event, int64_t delayTime, Priority priority);
+    void OnLaneEventSent(EventLane lane, uint32_t innerEventId, int64_t param);
+    void OnLaneEventHandled(EventLane lane, const AppExecFwk::InnerEvent::Pointer& event);
+    void HandleEvent(const AppExecFwk::InnerEvent::Pointer& event);
+
     std::shared_ptr<EventFwk::CommonEventSubscriber> screenSubscriber_ {};
     std::shared_ptr<EventFwk::CommonEventSubscriber> pkgSubscriber_ {};
     std::shared_ptr<EventFwk::CommonEventSubscriber> shutdownSubscriber_ {};
@@ -72,6 +126,9 @@ private:
     std::weak_ptr<NCI::INciNfccInterface> nciNfccProxy_ {};
 
     std::mutex commonEventMutex_ {};
+    std::shared_ptr<AppExecFwk::EventHandler> ceLane_ {};
+    std::shared_ptr<AppExecFwk::EventHandler> dispatchLane_ {};
+    std::array<LaneStats, LANE_COUNT> laneStats_ {};
 
     static constexpr const int WAIT_PROCESS_EVENT_TIMES = 60 * 1000;
 };
@@ -15,9 +15,12 @@
 #ifndef TAG_DISPATCH_H
 #define TAG_DISPATCH_H
 
+#include <atomic>
 #include <map>
 #include <mutex>
+#include <vector>
 
+#include "element_name.h"
 #include "indef_msg_callback.h"
 #include "inci_tag_interface.h"
 #include "isodep_card_handler.h"
@@ -45,10 +48,33 @@ public:
     void SetFieldCheckInterval(int interval);
 
 private:
+    // wall clock time in ms at the end of each stage of HandleTagFound
+    struct TagFoundStages {
+        long startTime = 0;
+        long techFinishTime = 0;
+        long readFinishTime = 0;
+        long tagInfoFinishTime = 0;
+        long dispatchFinishTime = 0;
+        bool isAppsPrefetched = false;
+    };
+
+    // apps resolved on the dispatch lane by the techs the tag had before the ndef read
+    struct TagAppsPrefetch {
+        std::vector<int> techList {};
+        std::vector<AppExecFwk::ElementName> apps {};
+        std::atomic<bool> isDone {false};
+    };
+
     std::shared_ptr<KITS::TagInfo> GetTagInfoFromTag(uint32_t rfDiscId);
     KITS::TagInfoParcelable* GetTagInfoParcelableFromTag(uint32_t rfDiscId);
     uint16_t HandleTagDispatch(std::string &ndefMsg, std::shared_ptr<KITS::NdefMessage> ndefMessage,
-        KITS::TagInfoParcelable* tagInfo, uint32_t tagDiscId, bool &isNtfPublished);
+        uint32_t tagDiscId, bool &isNtfPublished, TagFoundStages &stages);
+    bool IsLowLatencyReaderMode();
+    void HandleLowLatencyTagFound(uint32_t tagDiscId, TagFoundStages &stages);
+    void StartFieldOnChecking(uint32_t tagDiscId);
+    bool RunTagFoundTail(bool isVibratorAllowed, bool isNtfPublished, std::vector<int> techList);
+    bool PrefetchTagApps(const std::vector<int> &techList);
+    std::vector<AppExecFwk::ElementName> GetTagApps(const std::vector<int> &techList, bool &isPrefetched);
     bool IsAllowedVibrator(uint16_t dispatchResult);
     int GetFieldOnCheckInterval();
     void DispatchTag(uint32_t rfDiscId);
@@ -58,10 +84,11 @@ private:
     uint16_t PublishTagNotification(uint32_t tagDiscId, bool isIsoDep);
     void HandleNoHapSupportId();
     void HandleTextId();
-    void SendTagInfoToVendor(long tagFoundStartTime, long readFinishTime, long dispatchFinishTime,
-        std::shared_ptr<KITS::NdefMessage> ndefMessage, uint16_t dispatchResult);
+    void SendTagInfoToVendor(const TagFoundStages &stages, std::shared_ptr<KITS::NdefMessage> ndefMessage,
+        uint16_t dispatchResult);
     std::string ParseNdefInfo(std::shared_ptr<KITS::NdefMessage> ndefMessage);
-    void StartVibratorOnce(bool isNtfPublished = false);
+    uint16_t GetReaderModeTechMask();
+    bool IsReaderModeFlagSet(uint16_t flagMask);
     bool IsSkipNdefCheck();
 
 private:
@@ -80,6 +107,9 @@ private:
     std::shared_ptr<IsodepCardHandler> isodepCardHandler_ {};
 
     std::shared_ptr<KITS::TagInfo> tagInfo_ {};
+    // apps of tagInfo_, dispatched to when its notification is clicked
+    std::vector<AppExecFwk::ElementName> tagApps_ {};
+    std::shared_ptr<TagAppsPrefetch> tagAppsPrefetch_ {};
     bool ndefCbRes_ = false;
     bool isIsoDep_ = false;
     int fieldOnCheckInterval_ = 0;
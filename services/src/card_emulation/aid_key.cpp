@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "aid_key.h"
+
+#include <algorithm>
+#include "nfc_sdk_common.h"
+
+namespace OHOS {
+namespace NFC {
+static const size_t HEX_CHARS_PER_BYTE = 2;
+static const uint8_t HALF_BYTE_BITS = 4;
+static const uint8_t HEX_ALPHA_BASE = 10;
+static const int INVALID_NIBBLE = -1;
+
+static int HexCharToNibble(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + HEX_ALPHA_BASE;
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + HEX_ALPHA_BASE;
+    }
+    return INVALID_NIBBLE;
+}
+
+AidKey::AidKey(const uint8_t *aid, size_t len)
+{
+    if (aid == nullptr || len == 0 || len > MAX_AID_LEN) {
+        return;
+    }
+    std::copy(aid, aid + len, bytes_.begin());
+    len_ = static_cast<uint8_t>(len);
+}
+
+AidKey AidKey::FromHexString(const std::string &aid)
+{
+    AidKey key;
+    size_t len = aid.size() / HEX_CHARS_PER_BYTE;
+    if (aid.empty() || (aid.size() % HEX_CHARS_PER_BYTE) != 0 || len > MAX_AID_LEN) {
+        return key;
+    }
+    for (size_t i = 0; i < len; i++) {
+        int high = HexCharToNibble(aid[i * HEX_CHARS_PER_BYTE]);
+        int low = HexCharToNibble(aid[i * HEX_CHARS_PER_BYTE + 1]);
+        if (high == INVALID_NIBBLE || low == INVALID_NIBBLE) {
+            return AidKey();
+        }
+        key.bytes_[i] = static_cast<uint8_t>((high << HALF_BYTE_BITS) | low);
+    }
+    key.len_ = static_cast<uint8_t>(len);
+    return key;
+}
+
+std::string AidKey::ToHexString() const
+{
+    if (len_ == 0) {
+        return "";
+    }
+    return KITS::NfcSdkCommon::BytesVecToHexString(bytes_.data(), len_);
+}
+
+bool AidKey::operator==(const AidKey &other) const
+{
+    return len_ == other.len_ && std::equal(bytes_.begin(), bytes_.begin() + len_, other.bytes_.begin());
+}
+
+bool AidKey::operator<(const AidKey &other) const
+{
+    return std::lexicographical_compare(bytes_.begin(), bytes_.begin() + len_,
+        other.bytes_.begin(), other.bytes_.begin() + other.len_);
+}
+} // namespace NFC
+} // namespace OHOS
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AID_KEY_H
+#define AID_KEY_H
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace NFC {
+/**
+ * @brief The binary value of an AID in an inline buffer, the key of the AID lookups on the APDU path. Built from a
+ * SELECT without allocation, and from the hex string of an app declared AID when the app tables are published.
+ */
+class AidKey final {
+public:
+    static constexpr size_t MAX_AID_LEN = 16; // ISO/IEC 7816-4 and the NCI routing table limit an AID to 16 bytes
+
+    AidKey() = default;
+
+    /**
+     * @brief Build the key of an AID, the key is invalid if the length is 0 or over MAX_AID_LEN.
+     */
+    AidKey(const uint8_t *aid, size_t len);
+
+    /**
+     * @brief Build the key of a hex string AID, case insensitive. The key is invalid for an odd length, a non hex
+     * char or an AID over MAX_AID_LEN.
+     */
+    static AidKey FromHexString(const std::string &aid);
+
+    bool IsValid() const
+    {
+        return len_ != 0;
+    }
+    size_t GetLength() const
+    {
+        return len_;
+    }
+    const uint8_t *GetData() const
+    {
+        return bytes_.data();
+    }
+
+    // upper case, for the logs and the APIs still keyed by the hex string
+    std::string ToHexString() const;
+
+    bool operator==(const AidKey &other) const;
+    bool operator!=(const AidKey &other) const
+    {
+        return !(*this == other);
+    }
+    bool operator<(const AidKey &other) const;
+
+private:
+    uint8_t len_ = 0;
+    std::array<uint8_t, MAX_AID_LEN> bytes_ {};
+};
+} // namespace NFC
+} // namespace OHOS
+#endif // AID_KEY_H
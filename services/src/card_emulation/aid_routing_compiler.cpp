@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "aid_routing_compiler.h"
+
+#include <algorithm>
+#include <cctype>
+#include <vector>
+#include "loghelper.h"
+
+namespace OHOS {
+namespace NFC {
+static const uint32_t HEX_CHARS_PER_BYTE = 2;
+
+static std::string ToUpper(const std::string &str)
+{
+    std::string result = str;
+    std::transform(result.begin(), result.end(), result.begin(),
+        [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    return result;
+}
+
+uint32_t AidRoutingCompiler::GetEntrySize(const AidEntry &entry)
+{
+    return AID_ENTRY_HEADER_SIZE + static_cast<uint32_t>(entry.aid.size() / HEX_CHARS_PER_BYTE);
+}
+
+uint32_t AidRoutingCompiler::GetTableSize(const std::map<std::string, AidEntry> &entries)
+{
+    uint32_t size = 0;
+    for (const auto &pair : entries) {
+        size += GetEntrySize(pair.second);
+    }
+    return size;
+}
+
+AidRoutingCompiler::RoutingTableStats AidRoutingCompiler::Compile(
+    const std::map<std::string, AidEntry> &requested, uint32_t tableSize, int defaultAidRoute,
+    std::map<std::string, AidEntry> &compiled)
+{
+    RoutingTableStats stats;
+    stats.tableSize = tableSize;
+    stats.requestedCount = static_cast<uint32_t>(requested.size());
+    // keyed by the upper case AID, so the AIDs sharing a prefix are next to each other.
+    std::map<std::string, AidEntry> entries;
+    for (const auto &pair : requested) {
+        AidEntry entry = pair.second;
+        entry.aid = ToUpper(entry.aid);
+        entries[entry.aid] = entry;
+    }
+    if (tableSize > 0 && GetTableSize(entries) > tableSize) {
+        FoldPrefixEntries(entries, defaultAidRoute, stats);
+        if (GetTableSize(entries) > tableSize) {
+            DropEntries(entries, tableSize, stats);
+        }
+    }
+    stats.usedSize = GetTableSize(entries);
+    stats.entryCount = static_cast<uint32_t>(entries.size());
+    compiled = std::move(entries);
+    return stats;
+}
+
+void AidRoutingCompiler::FoldPrefixEntries(std::map<std::string, AidEntry> &entries, int defaultAidRoute,
+                                           RoutingTableStats &stats)
+{
+    for (auto iter = entries.begin(); iter != entries.end(); ++iter) {
+        // a prefix entry also takes the SELECT of the unregistered AIDs under it, which go to the default AID
+        // route without it. only fold the AIDs already on that route.
+        if (iter->second.route != defaultAidRoute) {
+            continue;
+        }
+        const std::string &prefix = iter->first;
+        auto rangeEnd = std::next(iter);
+        bool isSameRoute = true;
+        int priority = iter->second.priority;
+        while (rangeEnd != entries.end() && rangeEnd->first.compare(0, prefix.size(), prefix) == 0) {
+            // the prefix entry would take the SELECT of an AID routed elsewhere, keep them exact.
+            if (rangeEnd->second.route != iter->second.route || rangeEnd->second.power != iter->second.power) {
+                isSameRoute = false;
+                break;
+            }
+            priority = std::min(priority, rangeEnd->second.priority);
+            ++rangeEnd;
+        }
+        if (!isSameRoute || rangeEnd == std::next(iter)) {
+            continue;
+        }
+        uint32_t folded = static_cast<uint32_t>(std::distance(std::next(iter), rangeEnd));
+        InfoLog("FoldPrefixEntries: %{public}s folds %{public}u aids", prefix.c_str(), folded);
+        iter->second.aidInfo |= AID_INFO_PREFIX;
+        iter->second.priority = priority;
+        entries.erase(std::next(iter), rangeEnd);
+        stats.prefixCount++;
+        stats.foldedCount += folded;
+    }
+}
+
+void AidRoutingCompiler::DropEntries(std::map<std::string, AidEntry> &entries, uint32_t tableSize,
+                                     RoutingTableStats &stats)
+{
+    // drop the lowest priority first, then the largest entry, then by AID, the same AIDs on every compile.
+    std::vector<const AidEntry *> order;
+    order.reserve(entries.size());
+    for (const auto &pair : entries) {
+        order.push_back(&pair.second);
+    }
+    std::sort(order.begin(), order.end(), [](const AidEntry *a, const AidEntry *b) {
+        if (a->priority != b->priority) {
+            return a->priority > b->priority;
+        }
+        if (a->aid.size() != b->aid.size()) {
+            return a->aid.size() > b->aid.size();
+        }
+        return a->aid > b->aid;
+    });
+    uint32_t size = GetTableSize(entries);
+    std::vector<std::string> dropped;
+    for (const AidEntry *entry : order) {
+        if (size <= tableSize) {
+            break;
+        }
+        size -= GetEntrySize(*entry);
+        dropped.push_back(entry->aid);
+    }
+    for (const std::string &aid : dropped) {
+        WarnLog("DropEntries: routing table full, %{public}s left to the default route", aid.c_str());
+        entries.erase(aid);
+    }
+    stats.droppedCount = static_cast<uint32_t>(dropped.size());
+}
+} // namespace NFC
+} // namespace OHOS
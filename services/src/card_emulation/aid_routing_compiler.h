@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AID_ROUTING_COMPILER_H
+#define AID_ROUTING_COMPILER_H
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace OHOS {
+namespace NFC {
+/**
+ * @brief Compiles the requested AIDs into the entries of the listen mode routing table of the NFCC. When the
+ * exact entries overflow the table, the AIDs on the default AID route are folded into prefix entries, then the
+ * AIDs of the lowest priority are left to the default AID route.
+ * Only the AIDs on the default AID route are folded, a prefix entry takes the unregistered AIDs under it too. The
+ * AIDs there reach the same route without an entry, folding only keeps their power state, so it frees no
+ * meaningful space when the default AID route is off-host and the HCE AIDs are on the host, the overflow is then
+ * settled by leaving AIDs to the default AID route.
+ */
+class AidRoutingCompiler final {
+public:
+    // the AIDs of the foreground and the default payment apps are the last to be left to the default route.
+    enum AidPriority {
+        PRIORITY_FOREGROUND = 0,
+        PRIORITY_PAYMENT,
+        PRIORITY_OTHER,
+    };
+
+    static constexpr int AID_INFO_EXACT = 0x00;
+    static constexpr int AID_INFO_PREFIX = 0x10;
+    // type, length, route and power of an AID entry in RF_SET_LISTEN_MODE_ROUTING, before the AID itself.
+    static constexpr uint32_t AID_ENTRY_HEADER_SIZE = 4;
+
+    struct AidEntry {
+        std::string aid;
+        int route;
+        int aidInfo;
+        int power;
+        int priority = PRIORITY_OTHER; // not part of the routing table, not compared
+        bool operator==(const AidEntry &other) const
+        {
+            return aid == other.aid && route == other.route && aidInfo == other.aidInfo && power == other.power;
+        }
+    };
+
+    struct RoutingTableStats {
+        uint32_t tableSize = 0; // bytes for the AID entries, 0 if the NFCC doesn't report it
+        uint32_t usedSize = 0;
+        uint32_t requestedCount = 0;
+        uint32_t entryCount = 0;
+        uint32_t prefixCount = 0; // prefix entries folding longer AIDs
+        uint32_t foldedCount = 0; // AIDs covered by a prefix entry
+        uint32_t droppedCount = 0; // AIDs left to the default AID route
+    };
+
+    /**
+     * @brief Compile the requested AIDs for the table size.
+     * @param requested The requested AIDs, by AID.
+     * @param tableSize The bytes for the AID entries, 0 for no limit.
+     * @param defaultAidRoute The route of the AIDs not in the table, the only route folded into prefix entries.
+     * @param compiled The entries to add to the routing table, by AID.
+     * @return The utilization of the table.
+     */
+    static RoutingTableStats Compile(const std::map<std::string, AidEntry> &requested, uint32_t tableSize,
+                                     int defaultAidRoute, std::map<std::string, AidEntry> &compiled);
+    static uint32_t GetEntrySize(const AidEntry &entry);
+
+private:
+    static uint32_t GetTableSize(const std::map<std::string, AidEntry> &entries);
+    static void FoldPrefixEntries(std::map<std::string, AidEntry> &entries, int defaultAidRoute,
+                                  RoutingTableStats &stats);
+    static void DropEntries(std::map<std::string, AidEntry> &entries, uint32_t tableSize,
+                            RoutingTableStats &stats);
+};
+} // namespace NFC
+} // namespace OHOS
+#endif // AID_ROUTING_COMPILER_H
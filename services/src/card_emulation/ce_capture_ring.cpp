@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ce_capture_ring.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+namespace OHOS {
+namespace NFC {
+static const uint8_t INS_SELECT = 0xA4;
+static const uint8_t P1_SELECT_BY_NAME = 0x04;
+static const size_t INDEX_INS = 1;
+static const size_t INDEX_P1 = 2;
+static const size_t INDEX_LC = 4;
+static const size_t STATUS_WORD_LEN = 2;
+static const int HEX_BASE = 16;
+static const size_t HEX_CHARS_PER_BYTE = 2;
+static const char* const EMPTY_DATA = "-";
+static const char* const HEX_KEYS = "0123456789ABCDEF";
+static const uint8_t HALF_BYTE_BITS = 4;
+static const uint8_t HALF_BYTE_MASK = 0x0F;
+
+static uint64_t GetMonotonicTimeUs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// the hex helpers are local, the ring builds without the SDK for the host replay tool.
+static bool ParseByte(const std::string& str, uint8_t& value)
+{
+    char* end = nullptr;
+    unsigned long parsed = strtoul(str.c_str(), &end, HEX_BASE);
+    if (end == str.c_str() || *end != '\0' || parsed > UINT8_MAX) {
+        return false;
+    }
+    value = static_cast<uint8_t>(parsed);
+    return true;
+}
+
+static std::string BytesToHexString(const uint8_t* data, size_t len)
+{
+    std::string hex;
+    hex.reserve(len * HEX_CHARS_PER_BYTE);
+    for (size_t i = 0; i < len; i++) {
+        hex.push_back(HEX_KEYS[data[i] >> HALF_BYTE_BITS]);
+        hex.push_back(HEX_KEYS[data[i] & HALF_BYTE_MASK]);
+    }
+    return hex;
+}
+
+CeCaptureRing& CeCaptureRing::GetInstance()
+{
+    static CeCaptureRing instance;
+    return instance;
+}
+
+void CeCaptureRing::Record(uint8_t type)
+{
+    Append(type, 0, nullptr, 0);
+}
+
+void CeCaptureRing::RecordApdu(const std::vector<uint8_t>& apdu)
+{
+    size_t dataLen = std::min(apdu.size(), APDU_HEADER_LEN);
+    bool isSelectByName = apdu.size() > SELECT_HEADER_LEN && apdu[INDEX_INS] == INS_SELECT &&
+        apdu[INDEX_P1] == P1_SELECT_BY_NAME;
+    if (isSelectByName) {
+        // the AID routes the replayed session, the other commands keep their header only.
+        dataLen = std::min({apdu.size(), SELECT_HEADER_LEN + apdu[INDEX_LC], MAX_CAPTURE_LEN});
+    }
+    Append(EVENT_APDU, static_cast<uint32_t>(apdu.size()), apdu.data(), dataLen);
+}
+
+void CeCaptureRing::RecordResponse(const std::string& hexResp)
+{
+    uint32_t respLen = static_cast<uint32_t>((hexResp.size() + 1) / HEX_CHARS_PER_BYTE);
+    uint8_t statusWord[STATUS_WORD_LEN] = {0};
+    if (respLen < STATUS_WORD_LEN || (hexResp.size() % HEX_CHARS_PER_BYTE) != 0 ||
+        !ParseByte(hexResp.substr(hexResp.size() - STATUS_WORD_LEN * HEX_CHARS_PER_BYTE, HEX_CHARS_PER_BYTE),
+            statusWord[0]) ||
+        !ParseByte(hexResp.substr(hexResp.size() - HEX_CHARS_PER_BYTE), statusWord[1])) {
+        Append(EVENT_RESPONSE, respLen, nullptr, 0);
+        return;
+    }
+    Append(EVENT_RESPONSE, respLen, statusWord, STATUS_WORD_LEN);
+}
+
+void CeCaptureRing::Append(uint8_t type, uint32_t frameLen, const uint8_t* data, size_t dataLen)
+{
+    uint64_t timeUs = GetMonotonicTimeUs();
+    std::lock_guard<std::mutex> lock(mutex_);
+    CaptureRecord& record = records_[(nextSequence_ - 1) % CAPTURE_CAPACITY];
+    record.sequence = nextSequence_++;
+    record.timeUs = timeUs;
+    record.type = type;
+    record.frameLen = frameLen;
+    record.dataLen = 0;
+    if (data != nullptr) {
+        record.dataLen = static_cast<uint8_t>(std::min(dataLen, MAX_CAPTURE_LEN));
+        std::copy(data, data + record.dataLen, record.data);
+    }
+}
+
+std::vector<CeCaptureRing::CaptureRecord> CeCaptureRing::GetRecords(uint64_t sinceSequence, size_t maxCount) const
+{
+    std::vector<CeCaptureRing::CaptureRecord> records;
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t oldest = (nextSequence_ > CAPTURE_CAPACITY) ? (nextSequence_ - CAPTURE_CAPACITY) : 1;
+    uint64_t begin = std::max({sinceSequence + 1, oldest, clearSequence_});
+    if (begin >= nextSequence_) {
+        return records;
+    }
+    uint64_t end = std::min(nextSequence_, begin + maxCount);
+    records.reserve(end - begin);
+    for (uint64_t sequence = begin; sequence < end; sequence++) {
+        records.push_back(records_[(sequence - 1) % CAPTURE_CAPACITY]);
+    }
+    return records;
+}
+
+void CeCaptureRing::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    clearSequence_ = nextSequence_;
+}
+
+const char* CeCaptureRing::GetTypeName(uint8_t type)
+{
+    switch (type) {
+        case EVENT_FIELD_ON:
+            return "FIELD_ON";
+        case EVENT_FIELD_OFF:
+            return "FIELD_OFF";
+        case EVENT_ACTIVATED:
+            return "ACTIVATED";
+        case EVENT_DEACTIVATED:
+            return "DEACTIVATED";
+        case EVENT_APDU:
+            return "APDU";
+        case EVENT_RESPONSE:
+            return "RESPONSE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+std::string CeCaptureRing::FormatRecord(const CeCaptureRing::CaptureRecord& record)
+{
+    // <sequence> <time us> <type> <frame length> <captured bytes>, parsed back by ParseRecord.
+    std::string line = std::to_string(record.sequence) + " " + std::to_string(record.timeUs) + " " +
+        GetTypeName(record.type) + " " + std::to_string(record.frameLen) + " ";
+    if (record.dataLen == 0) {
+        return line + EMPTY_DATA;
+    }
+    return line + BytesToHexString(record.data, std::min<size_t>(record.dataLen, MAX_CAPTURE_LEN));
+}
+
+CeCaptureRing::CaptureRecord CeCaptureRing::MaskAid(const CeCaptureRing::CaptureRecord& record)
+{
+    CeCaptureRing::CaptureRecord masked = record;
+    if (masked.type == EVENT_APDU && masked.dataLen > SELECT_HEADER_LEN) {
+        // the frame length and the Lc still tell the length of the AID.
+        std::fill(masked.data + SELECT_HEADER_LEN, masked.data + MAX_CAPTURE_LEN, 0);
+        masked.dataLen = SELECT_HEADER_LEN;
+    }
+    return masked;
+}
+
+static bool ParseType(const std::string& name, uint8_t& type)
+{
+    for (uint8_t candidate = CeCaptureRing::EVENT_FIELD_ON; candidate <= CeCaptureRing::EVENT_RESPONSE;
+        candidate++) {
+        if (name == CeCaptureRing::GetTypeName(candidate)) {
+            type = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CeCaptureRing::ParseRecord(const std::string& line, CeCaptureRing::CaptureRecord& record)
+{
+    std::istringstream stream(line);
+    std::string typeName;
+    std::string data;
+    CeCaptureRing::CaptureRecord parsed;
+    if (!(stream >> parsed.sequence >> parsed.timeUs >> typeName >> parsed.frameLen >> data)) {
+        return false;
+    }
+    if (!ParseType(typeName, parsed.type)) {
+        return false;
+    }
+    if (data != EMPTY_DATA) {
+        if ((data.size() % HEX_CHARS_PER_BYTE) != 0 || data.size() > MAX_CAPTURE_LEN * HEX_CHARS_PER_BYTE) {
+            return false;
+        }
+        for (size_t i = 0; i < data.size(); i += HEX_CHARS_PER_BYTE) {
+            if (!ParseByte(data.substr(i, HEX_CHARS_PER_BYTE), parsed.data[parsed.dataLen])) {
+                return false;
+            }
+            parsed.dataLen++;
+        }
+    }
+    record = parsed;
+    return true;
+}
+
+std::vector<uint8_t> CeCaptureRing::BuildFrame(const CeCaptureRing::CaptureRecord& record)
+{
+    size_t dataLen = std::min<size_t>(record.dataLen, MAX_CAPTURE_LEN);
+    std::vector<uint8_t> frame(std::max<size_t>(record.frameLen, dataLen), 0);
+    std::copy(record.data, record.data + dataLen, frame.begin());
+    return frame;
+}
+
+void CeCaptureRing::Dump(int fd) const
+{
+    std::vector<CeCaptureRing::CaptureRecord> records = GetRecords(0, CAPTURE_CAPACITY);
+    uint64_t total = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        total = nextSequence_ - 1;
+    }
+    dprintf(fd, "CE capture:\n");
+    dprintf(fd, "  total: %" PRIu64 ", kept: %zu, capacity: %zu\n", total, records.size(), CAPTURE_CAPACITY);
+    // the dump is readable without the card emulation permission, the AIDs are left out of it.
+    for (const CeCaptureRing::CaptureRecord& record : records) {
+        dprintf(fd, "  %s\n", FormatRecord(MaskAid(record)).c_str());
+    }
+}
+} // namespace NFC
+} // namespace OHOS
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CE_CAPTURE_RING_H
+#define CE_CAPTURE_RING_H
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace NFC {
+/**
+ * @brief Captures the RF events and the frames of the card emulation sessions in a fixed size ring, so the
+ * interactions with a slow terminal can be read through IHceSession or the dump, and replayed against CeService
+ * by tools/ce_capture_replay. Only the APDU headers, the AIDs of the SELECTs and the status words are kept, the
+ * dump leaves the AIDs out.
+ */
+class CeCaptureRing final {
+public:
+    enum EventType : uint8_t {
+        EVENT_FIELD_ON = 1,
+        EVENT_FIELD_OFF,
+        EVENT_ACTIVATED,
+        EVENT_DEACTIVATED,
+        EVENT_APDU,
+        EVENT_RESPONSE,
+    };
+
+    static constexpr size_t APDU_HEADER_LEN = 4; // CLA INS P1 P2
+    static constexpr size_t SELECT_HEADER_LEN = 5; // CLA INS P1 P2 Lc
+    static constexpr size_t MAX_AID_LEN = 16;
+    static constexpr size_t MAX_CAPTURE_LEN = SELECT_HEADER_LEN + MAX_AID_LEN;
+    static constexpr size_t CAPTURE_CAPACITY = 512;
+
+    struct CaptureRecord {
+        uint64_t sequence = 0; // from 1, increasing, a gap means the records in between were overwritten
+        uint64_t timeUs = 0; // monotonic
+        uint8_t type = 0;
+        uint32_t frameLen = 0; // of the whole frame
+        uint8_t dataLen = 0;
+        uint8_t data[MAX_CAPTURE_LEN] = {0};
+    };
+
+    static CeCaptureRing& GetInstance();
+
+    void Record(uint8_t type);
+    void RecordApdu(const std::vector<uint8_t>& apdu);
+    void RecordResponse(const std::string& hexResp);
+
+    /**
+     * @brief Get the records after a sequence, from the oldest to the newest.
+     * @param sinceSequence The last sequence the caller got, 0 for all the records.
+     * @param maxCount The most records to get.
+     */
+    std::vector<CeCaptureRing::CaptureRecord> GetRecords(uint64_t sinceSequence, size_t maxCount) const;
+    void Clear();
+    void Dump(int fd) const;
+
+    static std::string FormatRecord(const CeCaptureRing::CaptureRecord& record);
+    static bool ParseRecord(const std::string& line, CeCaptureRing::CaptureRecord& record);
+    static const char* GetTypeName(uint8_t type);
+
+    /**
+     * @brief Get a copy of the record without the AID of a SELECT by name, keeping its header.
+     */
+    static CeCaptureRing::CaptureRecord MaskAid(const CeCaptureRing::CaptureRecord& record);
+
+    /**
+     * @brief Rebuild a command of the length of the captured APDU, the bytes not captured are 0.
+     */
+    static std::vector<uint8_t> BuildFrame(const CeCaptureRing::CaptureRecord& record);
+
+private:
+    CeCaptureRing() = default;
+    ~CeCaptureRing() = default;
+
+    void Append(uint8_t type, uint32_t frameLen, const uint8_t* data, size_t dataLen);
+
+    mutable std::mutex mutex_ {};
+    uint64_t nextSequence_ = 1;
+    uint64_t clearSequence_ = 1; // the records before it are cleared
+    std::array<CaptureRecord, CAPTURE_CAPACITY> records_ {};
+};
+} // namespace NFC
+} // namespace OHOS
+#endif // CE_CAPTURE_RING_H
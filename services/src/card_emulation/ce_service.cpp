@@ -13,6 +13,9 @@
  * limitations under the License.
  */
 #include "ce_service.h"
+#include <cstdio>
+#include <iterator>
+#include "ce_capture_ring.h"
 #include "nfc_event_publisher.h"
 #include "nfc_event_handler.h"
 #include "external_deps_proxy.h"
@@ -116,20 +119,29 @@ bool CeService::InitConfigAidRouting(bool forceUpdate)
 {
     DebugLog("AddAidRoutingHceAids: start, forceUpdate is %{public}d", forceUpdate);
     std::lock_guard<std::mutex> lock(configRoutingMutex_);
+    auto nciCeProxyPtr = nciCeProxy_.lock();
+    if (nciCeProxyPtr == nullptr) {
+        ErrorLog("InitConfigAidRouting: nciCeProxy_ is nullptr.");
+        return false;
+    }
+    std::map<std::string, AidEntry> requestedEntries;
+    BuildAidEntries(requestedEntries);
     std::map<std::string, AidEntry> aidEntries;
-    BuildAidEntries(aidEntries);
+    int defaultAidRoute = nciCeProxyPtr->GetDefaultAidRoute(static_cast<int>(defaultPaymentType_));
+    AidRoutingCompiler::RoutingTableStats stats = AidRoutingCompiler::Compile(requestedEntries,
+        nciCeProxyPtr->GetAidRoutingTableSize(), defaultAidRoute, aidEntries);
     InfoLog("AddAidRoutingHceAids, aid entries cache size %{public}zu,aid entries newly builded size %{public}zu",
             aidToAidEntry_.size(), aidEntries.size());
     if (aidEntries == aidToAidEntry_ && !forceUpdate) {
         InfoLog("aid entries do not change.");
         return false;
     }
-
-    auto nciCeProxyPtr = nciCeProxy_.lock();
-    if (nciCeProxyPtr == nullptr) {
-        ErrorLog("InitConfigAidRouting: nciCeProxy_ is nullptr.");
-        return false;
-    }
+    routingTableStats_ = stats;
+    InfoLog("InitConfigAidRouting: table %{public}u/%{public}u bytes, requested %{public}u, entries %{public}u, "
+        "prefix %{public}u, dropped %{public}u", stats.usedSize, stats.tableSize, stats.requestedCount,
+        stats.entryCount, stats.prefixCount, stats.droppedCount);
+    ExternalDepsProxy::GetInstance().WriteAidRoutingTableHiSysEvent(stats.tableSize, stats.usedSize,
+        stats.requestedCount, stats.prefixCount, stats.droppedCount);
     nciCeProxyPtr->ClearAidTable();
     aidToAidEntry_.clear();
     bool addAllResult = true;
@@ -188,6 +200,8 @@ void CeService::BuildAidEntries(std::map<std::string, AidEntry> &aidEntries)
                            appAidInfo.element.GetAbilityName() == foregroundElement_.GetAbilityName();
         bool isDefaultPayment = appAidInfo.element.GetBundleName() == defaultPaymentElement_.GetBundleName() &&
                                 appAidInfo.element.GetAbilityName() == defaultPaymentElement_.GetAbilityName();
+        int priority = isForeground ? AidRoutingCompiler::PRIORITY_FOREGROUND :
+            (isDefaultPayment ? AidRoutingCompiler::PRIORITY_PAYMENT : AidRoutingCompiler::PRIORITY_OTHER);
         for (const AppDataParser::AidInfo &aidInfo : appAidInfo.customDataAid) {
             // add payment aid of default payment app and foreground app
             // add other aid of all apps
@@ -198,6 +212,7 @@ void CeService::BuildAidEntries(std::map<std::string, AidEntry> &aidEntries)
                 aidEntry.aidInfo = 0;
                 aidEntry.power = DEFAULT_PWR_STA_HOST;
                 aidEntry.route = DEFAULT_HOST_ROUTE_DEST;
+                aidEntry.priority = priority;
                 aidEntries[aidInfo.value] = aidEntry;
             }
         }
@@ -208,6 +223,7 @@ void CeService::BuildAidEntries(std::map<std::string, AidEntry> &aidEntries)
         aidEntry.aidInfo = 0;
         aidEntry.power = DEFAULT_PWR_STA_HOST;
         aidEntry.route = DEFAULT_HOST_ROUTE_DEST;
+        aidEntry.priority = AidRoutingCompiler::PRIORITY_FOREGROUND;
         aidEntries[aid] = aidEntry;
     }
 }
@@ -219,9 +235,9 @@ void CeService::ClearAidEntriesCache()
     DebugLog("ClearAidEntriesCache end");
 }
 
-bool CeService::IsDynamicAid(const std::string &targetAid)
+bool CeService::IsDynamicAid(const AidKey &targetAid)
 {
-    for (const std::string &aid : dynamicAids_) {
+    for (const AidKey &aid : dynamicAidKeys_) {
         if (aid == targetAid) {
             return true;
         }
@@ -414,6 +430,15 @@ void CeService::SearchElementByAid(const std::string &aid, ElementName &aidEleme
         InfoLog("The length of aid is out of MAX_AID_LENGTH.aid.size is: %{public}lu", aid.size());
         return;
     }
+    SearchElementByAid(AidKey::FromHexString(aid), aidElement);
+}
+
+void CeService::SearchElementByAid(const AidKey &aid, ElementName &aidElement)
+{
+    if (!aid.IsValid()) {
+        InfoLog("aid is invalid");
+        return;
+    }
     // find dynamic aid
     if (IsDynamicAid(aid) && !foregroundElement_.GetBundleName().empty()) {
         InfoLog("is foreground element");
@@ -421,22 +446,24 @@ void CeService::SearchElementByAid(const std::string &aid, ElementName &aidEleme
         aidElement.SetAbilityName(foregroundElement_.GetAbilityName());
         return;
     }
-    std::vector<AppDataParser::HceAppAidInfo> hceApps;
-    ExternalDepsProxy::GetInstance().GetHceAppsByAid(aid, hceApps);
-    if (hceApps.empty()) {
+    std::shared_ptr<const AppDataParser::AppTables> tables = ExternalDepsProxy::GetInstance().GetAppTables();
+    auto range = tables->FindHceApps(aid);
+    if (range.first == range.second) {
         InfoLog("No applications found");
         return;
     }
     // only one element, resolved
-    if (hceApps.size() == 1) {
-        ElementName element = hceApps[0].element;
+    if (std::next(range.first) == range.second) {
+        const ElementName &element = tables->hceApps[range.first->hceAppIndex].element;
         aidElement.SetBundleName(element.GetBundleName());
         aidElement.SetAbilityName(element.GetAbilityName());
         return;
     }
     InfoLog("Found too many applications");
-    for (const AppDataParser::HceAppAidInfo &hceApp : hceApps) {
-        ElementName elementName = hceApp.element;
+    std::vector<AppDataParser::HceAppAidInfo> hceApps;
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        const AppDataParser::HceAppAidInfo &hceApp = tables->hceApps[iter->hceAppIndex];
+        const ElementName &elementName = hceApp.element;
         InfoLog("BundleName: %{public}s", elementName.GetBundleName().c_str());
         InfoLog("AbilityName: %{public}s", elementName.GetAbilityName().c_str());
         InfoLog("appIndex: %{public}d", hceApp.appIndex);
@@ -458,6 +485,7 @@ void CeService::SearchElementByAid(const std::string &aid, ElementName &aidEleme
             aidElement.SetAbilityName(elementName.GetAbilityName());
             return;
         }
+        hceApps.push_back(hceApp);
     }
     
     HandleOtherAidConflicted(hceApps);
@@ -486,10 +514,10 @@ bool CeService::UpdateDefaultPaymentType()
     return true;
 }
 
-bool CeService::IsPaymentAid(const std::string &aid, const AppDataParser::HceAppAidInfo &hceApp)
+bool CeService::IsPaymentAid(const AidKey &aid, const AppDataParser::HceAppAidInfo &hceApp)
 {
     for (const AppDataParser::AidInfo &aidInfo : hceApp.customDataAid) {
-        if (KITS::KEY_PAYMENT_AID == aidInfo.name && aid == aidInfo.value) {
+        if (KITS::KEY_PAYMENT_AID == aidInfo.name && aid == AidKey::FromHexString(aidInfo.value)) {
             return true;
         }
     }
@@ -543,6 +571,7 @@ void CeService::HandleFieldDeactivated()
 }
 void CeService::OnCardEmulationData(const std::vector<uint8_t> &data)
 {
+    CeCaptureRing::GetInstance().RecordApdu(data);
     if (hostCardEmulationManager_ == nullptr) {
         ErrorLog("hce is null");
         return;
@@ -551,6 +580,7 @@ void CeService::OnCardEmulationData(const std::vector<uint8_t> &data)
 }
 void CeService::OnCardEmulationActivated()
 {
+    CeCaptureRing::GetInstance().Record(CeCaptureRing::EVENT_ACTIVATED);
     if (hostCardEmulationManager_ == nullptr) {
         ErrorLog("hce is null");
         return;
@@ -559,6 +589,7 @@ void CeService::OnCardEmulationActivated()
 }
 void CeService::OnCardEmulationDeactivated()
 {
+    CeCaptureRing::GetInstance().Record(CeCaptureRing::EVENT_DEACTIVATED);
     if (hostCardEmulationManager_ == nullptr) {
         ErrorLog("hce is null");
         return;
@@ -636,6 +667,7 @@ void CeService::Deinitialize()
     defaultPaymentElement_.SetModuleName("");
     initDefaultPaymentAppDone_ = false;
     dynamicAids_.clear();
+    dynamicAidKeys_.clear();
     Uri nfcDefaultPaymentApp(KITS::NFC_DATA_URI_PAYMENT_DEFAULT_APP);
     DelayedSingleton<SettingDataShareImpl>::GetInstance()->ReleaseDataObserver(nfcDefaultPaymentApp,
                                                                                dataRdbObserver_);
@@ -667,6 +699,10 @@ void CeService::SetHceInfo(const ElementName &element, const std::vector<std::st
     ExternalDepsProxy::GetInstance().WriteForegroundAppChangeHiSysEvent(foregroundElement_.GetBundleName());
     dynamicAids_.clear();
     dynamicAids_ = std::move(aids);
+    dynamicAidKeys_.clear();
+    for (const std::string &aid : dynamicAids_) {
+        dynamicAidKeys_.push_back(AidKey::FromHexString(aid));
+    }
 }
 
 void CeService::ClearHceInfo()
@@ -679,6 +715,7 @@ void CeService::ClearHceInfo()
     foregroundElement_.SetModuleName("");
     ExternalDepsProxy::GetInstance().WriteForegroundAppChangeHiSysEvent(foregroundElement_.GetBundleName());
     dynamicAids_.clear();
+    dynamicAidKeys_.clear();
 }
 
 bool CeService::StopHce(const ElementName &element, Security::AccessToken::AccessTokenID callerToken)
@@ -745,5 +782,26 @@ void CeService::HandleDataShareReady()
         ConfigRoutingAndCommit();
     }
 }
+
+void CeService::Dump(int fd)
+{
+    {
+        std::lock_guard<std::mutex> lock(configRoutingMutex_);
+        const AidRoutingCompiler::RoutingTableStats &stats = routingTableStats_;
+        dprintf(fd, "AID routing table:\n");
+        dprintf(fd, "  used %u of %u bytes, requested %u aids, %u entries, %u prefix entries folding %u aids, "
+            "%u aids left to the default route\n", stats.usedSize, stats.tableSize, stats.requestedCount,
+            stats.entryCount, stats.prefixCount, stats.foldedCount, stats.droppedCount);
+        for (const auto &pair : aidToAidEntry_) {
+            const AidEntry &entry = pair.second;
+            dprintf(fd, "  %s%s route 0x%02X power 0x%02X\n", entry.aid.c_str(),
+                (entry.aidInfo & AidRoutingCompiler::AID_INFO_PREFIX) ? "*" : "", entry.route, entry.power);
+        }
+    }
+    if (hostCardEmulationManager_ != nullptr) {
+        hostCardEmulationManager_->Dump(fd);
+    }
+    CeCaptureRing::GetInstance().Dump(fd);
+}
 } // namespace NFC
 } // namespace OHOS
\ No newline at end of file
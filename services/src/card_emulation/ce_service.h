@@ -14,6 +14,8 @@
  */
 #ifndef CE_SERVICE_H
 #define CE_SERVICE_H
+#include "aid_key.h"
+#include "aid_routing_compiler.h"
 #include "nfc_service.h"
 #include "host_card_emulation_manager.h"
 #include "inci_ce_interface.h"
@@ -36,16 +38,7 @@ class CeService : public IDefaultPaymentServiceChangeCallback,
                   public std::enable_shared_from_this<CeService>,
                   public INfcAppStateObserver {
 public:
-    struct AidEntry {
-        std::string aid;
-        int route;
-        int aidInfo;
-        int power;
-        bool operator==(const AidEntry &other) const
-        {
-            return aid == other.aid && route == other.route && aidInfo == other.aidInfo && power == other.power;
-        }
-    };
+    using AidEntry = AidRoutingCompiler::AidEntry;
 
     explicit CeService(std::weak_ptr<NfcService> nfcService, std::weak_ptr<NCI::INciCeInterface> nciCeProxy);
     ~CeService();
@@ -79,18 +72,20 @@ public:
    
     void ConfigRoutingAndCommit();
     void SearchElementByAid(const std::string &aid, ElementName &aidElement);
+    void SearchElementByAid(const AidKey &aid, ElementName &aidElement);
     KITS::DefaultPaymentType GetDefaultPaymentType();
 
     void HandleAppStateChanged(const std::string &bundleName, const std::string &abilityName,
                                int abilityState) override;
 
     void HandleDataShareReady();
+    void Dump(int fd);
 
 private:
     void BuildAidEntries(std::map<std::string, AidEntry> &aidEntries);
     void ClearAidEntriesCache();
-    bool IsDynamicAid(const std::string &targetAid);
-    bool IsPaymentAid(const std::string &aid, const AppDataParser::HceAppAidInfo &hceApp);
+    bool IsDynamicAid(const AidKey &targetAid);
+    bool IsPaymentAid(const AidKey &aid, const AppDataParser::HceAppAidInfo &hceApp);
     void SetHceInfo(const ElementName &element, const std::vector<std::string> &aids);
     void ClearHceInfo();
     bool AppEventCheckValid(std::shared_ptr<EventFwk::CommonEventData> data);
@@ -117,9 +112,11 @@ private:
 
     ElementName foregroundElement_ {};
     std::vector<std::string> dynamicAids_ {};
+    std::vector<AidKey> dynamicAidKeys_ {}; // the binary keys of dynamicAids_, for the APDU path
 
     std::mutex configRoutingMutex_ {};
     std::map<std::string, AidEntry> aidToAidEntry_{};
+    AidRoutingCompiler::RoutingTableStats routingTableStats_ {};
     std::shared_ptr<AppStateObserver> appStateObserver_;
 };
 } // namespace NFC
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hce_apdu_queue.h"
+
+#include <algorithm>
+#include "loghelper.h"
+
+namespace OHOS {
+namespace NFC {
+bool HceApduQueue::Push(const std::vector<uint8_t>& apdu, Clock::time_point now)
+{
+    if (apdu.empty()) {
+        return false;
+    }
+    if (apdus_.size() >= MAX_APDU_COUNT || bytes_ + apdu.size() > MAX_APDU_BYTES) {
+        stats_.droppedCount++;
+        WarnLog("HceApduQueue: full with %{public}zu apdus of %{public}zu bytes, drop %{public}zu bytes",
+            apdus_.size(), bytes_, apdu.size());
+        return false;
+    }
+    apdus_.push_back({apdu, now});
+    bytes_ += apdu.size();
+    stats_.queuedCount++;
+    return true;
+}
+
+std::vector<std::vector<uint8_t>> HceApduQueue::Release(Clock::time_point now)
+{
+    std::vector<std::vector<uint8_t>> apdus;
+    if (apdus_.empty()) {
+        return apdus;
+    }
+    uint64_t waitMs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - apdus_.front().arrivalTime).count());
+    stats_.releaseCount++;
+    stats_.releasedCount += apdus_.size();
+    stats_.lastWaitMs = waitMs;
+    stats_.maxWaitMs = std::max(stats_.maxWaitMs, waitMs);
+    stats_.totalWaitMs += waitMs;
+    if (waitMs > SLOW_WAIT_MS) {
+        stats_.slowReleaseCount++;
+        WarnLog("HceApduQueue: %{public}zu apdus waited %{public}llu ms for the service", apdus_.size(),
+            static_cast<unsigned long long>(waitMs));
+    } else {
+        InfoLog("HceApduQueue: %{public}zu apdus waited %{public}llu ms for the service", apdus_.size(),
+            static_cast<unsigned long long>(waitMs));
+    }
+    apdus.reserve(apdus_.size());
+    for (QueuedApdu& apdu : apdus_) {
+        apdus.push_back(std::move(apdu.data));
+    }
+    Clear();
+    return apdus;
+}
+
+void HceApduQueue::Clear()
+{
+    apdus_.clear();
+    bytes_ = 0;
+}
+
+bool HceApduQueue::IsEmpty() const
+{
+    return apdus_.empty();
+}
+
+size_t HceApduQueue::GetCount() const
+{
+    return apdus_.size();
+}
+
+size_t HceApduQueue::GetBytes() const
+{
+    return bytes_;
+}
+
+const HceApduQueue::QueueStats& HceApduQueue::GetStats() const
+{
+    return stats_;
+}
+} // namespace NFC
+} // namespace OHOS
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HCE_APDU_QUEUE_H
+#define HCE_APDU_QUEUE_H
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace OHOS {
+namespace NFC {
+/**
+ * @brief The APDUs received while the HCE service binds, released in the arrival order once the service can take
+ * them. Bounded by count and bytes, the APDUs over the bounds are dropped, the earlier ones (the SELECT) are kept.
+ * Not thread safe, guarded by the lock of the owner.
+ */
+class HceApduQueue final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t MAX_APDU_COUNT = 8;
+    static constexpr size_t MAX_APDU_BYTES = 8192;
+    // a reader usually gives up a command it waited for longer, the release warns about it.
+    static constexpr uint64_t SLOW_WAIT_MS = 1000;
+
+    struct QueueStats {
+        uint64_t queuedCount = 0;
+        uint64_t droppedCount = 0; // over the count or the bytes bound
+        uint64_t releaseCount = 0; // transactions released to a service
+        uint64_t releasedCount = 0; // APDUs released to a service
+        uint64_t slowReleaseCount = 0; // releases whose oldest APDU waited over SLOW_WAIT_MS
+        uint64_t lastWaitMs = 0; // wait of the oldest APDU of the last release
+        uint64_t maxWaitMs = 0;
+        uint64_t totalWaitMs = 0;
+    };
+
+    /**
+     * @brief Queue an APDU stamped with its arrival time.
+     * @return false if it's dropped for the bounds.
+     */
+    bool Push(const std::vector<uint8_t>& apdu, Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Take all the APDUs in the arrival order, and record how long the transaction waited for the service.
+     */
+    std::vector<std::vector<uint8_t>> Release(Clock::time_point now = Clock::now());
+
+    void Clear();
+    bool IsEmpty() const;
+    size_t GetCount() const;
+    size_t GetBytes() const;
+    const QueueStats& GetStats() const;
+
+private:
+    struct QueuedApdu {
+        std::vector<uint8_t> data;
+        Clock::time_point arrivalTime;
+    };
+
+    std::deque<QueuedApdu> apdus_ {};
+    size_t bytes_ = 0;
+    QueueStats stats_ {};
+};
+} // namespace NFC
+} // namespace OHOS
+#endif // HCE_APDU_QUEUE_H
@@ -13,8 +13,11 @@
  * limitations under the License.
  */
 
+#include <cstdio>
+
 #include "loghelper.h"
 #include "app_data_parser.h"
+#include "ce_capture_ring.h"
 #include "external_deps_proxy.h"
 #include "host_card_emulation_manager.h"
 #include "ability_manager_client.h"
@@ -25,6 +28,7 @@
 #include "iservice_registry.h"
 #include "system_ability_definition.h"
 #include "nfc_ability_connection_callback.h"
+#include "nfc_bundle_mgr_client.h"
 #include "ability_info.h"
 
 namespace OHOS {
@@ -47,7 +51,13 @@ const uint32_t INDEX_P1 = 2;
 const uint32_t INDEX_3 = 3;
 const uint32_t INDEX_AID_LEN = 4;
 const int32_t USERID = 100;
-const int MAX_AID_LENGTH = 128;
+
+static bool IsSelectApdu(const std::vector<uint8_t>& data)
+{
+    return data.size() > INDEX_P1 && data[INDEX_CLASS_BYTE] == SELECT_00 &&
+        data[INDEX_CHAIN_INSTRUCTION] == INSTR_SELECT && data[INDEX_P1] == SELECT_P1;
+}
+
 using OHOS::AppExecFwk::ElementName;
 HostCardEmulationManager::HostCardEmulationManager(std::weak_ptr<NfcService> nfcService,
                                                    std::weak_ptr<NCI::INciCeInterface> nciCeProxy,
@@ -55,7 +65,7 @@ HostCardEmulationManager::HostCardEmulationManager(std::weak_ptr<NfcService> nfc
     : nfcService_(nfcService), nciCeProxy_(nciCeProxy), ceService_(ceService)
 {
     hceState_ = HostCardEmulationManager::INITIAL_STATE;
-    queueHceData_.clear();
+    queueHceData_.Clear();
     abilityConnection_ = new (std::nothrow) NfcAbilityConnectionCallback();
 }
 HostCardEmulationManager::~HostCardEmulationManager()
@@ -65,41 +75,21 @@ HostCardEmulationManager::~HostCardEmulationManager()
     std::lock_guard<std::mutex> lock(hceStateMutex_);
     std::lock_guard<std::mutex> lockRegInfo(regInfoMutex_);
     hceState_ = HostCardEmulationManager::INITIAL_STATE;
-    queueHceData_.clear();
+    queueHceData_.Clear();
     abilityConnection_ = nullptr;
     bundleNameToHceCmdRegData_.clear();
 }
 
 sptr<AppExecFwk::IBundleMgr> HostCardEmulationManager::NfcGetBundleMgrProxy()
 {
-    sptr<ISystemAbilityManager> systemAbilityManager =
-        SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (!systemAbilityManager) {
-        ErrorLog("NfcGetBundleMgrProxy, systemAbilityManager is null");
-        return nullptr;
-    }
-    sptr<IRemoteObject> remoteObject = systemAbilityManager->GetSystemAbility(BUNDLE_MGR_SERVICE_SYS_ABILITY_ID);
-    if (!remoteObject) {
-        ErrorLog("NfcGetBundleMgrProxy, remoteObject is null");
-        return nullptr;
-    }
-    return iface_cast<AppExecFwk::IBundleMgr>(remoteObject);
+    return NfcBundleMgrClient::GetInstance().GetBundleMgrProxy();
 }
 
 bool HostCardEmulationManager::IsFaModeApplication(ElementName& elementName)
 {
-    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = NfcGetBundleMgrProxy();
-    if (bundleMgrProxy == nullptr) {
-        ErrorLog("IsFaModeApplication, bundleMgrProxy is nullptr.");
-        return false;
-    }
-
-    constexpr auto flag = AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_DEFAULT;
+    // the ability info is memoized by the shared client, the query is not sent per apdu.
     AppExecFwk::AbilityInfo hceAbilityInfo;
-    AAFwk::Want want;
-    want.SetElement(elementName);
-
-    if (!bundleMgrProxy->QueryAbilityInfo(want, flag, USERID, hceAbilityInfo)) {
+    if (!NfcBundleMgrClient::GetInstance().QueryAbilityInfo(elementName, USERID, hceAbilityInfo)) {
         ErrorLog("IsFaModeApplication QueryAbilityInfo fail!");
         return false;
     }
@@ -114,64 +104,86 @@ bool HostCardEmulationManager::IsFaModeApplication(ElementName& elementName)
 /* Handle received APDU data for FA Model Application */
 void HostCardEmulationManager::HandleDataForFaApplication(const std::string& aid,
     ElementName& aidElement, const std::vector<uint8_t>& data)
+{
+    HceAction action;
+    {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        action = GetActionForFaApplication(aid, aidElement, data);
+    }
+    RunHceAction(action, data);
+}
+
+HostCardEmulationManager::HceAction HostCardEmulationManager::GetActionForFaApplication(const std::string& aid,
+    ElementName& aidElement, const std::vector<uint8_t>& data)
 {
     InfoLog("HandleDataForFaApplication hce state is %{public}d.", hceState_);
     switch (hceState_) {
         case HostCardEmulationManager::INITIAL_STATE: {
             InfoLog("got data on state fa INITIAL_STATE");
-            return;
+            return HceAction();
         }
         case HostCardEmulationManager::WAIT_FOR_SELECT: {
             InfoLog("got data on state fa WAIT_FOR_SELECT");
-            HandleDataOnW4SelectForFa(aid, aidElement, data);
-            break;
+            return HandleDataOnW4SelectForFa(aid, aidElement, data);
         }
         case HostCardEmulationManager::WAIT_FOR_SERVICE: {
-            InfoLog("got data on state fa w4 service");
-            return;
+            InfoLog("got data on state fa w4 service, queue it");
+            queueHceData_.Push(data);
+            return HceAction();
         }
         case HostCardEmulationManager::DATA_TRANSFER: {
             InfoLog("got data on state fa DATA_TRANSFER");
-            HandleDataOnDataTransferForFa(aid, aidElement, data);
-            break;
+            return HandleDataOnDataTransferForFa(aid, aidElement, data);
         }
         case HostCardEmulationManager::WAIT_FOR_DEACTIVATE: {
             InfoLog("got data on state fa w4 deactivate");
-            return;
+            return HceAction();
         }
         default: break;
     }
+    return HceAction();
 }
 /* Handle received APDU data for Stage Model Application */
 void HostCardEmulationManager::HandleDataForStageApplication(const std::string& aid,
     ElementName& aidElement, const std::vector<uint8_t>& data)
+{
+    HceAction action;
+    {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        action = GetActionForStageApplication(aid, aidElement, data);
+    }
+    RunHceAction(action, data);
+}
+
+HostCardEmulationManager::HceAction HostCardEmulationManager::GetActionForStageApplication(
+    const std::string& aid, ElementName& aidElement, const std::vector<uint8_t>& data)
 {
     InfoLog("HandleDataForStageApplication hce state is %{public}d.", hceState_);
     switch (hceState_) {
         case HostCardEmulationManager::INITIAL_STATE: {
             InfoLog("got data on state stage INITIAL_STATE");
-            return;
+            return HceAction();
         }
         case HostCardEmulationManager::WAIT_FOR_SELECT: {
             InfoLog("got data on state stage WAIT_FOR_SELECT");
-            HandleDataOnW4Select(aid, aidElement, data);
-            break;
+            return HandleDataOnW4Select(aid, aidElement, data);
         }
         case HostCardEmulationManager::WAIT_FOR_SERVICE: {
-            InfoLog("got data on state stage w4 service");
-            return;
+            InfoLog("got data on state stage w4 service, queue it");
+            queueHceData_.Push(data);
+            return HceAction();
         }
         case HostCardEmulationManager::DATA_TRANSFER: {
             InfoLog("got data on state stage DATA_TRANSFER");
-            HandleDataOnDataTransfer(aid, aidElement, data);
-            break;
+            return HandleDataOnDataTransfer(aid, aidElement, data);
         }
         case HostCardEmulationManager::WAIT_FOR_DEACTIVATE: {
             InfoLog("got data on state stage w4 deactivate");
-            return;
+            return HceAction();
         }
         default: break;
     }
+    return HceAction();
 }
 
 #ifdef VENDOR_APPLICATIONS_ENABLED
@@ -245,23 +257,32 @@ bool HostCardEmulationManager::ShouldVendorHandleHce(const std::string &aid, con
 
 bool HostCardEmulationManager::IsVendorHandleHce(const std::string &aid)
 {
-    std::lock_guard<std::mutex> lock(hceStateMutex_);
-    if (!aid.empty()) {
-        shouldVendorHandleHce_ = ShouldVendorHandleHce(aid, aidElement_);
-        InfoLog("vendor handle hce: %{public}d", shouldVendorHandleHce_);
+    if (aid.empty()) {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        return shouldVendorHandleHce_;
     }
+    ElementName aidElement;
+    {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        aidElement = aidElement_;
+    }
+    // resolving the conflicts queries the foreground abilities, done without the lock.
+    bool shouldVendorHandleHce = ShouldVendorHandleHce(aid, aidElement);
+    TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+    shouldVendorHandleHce_ = shouldVendorHandleHce;
+    InfoLog("vendor handle hce: %{public}d", shouldVendorHandleHce_);
     return shouldVendorHandleHce_;
 }
 
 bool HostCardEmulationManager::IsVendorCeActivated()
 {
-    std::lock_guard<std::mutex> lock(hceStateMutex_);
+    TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
     return isVendorCeActivated_;
 }
 
 void HostCardEmulationManager::SetVendorCeActivated(bool isActivated)
 {
-    std::lock_guard<std::mutex> lock(hceStateMutex_);
+    TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
     isVendorCeActivated_ = isActivated;
 }
 #endif
@@ -272,11 +293,19 @@ void HostCardEmulationManager::OnHostCardEmulationDataNfcA(const std::vector<uin
         InfoLog("onHostCardEmulationDataNfcA: no data");
         return;
     }
+    // the APDUs after the SELECT go to the bound service, without the AID lookup.
+    HceAction action;
+    if (!IsSelectApdu(data) && HandleDataOnFastPath(data, action)) {
+        RunHceAction(action, data);
+        return;
+    }
     std::string dataStr = KITS::NfcSdkCommon::BytesVecToHexString(&data[0], data.size());
     InfoLog("onHostCardEmulationDataNfcA: Data Length = %{public}zu; Data as "
             "String = %{public}s",
             data.size(), dataStr.c_str());
-    std::string aid = ParseSelectAid(data);
+    AidKey selectAid;
+    ParseSelectAid(data, selectAid);
+    std::string aid = selectAid.ToHexString();
     InfoLog("onHostCardEmulationDataNfcA: selectAid = %{public}s, state %{public}d", aid.c_str(), hceState_);
     ElementName aidElement;
     auto ceServicePtr = ceService_.lock();
@@ -284,11 +313,13 @@ void HostCardEmulationManager::OnHostCardEmulationDataNfcA(const std::vector<uin
         ErrorLog("ce service expired.");
         return;
     }
-    ceServicePtr->SearchElementByAid(aid, aidElement);
+    ceServicePtr->SearchElementByAid(selectAid, aidElement);
     /* check aid */
-    if (!aid.empty() && !aidElement.GetBundleName().empty()) {
-        std::lock_guard<std::mutex> lock(hceStateMutex_);
+    if (selectAid.IsValid() && !aidElement.GetBundleName().empty()) {
+        bool isFaMode = IsFaModeApplication(aidElement);
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
         aidElement_ = aidElement;
+        isFaModeElement_ = isFaMode;
     }
 
 #ifdef VENDOR_APPLICATIONS_ENABLED
@@ -308,19 +339,99 @@ void HostCardEmulationManager::OnHostCardEmulationDataNfcA(const std::vector<uin
     }
 #endif
 
-    std::lock_guard<std::mutex> lock(hceStateMutex_);
+    {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        if (isFaModeElement_) {
+            action = GetActionForFaApplication(aid, aidElement_, data);
+        } else {
+            action = GetActionForStageApplication(aid, aidElement_, data);
+        }
+    }
+    RunHceAction(action, data);
+}
 
-    if (IsFaModeApplication(aidElement_)) {
-        HandleDataForFaApplication(aid, aidElement_, data);
+bool HostCardEmulationManager::HandleDataOnFastPath(const std::vector<uint8_t>& data, HceAction& action)
+{
+    TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+    if (hceState_ != HostCardEmulationManager::DATA_TRANSFER) {
+        return false;
+    }
+#ifdef VENDOR_APPLICATIONS_ENABLED
+    if (shouldVendorHandleHce_) {
+        return false;
+    }
+#endif
+    DebugLog("HandleDataOnFastPath: Data Length = %{public}zu", data.size());
+    if (isFaModeElement_) {
+        action = HandleDataOnDataTransferForFa("", aidElement_, data);
     } else {
-        HandleDataForStageApplication(aid, aidElement_, data);
+        action = HandleDataOnDataTransfer("", aidElement_, data);
     }
+    return true;
+}
+
+void HostCardEmulationManager::RunHceAction(const HceAction& action, const std::vector<uint8_t>& data)
+{
+    switch (action.type) {
+        case HceAction::ACTION_SEND_TO_SERVICE:
+            SendDataToService(data);
+            break;
+        case HceAction::ACTION_SEND_TO_FA_SERVICE:
+            SendDataToFaService(data, action.element.GetBundleName());
+            break;
+        case HceAction::ACTION_DISPATCH_ABILITY:
+        case HceAction::ACTION_DISPATCH_FA_ABILITY: {
+            ElementName element = action.element;
+            bool isDispatched = (action.type == HceAction::ACTION_DISPATCH_ABILITY) ?
+                DispatchAbilitySingleApp(element) : DispatchAbilitySingleAppForFaModel(element);
+            if (!isDispatched) {
+                TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+                // unless the field went off meanwhile, wait for a SELECT again.
+                if (hceState_ == HostCardEmulationManager::WAIT_FOR_SERVICE) {
+                    hceState_ = action.prevState;
+                    InfoLog("dispatch failed, hce state is %{public}d.", hceState_);
+                }
+            }
+            break;
+        }
+        case HceAction::ACTION_SEND_RAW_FRAME:
+            SendRawFrame(action.rawFrame);
+            break;
+        default:
+            break;
+    }
+}
+
+HostCardEmulationManager::HceAction HostCardEmulationManager::GetDispatchAction(HceAction::Type type,
+    const ElementName& element, const std::vector<uint8_t>& data)
+{
+    // the APDU starting the bind opens a new queue, the ones of a failed bind are dropped.
+    queueHceData_.Clear();
+    queueHceData_.Push(data);
+    // the state is set before the dispatch, the service connecting before it returns finds the queued data.
+    HceAction action;
+    action.type = type;
+    action.element = element;
+    action.prevState = hceState_;
+    hceState_ = HostCardEmulationManager::WAIT_FOR_SERVICE;
+    InfoLog("hce state is %{public}d.", hceState_);
+    return action;
+}
+
+void HostCardEmulationManager::SendRawFrame(const std::string& rawFrame)
+{
+    auto nciCeProxyPtr = nciCeProxy_.lock();
+    if (nciCeProxyPtr == nullptr) {
+        ErrorLog("SendRawFrame: nciCeProxy_ is nullptr.");
+        return;
+    }
+    nciCeProxyPtr->SendRawFrame(rawFrame);
 }
 
 void HostCardEmulationManager::OnCardEmulationActivated()
 {
     InfoLog("OnCardEmulationActivated: state %{public}d", hceState_);
-    std::lock_guard<std::mutex> lock(hceStateMutex_);
+    TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
     hceState_ = HostCardEmulationManager::WAIT_FOR_SELECT;
     InfoLog("hce state is %{public}d.", hceState_);
 
@@ -329,31 +440,40 @@ void HostCardEmulationManager::OnCardEmulationActivated()
     isVendorCeActivated_ = false;
 #endif
 
-    queueHceData_.clear();
+    queueHceData_.Clear();
 }
 
 void HostCardEmulationManager::OnCardEmulationDeactivated()
 {
     InfoLog("OnCardEmulationDeactivated: state %{public}d", hceState_);
-    std::lock_guard<std::mutex> lock(hceStateMutex_);
-    hceState_ = HostCardEmulationManager::INITIAL_STATE;
-    InfoLog("hce state is %{public}d.", hceState_);
+#ifdef VENDOR_APPLICATIONS_ENABLED
+    bool isVendorCeActivated = false;
+#endif
+    {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        hceState_ = HostCardEmulationManager::INITIAL_STATE;
+        InfoLog("hce state is %{public}d.", hceState_);
+#ifdef VENDOR_APPLICATIONS_ENABLED
+        isVendorCeActivated = isVendorCeActivated_;
+        shouldVendorHandleHce_ = false;
+        isVendorCeActivated_ = false;
+#endif
+        queueHceData_.Clear();
+        /* clear aidElement_ status */
+        aidElement_.SetBundleName("");
+        isFaModeElement_ = false;
+    }
 
 #ifdef VENDOR_APPLICATIONS_ENABLED
     // send data to vendor
     sptr<IOnCardEmulationNotifyCb> notifyApduDataCallback =
         ExternalDepsProxy::GetInstance().GetNotifyCardEmulationCallback();
-    if ((notifyApduDataCallback != nullptr) && isVendorCeActivated_) {
+    if ((notifyApduDataCallback != nullptr) && isVendorCeActivated) {
         std::string data{};
         notifyApduDataCallback->OnCardEmulationNotify(CODE_SEND_FIELD_DEACTIVATE, data);
     }
-    shouldVendorHandleHce_ = false;
-    isVendorCeActivated_ = false;
 #endif
 
-    queueHceData_.clear();
-    /* clear aidElement_ status */
-    aidElement_.SetBundleName("");
     if (abilityConnection_ == nullptr) {
         ErrorLog("OnCardEmulationDeactivated abilityConnection_ nullptr.");
         return;
@@ -363,9 +483,10 @@ void HostCardEmulationManager::OnCardEmulationDeactivated()
     InfoLog("Release call end. ret = %{public}d", releaseCallRet);
 }
 
-void HostCardEmulationManager::HandleDataOnW4Select(const std::string& aid, ElementName& aidElement,
-                                                    const std::vector<uint8_t>& data)
+HostCardEmulationManager::HceAction HostCardEmulationManager::HandleDataOnW4Select(const std::string& aid,
+    ElementName& aidElement, const std::vector<uint8_t>& data)
 {
+    HceAction action;
     bool existService = ExistService(aidElement);
     if (!aid.empty()) {
         if (existService) {
@@ -373,35 +494,30 @@ void HostCardEmulationManager::HandleDataOnW4Select(const std::string& aid, Elem
                     "directly.");
             hceState_ = HostCardEmulationManager::DATA_TRANSFER;
             InfoLog("hce state is %{public}d.", hceState_);
-            SendDataToService(data);
-            return;
+            action.type = HceAction::ACTION_SEND_TO_SERVICE;
+            return action;
         } else {
             InfoLog("HandleDataOnW4Select: try to connect service.");
-            queueHceData_ = data;
-            DispatchAbilitySingleApp(aidElement);
-            return;
+            return GetDispatchAction(HceAction::ACTION_DISPATCH_ABILITY, aidElement, data);
         }
     } else if (existService) {
         InfoLog("HandleDataOnW4Select: existing service, try to send data "
                 "directly.");
         hceState_ = HostCardEmulationManager::DATA_TRANSFER;
-        SendDataToService(data);
-        return;
+        action.type = HceAction::ACTION_SEND_TO_SERVICE;
+        return action;
     } else {
         InfoLog("no aid got");
-        std::string unknowError = "6F00";
-        auto nciCeProxyPtr = nciCeProxy_.lock();
-        if (nciCeProxyPtr == nullptr) {
-            ErrorLog("HandleDataOnW4Select: nciCeProxy_ is nullptr.");
-            return;
-        }
-        nciCeProxyPtr->SendRawFrame(unknowError);
+        action.type = HceAction::ACTION_SEND_RAW_FRAME;
+        action.rawFrame = "6F00";
+        return action;
     }
 }
 
-void HostCardEmulationManager::HandleDataOnW4SelectForFa(const std::string& aid, ElementName& aidElement,
-    const std::vector<uint8_t>& data)
+HostCardEmulationManager::HceAction HostCardEmulationManager::HandleDataOnW4SelectForFa(const std::string& aid,
+    ElementName& aidElement, const std::vector<uint8_t>& data)
 {
+    HceAction action;
     /* check aidElement.BundleName */
     bool existService = IsFaServiceConnected(aidElement);
     if (!aid.empty()) {
@@ -410,35 +526,32 @@ void HostCardEmulationManager::HandleDataOnW4SelectForFa(const std::string& aid,
                     "directly.");
             hceState_ = HostCardEmulationManager::DATA_TRANSFER;
             InfoLog("hce state is %{public}d.", hceState_);
-            SendDataToFaService(data, aidElement.GetBundleName());
-            return;
+            action.type = HceAction::ACTION_SEND_TO_FA_SERVICE;
+            action.element = aidElement;
+            return action;
         } else {
             InfoLog("HandleDataOnW4SelectForFa: try to connect service.");
-            queueHceData_ = std::move(data);
-            DispatchAbilitySingleAppForFaModel(aidElement);
-            return;
+            return GetDispatchAction(HceAction::ACTION_DISPATCH_FA_ABILITY, aidElement, data);
         }
     } else if (existService) {
         InfoLog("HandleDataOnW4SelectForFa: existing service, try to send data "
                 "directly.");
         hceState_ = HostCardEmulationManager::DATA_TRANSFER;
-        SendDataToFaService(data, aidElement.GetBundleName());
-        return;
+        action.type = HceAction::ACTION_SEND_TO_FA_SERVICE;
+        action.element = aidElement;
+        return action;
     } else {
         InfoLog("no aid got");
-        std::string unknowError = "6F00";
-        auto nciCeProxyPtr = nciCeProxy_.lock();
-        if (nciCeProxyPtr == nullptr) {
-            ErrorLog("HandleDataOnW4SelectForFa: nciCeProxy_ is nullptr.");
-            return;
-        }
-        nciCeProxyPtr->SendRawFrame(unknowError);
+        action.type = HceAction::ACTION_SEND_RAW_FRAME;
+        action.rawFrame = "6F00";
+        return action;
     }
 }
 
-void HostCardEmulationManager::HandleDataOnDataTransfer(const std::string& aid, ElementName& aidElement,
-                                                        const std::vector<uint8_t>& data)
+HostCardEmulationManager::HceAction HostCardEmulationManager::HandleDataOnDataTransfer(const std::string& aid,
+    ElementName& aidElement, const std::vector<uint8_t>& data)
 {
+    HceAction action;
     bool existService = ExistService(aidElement);
     if (!aid.empty()) {
         if (existService) {
@@ -446,30 +559,30 @@ void HostCardEmulationManager::HandleDataOnDataTransfer(const std::string& aid,
                     "data directly.");
             hceState_ = HostCardEmulationManager::DATA_TRANSFER;
             InfoLog("hce state is %{public}d.", hceState_);
-            SendDataToService(data);
-            return;
+            action.type = HceAction::ACTION_SEND_TO_SERVICE;
+            return action;
         } else {
             InfoLog("HandleDataOnDataTransfer: existing service, try to "
                     "connect service.");
-            queueHceData_ = std::move(data);
-            DispatchAbilitySingleApp(aidElement);
-            return;
+            return GetDispatchAction(HceAction::ACTION_DISPATCH_ABILITY, aidElement, data);
         }
     } else if (existService) {
         InfoLog("HandleDataOnDataTransfer: existing service, try to send data "
                 "directly.");
         hceState_ = HostCardEmulationManager::DATA_TRANSFER;
         InfoLog("hce state is %{public}d.", hceState_);
-        SendDataToService(data);
-        return;
+        action.type = HceAction::ACTION_SEND_TO_SERVICE;
+        return action;
     } else {
         InfoLog("no service, drop apdu data.");
     }
+    return action;
 }
 
-void HostCardEmulationManager::HandleDataOnDataTransferForFa(const std::string& aid, ElementName& aidElement,
-    const std::vector<uint8_t>& data)
+HostCardEmulationManager::HceAction HostCardEmulationManager::HandleDataOnDataTransferForFa(const std::string& aid,
+    ElementName& aidElement, const std::vector<uint8_t>& data)
 {
+    HceAction action;
     /* check aidElement.BundleName */
     bool existService = IsFaServiceConnected(aidElement);
     if (!aid.empty()) {
@@ -478,31 +591,32 @@ void HostCardEmulationManager::HandleDataOnDataTransferForFa(const std::string&
                     "data directly.");
             hceState_ = HostCardEmulationManager::DATA_TRANSFER;
             InfoLog("hce state is %{public}d.", hceState_);
-            SendDataToFaService(data, aidElement.GetBundleName());
-            return;
+            action.type = HceAction::ACTION_SEND_TO_FA_SERVICE;
+            action.element = aidElement;
+            return action;
         } else {
             InfoLog("HandleDataOnDataTransferforFa: existing service, try to "
                     "connect service.");
-            queueHceData_ = std::move(data);
-            DispatchAbilitySingleAppForFaModel(aidElement);
-            return;
+            return GetDispatchAction(HceAction::ACTION_DISPATCH_FA_ABILITY, aidElement, data);
         }
     } else if (existService) {
         InfoLog("HandleDataOnDataTransferforFa: existing service, try to send data "
                 "directly.");
         hceState_ = HostCardEmulationManager::DATA_TRANSFER;
         InfoLog("hce state is %{public}d.", hceState_);
-        SendDataToFaService(data, aidElement.GetBundleName());
-        return;
+        action.type = HceAction::ACTION_SEND_TO_FA_SERVICE;
+        action.element = aidElement;
+        return action;
     } else {
         InfoLog("no service, drop apdu data.");
     }
+    return action;
 }
 
 bool HostCardEmulationManager::IsFaServiceConnected(ElementName& aidElement)
 {
     std::string bundleName = aidElement.GetBundleName();
-    std::lock_guard<std::mutex> lock(regInfoMutex_);
+    TimedLockGuard lock(regInfoMutex_, regInfoLockStats_);
     auto it = bundleNameToHceCmdRegData_.find(bundleName);
     if (it == bundleNameToHceCmdRegData_.end()) {
         InfoLog("IsFaServiceConnected not register data for %{public}s", bundleName.c_str());
@@ -519,7 +633,7 @@ bool HostCardEmulationManager::ExistService(ElementName& aidElement)
         return false;
     }
     std::string bundleName = abilityConnection_->GetConnectedElement().GetBundleName();
-    std::lock_guard<std::mutex> lock(regInfoMutex_);
+    TimedLockGuard lock(regInfoMutex_, regInfoLockStats_);
     auto it = bundleNameToHceCmdRegData_.find(bundleName);
     if (it == bundleNameToHceCmdRegData_.end()) {
         ErrorLog("no register data for %{public}s", abilityConnection_->GetConnectedElement().GetURI().c_str());
@@ -546,33 +660,32 @@ bool HostCardEmulationManager::ExistService(ElementName& aidElement)
     }
 }
 
-std::string HostCardEmulationManager::ParseSelectAid(const std::vector<uint8_t>& data)
+bool HostCardEmulationManager::ParseSelectAid(const std::vector<uint8_t>& data, AidKey& aid)
 {
     if (data.empty() || data.size() < SELECT_APDU_HDR_LENGTH + MINIMUM_AID_LENGTH) {
         InfoLog("invalid data. Data size less than hdr length plus minumum length.");
-        return "";
+        return false;
     }
 
-    if (data[INDEX_CLASS_BYTE] == SELECT_00 && data[INDEX_CHAIN_INSTRUCTION] == INSTR_SELECT &&
-        data[INDEX_P1] == SELECT_P1) {
+    if (IsSelectApdu(data)) {
         if (data[INDEX_3] != SELECT_00 && data[INDEX_3] != SELECT_P2_0C) {
             InfoLog("not supported aid");
-            return "";
+            return false;
         }
 
         uint8_t aidLength = data[INDEX_AID_LEN];
         if ((aidLength == 0) || (data.size() < SELECT_APDU_HDR_LENGTH + aidLength) ||
-            (aidLength > MAX_AID_LENGTH)) {
+            (aidLength > AidKey::MAX_AID_LEN)) {
             InfoLog("invalid data. Data size less than hdr length plus aid declared length.");
-            return "";
+            return false;
         }
 
-        std::vector<uint8_t> aidVec(data.begin() + SELECT_APDU_HDR_LENGTH,
-                                    data.begin() + SELECT_APDU_HDR_LENGTH + aidLength);
-        return KITS::NfcSdkCommon::BytesVecToHexString(&aidVec[0], aidVec.size());
+        // the key is built in place, the aid is hex encoded only for the logs.
+        aid = AidKey(&data[SELECT_APDU_HDR_LENGTH], aidLength);
+        return true;
     }
 
-    return "";
+    return false;
 }
 
 bool HostCardEmulationManager::RegHceCmdCallback(const sptr<KITS::IHceCmdCallback>& callback,
@@ -604,7 +717,7 @@ bool HostCardEmulationManager::RegHceCmdCallback(const sptr<KITS::IHceCmdCallbac
     regData.callback_ = callback;
     regData.callerToken_ = callerToken;
     {
-        std::lock_guard<std::mutex> lock(regInfoMutex_);
+        TimedLockGuard lock(regInfoMutex_, regInfoLockStats_);
         InfoLog("RegHceCmdCallback start, register size =%{public}zu.", bundleNameToHceCmdRegData_.size());
         if (bundleNameToHceCmdRegData_.find(hapTokenInfo.bundleName) != bundleNameToHceCmdRegData_.end()) {
             InfoLog("override the register data for %{public}s", hapTokenInfo.bundleName.c_str());
@@ -651,11 +764,13 @@ bool HostCardEmulationManager::SendHostApduData(std::string hexCmdData, bool raw
     }
 
     ElementName aidElement;
+    bool isFaMode = false;
     {
-        std::lock_guard<std::mutex> lock(hceStateMutex_);
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
         aidElement = aidElement_;
+        isFaMode = isFaModeElement_;
     }
-    if (IsFaModeApplication(aidElement)) {
+    if (isFaMode) {
         if (!IsFaServiceConnected(aidElement)) {
             ErrorLog("SendHostApduData fa: not the connected app, do not send.");
             return false;
@@ -672,6 +787,7 @@ bool HostCardEmulationManager::SendHostApduData(std::string hexCmdData, bool raw
         ErrorLog("SendHostApduData nciCeProxyPtr nullptr");
         return false;
     }
+    CeCaptureRing::GetInstance().RecordResponse(hexCmdData);
     return nciCeProxyPtr->SendRawFrame(hexCmdData);
 }
 
@@ -702,57 +818,84 @@ bool HostCardEmulationManager::IsCorrespondentService(Security::AccessToken::Acc
 
 void HostCardEmulationManager::HandleQueueData()
 {
-    std::lock_guard<std::mutex> lock(hceStateMutex_);
-    bool shouldSendQueueData = hceState_ == HostCardEmulationManager::WAIT_FOR_SERVICE && !queueHceData_.empty();
-
-    std::string queueData = "";
-    if (!queueHceData_.empty()) {
-        queueData = KITS::NfcSdkCommon::BytesVecToHexString(&queueHceData_[0], queueHceData_.size());
-    }
     if (abilityConnection_ == nullptr) {
         ErrorLog("HandleQueueData abilityConnection_ is null");
         return;
     }
-    InfoLog("RegHceCmdCallback queue data %{public}s, hceState= %{public}d, "
-            "service connected= %{public}d",
-            queueData.c_str(), hceState_, abilityConnection_->ServiceConnected());
-    if (shouldSendQueueData) {
+    {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        InfoLog("RegHceCmdCallback queue %{public}zu apdus of %{public}zu bytes, hceState= %{public}d, "
+                "service connected= %{public}d", queueHceData_.GetCount(), queueHceData_.GetBytes(), hceState_,
+                abilityConnection_->ServiceConnected());
+        if (hceState_ != HostCardEmulationManager::WAIT_FOR_SERVICE || queueHceData_.IsEmpty()) {
+            WarnLog("HandleQueueData can not send the data.");
+            return;
+        }
         InfoLog("RegHceCmdCallback should send queue data");
-        hceState_ = HostCardEmulationManager::DATA_TRANSFER;
-        InfoLog("hce state is %{public}d.", hceState_);
-        SendDataToService(queueHceData_);
-        queueHceData_.clear();
-        return;
     }
-    WarnLog("HandleQueueData can not send the data.");
+    ReleaseQueuedApdus(false, "");
 }
 
 void HostCardEmulationManager::HandleQueueDataForFa(const std::string &bundleName)
 {
-    std::lock_guard<std::mutex> lock(hceStateMutex_);
-    if (queueHceData_.size() == 0) {
-        WarnLog("HandleQueueDataForFa queueHceData is null");
-        return;
-    }
     if (abilityConnection_ == nullptr) {
         ErrorLog("HandleQueueDataForFa abilityConnection_ is null");
         return;
     }
-    std::string queueData = KITS::NfcSdkCommon::BytesVecToHexString(&queueHceData_[0], queueHceData_.size());
-    InfoLog("RegHceCmdCallback queue data for fa %{public}s, hceState= %{public}d, "
-            "service connected= %{public}d",
-            queueData.c_str(), hceState_, abilityConnection_->ServiceConnected());
-    hceState_ = HostCardEmulationManager::WAIT_FOR_SERVICE;
-    bool shouldSendQueueData = hceState_ == HostCardEmulationManager::WAIT_FOR_SERVICE && !queueHceData_.empty();
-    if (shouldSendQueueData) {
+    {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        if (queueHceData_.IsEmpty()) {
+            WarnLog("HandleQueueDataForFa queueHceData is null");
+            return;
+        }
+        InfoLog("RegHceCmdCallback queue for fa %{public}zu apdus of %{public}zu bytes, hceState= %{public}d, "
+                "service connected= %{public}d", queueHceData_.GetCount(), queueHceData_.GetBytes(), hceState_,
+                abilityConnection_->ServiceConnected());
+        hceState_ = HostCardEmulationManager::WAIT_FOR_SERVICE;
         InfoLog("RegHceCmdCallback should send queue data");
-        hceState_ = HostCardEmulationManager::DATA_TRANSFER;
-        InfoLog("hce state is %{public}d.", hceState_);
-        SendDataToFaService(queueHceData_, bundleName);
-        queueHceData_.clear();
-        return;
     }
-    WarnLog("HandleQueueDataForFa can not send the data.");
+    ReleaseQueuedApdus(true, bundleName);
+}
+
+void HostCardEmulationManager::ReleaseQueuedApdus(bool isFaMode, const std::string &bundleName)
+{
+    // the state stays WAIT_FOR_SERVICE until the queue is drained, the APDUs arriving meanwhile are queued behind
+    // the released ones, so the service gets them in the order of the reader.
+    while (true) {
+        std::vector<std::vector<uint8_t>> apdus;
+        {
+            TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+            if (hceState_ != HostCardEmulationManager::WAIT_FOR_SERVICE) {
+                InfoLog("ReleaseQueuedApdus: stopped on hce state %{public}d.", hceState_);
+                return;
+            }
+            if (queueHceData_.IsEmpty()) {
+                hceState_ = HostCardEmulationManager::DATA_TRANSFER;
+                InfoLog("hce state is %{public}d.", hceState_);
+                return;
+            }
+            apdus = queueHceData_.Release();
+        }
+        for (const std::vector<uint8_t>& apdu : apdus) {
+            if (isFaMode) {
+                SendDataToFaService(apdu, bundleName);
+            } else {
+                SendDataToService(apdu);
+            }
+        }
+    }
+}
+
+sptr<KITS::IHceCmdCallback> HostCardEmulationManager::GetHceCmdCallback(const std::string &bundleName)
+{
+    TimedLockGuard lock(regInfoMutex_, regInfoLockStats_);
+    InfoLog("GetHceCmdCallback register size = %{public}zu.", bundleNameToHceCmdRegData_.size());
+    auto it = bundleNameToHceCmdRegData_.find(bundleName);
+    if (it == bundleNameToHceCmdRegData_.end()) {
+        ErrorLog("no register data for %{public}s", bundleName.c_str());
+        return nullptr;
+    }
+    return it->second.callback_;
 }
 
 void HostCardEmulationManager::SendDataToService(const std::vector<uint8_t>& data)
@@ -762,42 +905,43 @@ void HostCardEmulationManager::SendDataToService(const std::vector<uint8_t>& dat
         return;
     }
     std::string bundleName = abilityConnection_->GetConnectedElement().GetBundleName();
-
-    std::lock_guard<std::mutex> lock(regInfoMutex_);
-    InfoLog("SendDataToService register size = %{public}zu.", bundleNameToHceCmdRegData_.size());
-    auto it = bundleNameToHceCmdRegData_.find(bundleName);
-    if (it == bundleNameToHceCmdRegData_.end()) {
+    bool isRegistered = false;
+    sptr<KITS::IHceCmdCallback> callback = nullptr;
+    {
+        TimedLockGuard lock(regInfoMutex_, regInfoLockStats_);
+        auto it = bundleNameToHceCmdRegData_.find(bundleName);
+        if (it != bundleNameToHceCmdRegData_.end()) {
+            isRegistered = true;
+            callback = it->second.callback_;
+        }
+    }
+    if (!isRegistered) {
         ErrorLog("no register data for %{public}s", abilityConnection_->GetConnectedElement().GetURI().c_str());
         ExternalDepsProxy::GetInstance().WriteNfcHceCmdCbHiSysEvent(bundleName, SubErrorCode::HCE_CMD_CB_NOT_EXIST);
         return;
     }
-    if (it->second.callback_ == nullptr) {
+    if (callback == nullptr) {
         ErrorLog("callback is null");
         ExternalDepsProxy::GetInstance().WriteNfcHceCmdCbHiSysEvent(bundleName, SubErrorCode::HCE_CMD_CB_NULL);
         return;
     }
-    it->second.callback_->OnCeApduData(data);
+    // the IPC to the app runs without the lock, a slow app doesn't hold up the registrations.
+    callback->OnCeApduData(data);
     ExternalDepsProxy::GetInstance().WriteNfcHceCmdCbHiSysEvent(bundleName, SubErrorCode::HCE_CMD_CB_EXIST);
 }
 
 void HostCardEmulationManager::SendDataToFaService(const std::vector<uint8_t>& data, const std::string &bundleName)
 {
-    std::lock_guard<std::mutex> lock(regInfoMutex_);
-    InfoLog("SendDataToFaService register size = %{public}zu.", bundleNameToHceCmdRegData_.size());
     if (abilityConnection_ == nullptr) {
         ErrorLog("SendDataToFaService abilityConnection_ is null");
         return;
     }
-    auto it = bundleNameToHceCmdRegData_.find(bundleName);
-    if (it == bundleNameToHceCmdRegData_.end()) {
-        ErrorLog("no register data for %{public}s", abilityConnection_->GetConnectedElement().GetURI().c_str());
-        return;
-    }
-    if (it->second.callback_ == nullptr) {
+    sptr<KITS::IHceCmdCallback> callback = GetHceCmdCallback(bundleName);
+    if (callback == nullptr) {
         ErrorLog("callback is null");
         return;
     }
-    it->second.callback_->OnCeApduData(data);
+    callback->OnCeApduData(data);
 }
 
 bool HostCardEmulationManager::DispatchAbilitySingleApp(ElementName& element)
@@ -827,8 +971,6 @@ bool HostCardEmulationManager::DispatchAbilitySingleApp(ElementName& element)
     ErrCode err = abilityManagerClient->StartAbilityByCall(want, abilityConnection_);
     InfoLog("DispatchAbilitySingleApp call StartAbility end. ret = %{public}d", err);
     if (err == ERR_NONE) {
-        hceState_ = HostCardEmulationManager::WAIT_FOR_SERVICE;
-        InfoLog("hce state is %{public}d.", hceState_);
         ExternalDepsProxy::GetInstance().WriteHceSwipeResultHiSysEvent(element.GetBundleName(), DEFAULT_COUNT);
         
         NfcFailedParams params;
@@ -867,8 +1009,6 @@ bool HostCardEmulationManager::DispatchAbilitySingleAppForFaModel(ElementName& e
     ErrCode err = abilityManagerClient->StartAbility(want);
     InfoLog("DispatchAbilitySingleAppForFaModel call StartAbility end. ret = %{public}d", err);
     if (err == ERR_NONE) {
-        hceState_ = HostCardEmulationManager::WAIT_FOR_SERVICE;
-        InfoLog("hce state is %{public}d.", hceState_);
         ExternalDepsProxy::GetInstance().WriteHceSwipeResultHiSysEvent(element.GetBundleName(), DEFAULT_COUNT);
 
         NfcFailedParams params;
@@ -881,6 +1021,36 @@ bool HostCardEmulationManager::DispatchAbilitySingleAppForFaModel(ElementName& e
     return false;
 }
 
+void HostCardEmulationManager::Dump(int fd)
+{
+    HceState hceState = HostCardEmulationManager::INITIAL_STATE;
+    size_t queueCount = 0;
+    size_t queueBytes = 0;
+    HceApduQueue::QueueStats queueStats;
+    {
+        TimedLockGuard lock(hceStateMutex_, hceStateLockStats_);
+        hceState = hceState_;
+        queueCount = queueHceData_.GetCount();
+        queueBytes = queueHceData_.GetBytes();
+        queueStats = queueHceData_.GetStats();
+    }
+    uint64_t avgWaitMs = (queueStats.releaseCount == 0) ? 0 : (queueStats.totalWaitMs / queueStats.releaseCount);
+    dprintf(fd, "Host card emulation:\n");
+    dprintf(fd, "  hce state: %d, queued: %zu apdus of %zu bytes\n", static_cast<int>(hceState), queueCount,
+        queueBytes);
+    dprintf(fd, "  apdu queue: queued %llu, dropped %llu, released %llu apdus in %llu releases, slow releases %llu\n",
+        static_cast<unsigned long long>(queueStats.queuedCount),
+        static_cast<unsigned long long>(queueStats.droppedCount),
+        static_cast<unsigned long long>(queueStats.releasedCount),
+        static_cast<unsigned long long>(queueStats.releaseCount),
+        static_cast<unsigned long long>(queueStats.slowReleaseCount));
+    dprintf(fd, "  apdu queue wait: last %llu ms, avg %llu ms, max %llu ms\n",
+        static_cast<unsigned long long>(queueStats.lastWaitMs), static_cast<unsigned long long>(avgWaitMs),
+        static_cast<unsigned long long>(queueStats.maxWaitMs));
+    hceStateLockStats_.Dump(fd);
+    regInfoLockStats_.Dump(fd);
+}
+
 bool HostCardEmulationManager::UnRegHceCmdCallback(const std::string& type,
                                                    Security::AccessToken::AccessTokenID callerToken)
 {
@@ -899,7 +1069,7 @@ bool HostCardEmulationManager::EraseHceCmdCallback(Security::AccessToken::Access
         ErrorLog("EraseHceCmdCallback: not got bundle name");
         return false;
     }
-    std::lock_guard<std::mutex> lock(regInfoMutex_);
+    TimedLockGuard lock(regInfoMutex_, regInfoLockStats_);
     InfoLog("EraseHceCmdCallback start, register size =%{public}zu.", bundleNameToHceCmdRegData_.size());
     if (bundleNameToHceCmdRegData_.find(hapTokenInfo.bundleName) != bundleNameToHceCmdRegData_.end()) {
         InfoLog("unregister data for  %{public}s", hapTokenInfo.bundleName.c_str());
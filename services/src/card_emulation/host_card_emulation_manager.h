@@ -18,6 +18,9 @@
 #include <vector>
 #include <string>
 #include "nfc_service.h"
+#include "aid_key.h"
+#include "hce_apdu_queue.h"
+#include "lock_stats.h"
 #include "access_token.h"
 #include "common_event_manager.h"
 #include "ihce_cmd_callback.h"
@@ -58,6 +61,22 @@ public:
         sptr<KITS::IHceCmdCallback> callback_ = nullptr;
     };
 
+    // the outbound call decided under hceStateMutex_, run once the lock is released
+    struct HceAction {
+        enum Type {
+            ACTION_NONE = 0,
+            ACTION_SEND_TO_SERVICE,
+            ACTION_SEND_TO_FA_SERVICE,
+            ACTION_DISPATCH_ABILITY,
+            ACTION_DISPATCH_FA_ABILITY,
+            ACTION_SEND_RAW_FRAME,
+        };
+        Type type = ACTION_NONE;
+        ElementName element {};
+        HceState prevState = INITIAL_STATE; // restored if the dispatch fails
+        std::string rawFrame {};
+    };
+
     bool RegHceCmdCallback(const sptr<KITS::IHceCmdCallback>& callback, const std::string& type,
                            Security::AccessToken::AccessTokenID callerToken);
     bool UnRegHceCmdCallback(const std::string& type, Security::AccessToken::AccessTokenID callerToken);
@@ -74,18 +93,31 @@ public:
         const std::vector<uint8_t>& data);
     void HandleDataForFaApplication(const std::string& aid, ElementName& aidElement, const std::vector<uint8_t>& data);
     bool IsFaServiceConnected(ElementName& aidElement);
+    void Dump(int fd);
 
 private:
-    void HandleDataOnW4Select(const std::string& aid, ElementName& aidElement, const std::vector<uint8_t>& data);
-    void HandleDataOnDataTransfer(const std::string& aid, ElementName& aidElement,
-                                  const std::vector<uint8_t>& data);
-    void HandleDataOnW4SelectForFa(const std::string& aid, ElementName& aidElement, const std::vector<uint8_t>& data);
-    void HandleDataOnDataTransferForFa(const std::string& aid, ElementName& aidElement,
+    HceAction GetActionForFaApplication(const std::string& aid, ElementName& aidElement,
+        const std::vector<uint8_t>& data);
+    HceAction GetActionForStageApplication(const std::string& aid, ElementName& aidElement,
+        const std::vector<uint8_t>& data);
+    HceAction HandleDataOnW4Select(const std::string& aid, ElementName& aidElement,
+        const std::vector<uint8_t>& data);
+    HceAction HandleDataOnDataTransfer(const std::string& aid, ElementName& aidElement,
+        const std::vector<uint8_t>& data);
+    HceAction HandleDataOnW4SelectForFa(const std::string& aid, ElementName& aidElement,
+        const std::vector<uint8_t>& data);
+    HceAction HandleDataOnDataTransferForFa(const std::string& aid, ElementName& aidElement,
         const std::vector<uint8_t>& data);
+    HceAction GetDispatchAction(HceAction::Type type, const ElementName& element, const std::vector<uint8_t>& data);
+    void ReleaseQueuedApdus(bool isFaMode, const std::string &bundleName);
+    void RunHceAction(const HceAction& action, const std::vector<uint8_t>& data);
+    void SendRawFrame(const std::string& rawFrame);
     void SendDataToFaService(const std::vector<uint8_t>& data, const std::string &bundleName);
+    sptr<KITS::IHceCmdCallback> GetHceCmdCallback(const std::string &bundleName);
 
     bool ExistService(ElementName& aidElement);
-    std::string ParseSelectAid(const std::vector<uint8_t>& data);
+    bool ParseSelectAid(const std::vector<uint8_t>& data, AidKey& aid);
+    bool HandleDataOnFastPath(const std::vector<uint8_t>& data, HceAction& action);
     void SendDataToService(const std::vector<uint8_t>& data);
     bool DispatchAbilitySingleApp(ElementName& element);
     bool DispatchAbilitySingleAppForFaModel(ElementName& element);
@@ -111,13 +143,17 @@ private:
     std::map<std::string, HostCardEmulationManager::HceCmdRegistryData> bundleNameToHceCmdRegData_{};
     HceState hceState_;
     AppExecFwk::ElementName aidElement_;
-    std::vector<uint8_t> queueHceData_{};
+    bool isFaModeElement_ = false; // the model of aidElement_, queried once per SELECT
+    HceApduQueue queueHceData_{}; // the APDUs received while the service binds
 
     sptr<NfcAbilityConnectionCallback> abilityConnection_{};
     friend class NfcAbilityConnectionCallback;
 
+    // held for the lookups and the state transitions only, never across an outbound IPC
     std::mutex regInfoMutex_ {};
     std::mutex hceStateMutex_ {};
+    LockStats regInfoLockStats_ {"regInfoMutex"};
+    LockStats hceStateLockStats_ {"hceStateMutex"};
 };
 } // namespace NFC
 } // namespace OHOS
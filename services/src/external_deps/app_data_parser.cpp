@@ -14,10 +14,16 @@
 */
 #include "app_data_parser.h"
 
+#include <algorithm>
+#include <atomic>
+#include <random>
+
 #include "accesstoken_kit.h"
 #include "common_event_manager.h"
 #include "iservice_registry.h"
 #include "loghelper.h"
+#include "ndef_dispatch_rules.h"
+#include "nfc_bundle_mgr_client.h"
 #include "nfc_sdk_common.h"
 #include "system_ability_definition.h"
 #include "taginfo.h"
@@ -30,17 +36,15 @@ static AppDataParser g_appDataParser;
 /** Tag type of tag app metadata name */
 static const std::string KEY_TAG_TECH = "tag-tech";
 std::mutex g_mutex = {};
-sptr<BundleMgrDeathRecipient> bundleMgrDeathRecipient_(new BundleMgrDeathRecipient());
-
-void BundleMgrDeathRecipient::OnRemoteDied([[maybe_unused]] const wptr<IRemoteObject> &remote)
-{
-    InfoLog("bundleMgrService dead");
-};
+static const uint32_t PAYMENT_CATALOG_EPOCH_SHIFT = 32;
 
 AppDataParser::AppDataParser()
 {
     g_tagAppAndTechMap.clear();
     g_hceAppAndAidMap.clear();
+    // a version cached by a client before the service restarted never matches the versions of this start.
+    std::random_device randomDevice;
+    paymentCatalogVersion_ = (static_cast<uint64_t>(randomDevice()) << PAYMENT_CATALOG_EPOCH_SHIFT) | 1;
 }
 
 AppDataParser::~AppDataParser()
@@ -54,24 +58,61 @@ AppDataParser& AppDataParser::GetInstance()
 
 sptr<AppExecFwk::IBundleMgr> AppDataParser::GetBundleMgrProxy()
 {
-    sptr<ISystemAbilityManager> systemAbilityManager =
-        SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (!systemAbilityManager) {
-        ErrorLog("GetBundleMgrProxy, systemAbilityManager is null");
-        return nullptr;
-    }
-    sptr<IRemoteObject> remoteObject = systemAbilityManager->GetSystemAbility(BUNDLE_MGR_SERVICE_SYS_ABILITY_ID);
-    if (!remoteObject) {
-        ErrorLog("GetBundleMgrProxy, remoteObject is null");
-        return nullptr;
+    return NfcBundleMgrClient::GetInstance().GetBundleMgrProxy();
+}
+
+std::shared_ptr<const AppDataParser::AppTables> AppDataParser::GetAppTables() const
+{
+    return std::atomic_load_explicit(&appTables_, std::memory_order_acquire);
+}
+
+void AppDataParser::PublishAppTables()
+{
+    // called with g_mutex held, readers keep using the previous snapshot until they reload it.
+    auto tables = std::make_shared<AppTables>();
+    tables->tagApps = g_tagAppAndTechMap;
+    tables->hceApps = g_hceAppAndAidMap;
+    tables->offHostApps = g_offHostAppAndAidMap;
+    BuildHceAidIndex(*tables);
+    std::shared_ptr<const AppTables> newTables = tables;
+    std::atomic_store_explicit(&appTables_, newTables, std::memory_order_release);
+    InvalidatePaymentCatalog();
+}
+
+void AppDataParser::BuildHceAidIndex(AppTables &tables)
+{
+    HceAidIndex &index = tables.hceAidIndex;
+    for (size_t i = 0; i < tables.hceApps.size(); i++) {
+        for (const AidInfo &aidInfo : tables.hceApps[i].customDataAid) {
+            AidKey aid = AidKey::FromHexString(aidInfo.value);
+            if (!aid.IsValid()) {
+                WarnLog("BuildHceAidIndex: invalid aid %{public}s", aidInfo.value.c_str());
+                continue;
+            }
+            index.push_back({aid, i});
+        }
     }
-    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = iface_cast<AppExecFwk::IBundleMgr>(remoteObject);
-    if (bundleMgrProxy == nullptr || bundleMgrProxy->AsObject() == nullptr) {
-        ErrorLog("GetBundleMgrProxy, bundleMgrProxy is nullptr");
-        return nullptr;
+    auto isLess = [](const HceAidIndexEntry &a, const HceAidIndexEntry &b) {
+        return a.aid < b.aid || (a.aid == b.aid && a.hceAppIndex < b.hceAppIndex);
+    };
+    auto isSame = [](const HceAidIndexEntry &a, const HceAidIndexEntry &b) {
+        return a.aid == b.aid && a.hceAppIndex == b.hceAppIndex;
+    };
+    // an app declaring the AID as both payment and other is found once, as by the hex string lookup.
+    std::sort(index.begin(), index.end(), isLess);
+    index.erase(std::unique(index.begin(), index.end(), isSame), index.end());
+}
+
+std::pair<AppDataParser::HceAidIndex::const_iterator, AppDataParser::HceAidIndex::const_iterator>
+    AppDataParser::AppTables::FindHceApps(const AidKey &aid) const
+{
+    auto lower = std::lower_bound(hceAidIndex.begin(), hceAidIndex.end(), aid,
+        [](const HceAidIndexEntry &entry, const AidKey &key) { return entry.aid < key; });
+    auto upper = lower;
+    while (upper != hceAidIndex.end() && upper->aid == aid) {
+        ++upper;
     }
-    bundleMgrProxy->AsObject()->AddDeathRecipient(bundleMgrDeathRecipient_);
-    return bundleMgrProxy;
+    return std::make_pair(lower, upper);
 }
 
 bool AppDataParser::HandleAppAddOrChangedEvent(std::shared_ptr<EventFwk::CommonEventData> data)
@@ -88,11 +129,14 @@ bool AppDataParser::HandleAppAddOrChangedEvent(std::shared_ptr<EventFwk::CommonE
     }
     OHOS::AAFwk::Want want = data->GetWant();
     int32_t appIndex = want.GetIntParam(AppExecFwk::Constants::APP_INDEX, AppExecFwk::Constants::DEFAULT_APP_INDEX);
+    NfcBundleMgrClient::GetInstance().InvalidateBundle(bundleName);
+    TAG::NdefDispatchRules::GetInstance().UpdateBundle(bundleName);
     std::lock_guard<std::mutex> lock(g_mutex);
     DebugLog("HandleAppAddOrChangedEvent bundlename: %{public}s, appIndex: %{public}d", bundleName.c_str(), appIndex);
     bool tag = UpdateAppListInfo(element, KITS::ACTION_TAG_FOUND);
     bool host = UpdateAppListInfo(element, KITS::ACTION_HOST_APDU_SERVICE, appIndex);
     bool offHost = UpdateAppListInfo(element, KITS::ACTION_OFF_HOST_APDU_SERVICE);
+    PublishAppTables();
     return tag || host || offHost;
 }
 
@@ -110,6 +154,8 @@ bool AppDataParser::HandleAppRemovedEvent(std::shared_ptr<EventFwk::CommonEventD
     }
     OHOS::AAFwk::Want want = data->GetWant();
     int32_t appIndex = want.GetIntParam(AppExecFwk::Constants::APP_INDEX, AppExecFwk::Constants::DEFAULT_APP_INDEX);
+    NfcBundleMgrClient::GetInstance().InvalidateBundle(bundleName);
+    TAG::NdefDispatchRules::GetInstance().RemoveBundle(bundleName);
     std::lock_guard<std::mutex> lock(g_mutex);
     DebugLog("HandleAppRemovedEvent, bundleName %{public}s appIndex: %{public}d"
         "tag size %{public}zu, hce size %{public}zu",
@@ -120,6 +166,7 @@ bool AppDataParser::HandleAppRemovedEvent(std::shared_ptr<EventFwk::CommonEventD
     bool tag = RemoveTagAppInfo(element);
     bool hce = RemoveHceAppInfo(element, appIndex);
     bool offHost = RemoveOffHostAppInfo(element);
+    PublishAppTables();
     return tag || hce || offHost;
 }
 
@@ -511,26 +558,27 @@ void AppDataParser::InitAppList()
     InitAppListByAction(KITS::ACTION_OFF_HOST_APDU_SERVICE);
     InfoLog("InitAppList, tag size %{public}zu, hce size %{public}zu, off host app  %{public}zu",
             g_tagAppAndTechMap.size(), g_hceAppAndAidMap.size(), g_offHostAppAndAidMap.size());
+    PublishAppTables();
+    TAG::NdefDispatchRules::GetInstance().Compile();
     appListInitDone_ = true;
 }
 
 std::vector<ElementName> AppDataParser::GetDispatchTagAppsByTech(std::vector<int> discTechList)
 {
-    std::lock_guard<std::mutex> lock(g_mutex);
+    std::shared_ptr<const AppTables> tables = GetAppTables();
     std::vector<ElementName> elements;
     for (size_t i = 0; i < discTechList.size(); i++) {
         std::string discStrTech = KITS::TagInfo::GetStringTech(discTechList[i]);
-        DebugLog("GetDispatchTagAppsByTech, tag size = %{public}zu", g_tagAppAndTechMap.size());
+        DebugLog("GetDispatchTagAppsByTech, tag size = %{public}zu", tables->tagApps.size());
         if (discStrTech.empty()) {
             continue;
         }
 
         // parse for all installed app that can handle this technology.
-        std::vector<TagAppTechInfo>::iterator iter;
-        for (iter = g_tagAppAndTechMap.begin(); iter != g_tagAppAndTechMap.end(); ++iter) {
+        for (const TagAppTechInfo &tagApp : tables->tagApps) {
             bool appExisted = false;
-            for (auto item : elements) {
-                if (IsMatchedByBundleName(item, (*iter).element)) {
+            for (const auto &item : elements) {
+                if (item.GetBundleName() == tagApp.element.GetBundleName()) {
                     appExisted = true;
                     break;
                 }
@@ -539,12 +587,12 @@ std::vector<ElementName> AppDataParser::GetDispatchTagAppsByTech(std::vector<int
                 continue;
             }
 
-            std::vector<std::string> vectorTech = (*iter).tech;
+            const std::vector<std::string> &vectorTech = tagApp.tech;
             for (size_t j = 0; j < vectorTech.size(); j++) {
                 DebugLog("GetDispatchTagAppsByTech, cmp tech %{public}s vs %{public}s",
                     discStrTech.c_str(), vectorTech[j].c_str());
                 if (discStrTech.compare(vectorTech[j]) == 0) {
-                    elements.push_back((*iter).element);
+                    elements.push_back(tagApp.element);
                     break;
                 }
             }
@@ -571,6 +619,7 @@ void AppDataParser::RegQueryApplicationCb(sptr<IQueryAppInfoCallback> callback)
 {
     std::lock_guard<std::mutex> lock(g_mutex);
     queryApplicationByVendor_ = callback;
+    InvalidatePaymentCatalog();
 }
 
 void AppDataParser::RegCardEmulationNotifyCb(sptr<IOnCardEmulationNotifyCb> callback)
@@ -588,14 +637,10 @@ sptr<IOnCardEmulationNotifyCb> AppDataParser::GetNotifyCardEmulationCallback() c
 
 void AppDataParser::GetHceAppsByAid(const std::string& aid, std::vector<AppDataParser::HceAppAidInfo>& hceApps)
 {
-    std::lock_guard<std::mutex> lock(g_mutex);
-    for (const HceAppAidInfo& appAidInfo : g_hceAppAndAidMap) {
-        for (const AidInfo& aidInfo : appAidInfo.customDataAid) {
-            if (aid == aidInfo.value) {
-                hceApps.push_back(appAidInfo);
-                break;
-            }
-        }
+    std::shared_ptr<const AppTables> tables = GetAppTables();
+    auto range = tables->FindHceApps(AidKey::FromHexString(aid));
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        hceApps.push_back(tables->hceApps[iter->hceAppIndex]);
     }
 }
 
@@ -750,11 +795,10 @@ bool AppDataParser::IsBundleInstalled(const std::string &bundleName)
 }
 void AppDataParser::GetHceApps(std::vector<HceAppAidInfo> &hceApps)
 {
-    std::lock_guard<std::mutex> lock(g_mutex);
-    for (const HceAppAidInfo &appAidInfo : g_hceAppAndAidMap) {
-        hceApps.push_back(appAidInfo);
-    }
+    std::shared_ptr<const AppTables> tables = GetAppTables();
+    hceApps.insert(hceApps.end(), tables->hceApps.begin(), tables->hceApps.end());
 #ifdef VENDOR_APPLICATIONS_ENABLED
+    std::lock_guard<std::mutex> lock(g_mutex);
     GetHceAppsFromVendor(hceApps);
 #endif
 }
@@ -771,14 +815,15 @@ bool AppDataParser::IsPaymentApp(const AppDataParser::HceAppAidInfo &hceAppInfo)
 
 bool AppDataParser::IsHceApp(const ElementName &elementName)
 {
-    std::lock_guard<std::mutex> lock(g_mutex);
-    for (const AppDataParser::HceAppAidInfo &appAidInfo : g_hceAppAndAidMap) {
+    std::shared_ptr<const AppTables> tables = GetAppTables();
+    for (const AppDataParser::HceAppAidInfo &appAidInfo : tables->hceApps) {
         if (appAidInfo.element.GetBundleName() == elementName.GetBundleName() &&
             appAidInfo.element.GetAbilityName() == elementName.GetAbilityName()) {
             return true;
         }
     }
 #ifdef VENDOR_APPLICATIONS_ENABLED
+    std::lock_guard<std::mutex> lock(g_mutex);
     return IsHceAppFromVendor(elementName);
 #else
     return false;
@@ -787,8 +832,8 @@ bool AppDataParser::IsHceApp(const ElementName &elementName)
 
 bool AppDataParser::IsOffhostAndSecureElementIsSIM(const ElementName &elementName)
 {
-    std::lock_guard<std::mutex> lock(g_mutex);
-    for (const AppDataParser::HceAppAidInfo &appAidInfo : g_offHostAppAndAidMap) {
+    std::shared_ptr<const AppTables> tables = GetAppTables();
+    for (const AppDataParser::HceAppAidInfo &appAidInfo : tables->offHostApps) {
         if (appAidInfo.element.GetBundleName() != elementName.GetBundleName() ||
             appAidInfo.element.GetAbilityName() != elementName.GetAbilityName()) {
             continue;
@@ -806,10 +851,57 @@ bool AppDataParser::IsOffhostAndSecureElementIsSIM(const ElementName &elementNam
 }
 
 void AppDataParser::GetPaymentAbilityInfos(std::vector<AbilityInfo> &paymentAbilityInfos)
+{
+    std::shared_ptr<const PaymentCatalog> catalog = GetPaymentCatalog();
+    paymentAbilityInfos.insert(paymentAbilityInfos.end(), catalog->abilityInfos.begin(), catalog->abilityInfos.end());
+}
+
+void AppDataParser::InvalidatePaymentCatalog()
+{
+    uint64_t version = paymentCatalogVersion_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    DebugLog("InvalidatePaymentCatalog: version %{public}llu", static_cast<unsigned long long>(version));
+}
+
+void AppDataParser::UpdatePaymentSimBundleName(const std::string &simBundleName)
+{
+    std::lock_guard<std::mutex> lock(paymentCatalogMutex_);
+    if (simBundleName == paymentSimBundleName_) {
+        return;
+    }
+    InfoLog("UpdatePaymentSimBundleName: %{public}s", simBundleName.c_str());
+    paymentSimBundleName_ = simBundleName;
+    InvalidatePaymentCatalog();
+}
+
+std::shared_ptr<const AppDataParser::PaymentCatalog> AppDataParser::GetPaymentCatalog()
 {
     InitAppList();
-    std::lock_guard<std::mutex> lock(g_mutex);
-    for (const AppDataParser::HceAppAidInfo &appAidInfo : g_hceAppAndAidMap) {
+    uint64_t version = paymentCatalogVersion_.load(std::memory_order_acquire);
+    std::shared_ptr<const PaymentCatalog> catalog = std::atomic_load_explicit(&paymentCatalog_,
+        std::memory_order_acquire);
+    if (catalog != nullptr && catalog->version == version) {
+        return catalog;
+    }
+    std::lock_guard<std::mutex> lock(paymentCatalogMutex_);
+    // another caller may have rebuilt it while waiting for the lock.
+    version = paymentCatalogVersion_.load(std::memory_order_acquire);
+    catalog = std::atomic_load_explicit(&paymentCatalog_, std::memory_order_acquire);
+    if (catalog != nullptr && catalog->version == version) {
+        return catalog;
+    }
+    // the version is taken before reading the apps, a change while building is rebuilt on the next query.
+    catalog = BuildPaymentCatalog(version);
+    std::atomic_store_explicit(&paymentCatalog_, catalog, std::memory_order_release);
+    return catalog;
+}
+
+std::shared_ptr<const AppDataParser::PaymentCatalog> AppDataParser::BuildPaymentCatalog(uint64_t version)
+{
+    auto catalog = std::make_shared<PaymentCatalog>();
+    catalog->version = version;
+    std::vector<AbilityInfo> &paymentAbilityInfos = catalog->abilityInfos;
+    std::shared_ptr<const AppTables> tables = GetAppTables();
+    for (const AppDataParser::HceAppAidInfo &appAidInfo : tables->hceApps) {
         if (!IsPaymentApp(appAidInfo)) {
             continue;
         }
@@ -818,24 +910,28 @@ void AppDataParser::GetPaymentAbilityInfos(std::vector<AbilityInfo> &paymentAbil
         ability.bundleName = appAidInfo.element.GetBundleName();
         ability.labelId = appAidInfo.labelId;
         ability.iconId = appAidInfo.iconId;
-        InfoLog("The bundlename : %{public}s,the labelId : %{public}d,the iconId : %{public}d",
-                ability.bundleName.c_str(), ability.labelId, ability.iconId);
+        DebugLog("The bundlename : %{public}s,the labelId : %{public}d,the iconId : %{public}d",
+                 ability.bundleName.c_str(), ability.labelId, ability.iconId);
         paymentAbilityInfos.push_back(ability);
     }
 
-    for (const AppDataParser::HceAppAidInfo &appAidInfo : g_offHostAppAndAidMap) {
+    for (const AppDataParser::HceAppAidInfo &appAidInfo : tables->offHostApps) {
         AbilityInfo ability;
         ability.name = appAidInfo.element.GetAbilityName();
         ability.bundleName = appAidInfo.element.GetBundleName();
         ability.labelId = appAidInfo.labelId;
         ability.iconId = appAidInfo.iconId;
-        InfoLog("The bundlename : %{public}s,the labelId : %{public}d,the iconId : %{public}d",
-                ability.bundleName.c_str(), ability.labelId, ability.iconId);
+        DebugLog("The bundlename : %{public}s,the labelId : %{public}d,the iconId : %{public}d",
+                 ability.bundleName.c_str(), ability.labelId, ability.iconId);
         paymentAbilityInfos.push_back(ability);
     }
 #ifdef VENDOR_APPLICATIONS_ENABLED
+    std::lock_guard<std::mutex> lock(g_mutex);
     GetPaymentAbilityInfosFromVendor(paymentAbilityInfos);
 #endif
+    InfoLog("BuildPaymentCatalog: version %{public}llu, %{public}zu payment services",
+        static_cast<unsigned long long>(version), paymentAbilityInfos.size());
+    return catalog;
 }
 
 bool AppDataParser::GetBundleInfo(AppExecFwk::BundleInfo &bundleInfo, const std::string &bundleName)
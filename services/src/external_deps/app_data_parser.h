@@ -14,8 +14,13 @@
 */
 #ifndef APP_DATA_PARSER_H
 #define APP_DATA_PARSER_H
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 #include "ability_info.h"
+#include "aid_key.h"
 #include "bundle_mgr_interface.h"
 #include "bundle_mgr_proxy.h"
 #include "common_event_subscriber.h"
@@ -33,9 +38,6 @@ namespace NFC {
 using AppExecFwk::AbilityInfo;
 using AppExecFwk::ExtensionAbilityInfo;
 using OHOS::AppExecFwk::ElementName;
-class BundleMgrDeathRecipient : public IRemoteObject::DeathRecipient {
-    void OnRemoteDied([[maybe_unused]] const wptr<IRemoteObject> &remote) override;
-};
 class AppDataParser {
 public:
     explicit AppDataParser();
@@ -60,6 +62,31 @@ public:
         std::vector<AidInfo> customDataAid;
     };
 
+    // an AID declared by the hce app at hceApps[hceAppIndex]
+    struct HceAidIndexEntry {
+        AidKey aid;
+        size_t hceAppIndex;
+    };
+    using HceAidIndex = std::vector<HceAidIndexEntry>;
+
+    // immutable view of the installed app tables, readers never take g_mutex to access it
+    struct AppTables {
+        std::vector<TagAppTechInfo> tagApps;
+        std::vector<HceAppAidInfo> hceApps;
+        std::vector<HceAppAidInfo> offHostApps;
+        HceAidIndex hceAidIndex; // sorted by AID, an app appears once per AID
+
+        // the range of hceAidIndex for the apps declaring the AID, no allocation
+        std::pair<HceAidIndex::const_iterator, HceAidIndex::const_iterator> FindHceApps(const AidKey &aid) const;
+    };
+
+    // the payment services built from the app tables and the vendor apps, shared by all the callers
+    struct PaymentCatalog {
+        uint64_t version = 0;
+        std::vector<AbilityInfo> abilityInfos;
+    };
+
+    // writer side working copy, only accessed under g_mutex and published through PublishAppTables
     std::vector<TagAppTechInfo> g_tagAppAndTechMap;
     std::vector<HceAppAidInfo> g_hceAppAndAidMap;
     std::vector<HceAppAidInfo> g_offHostAppAndAidMap;
@@ -83,12 +110,19 @@ public:
     bool IsBundleInstalled(const std::string &bundleName);
     void GetHceApps(std::vector<HceAppAidInfo> &hceApps);
     void GetPaymentAbilityInfos(std::vector<AbilityInfo> &paymentAbilityInfos);
+    std::shared_ptr<const PaymentCatalog> GetPaymentCatalog();
+    void InvalidatePaymentCatalog();
+    void UpdatePaymentSimBundleName(const std::string &simBundleName);
     bool GetBundleInfo(AppExecFwk::BundleInfo &bundleInfo, const std::string &bundleName);
     bool IsSystemApp(uint32_t uid);
     bool IsHceApp(const ElementName &elementName);
     bool IsOffhostAndSecureElementIsSIM(const ElementName &elementName);
     std::string GetBundleNameByUid(uint32_t uid);
+    std::shared_ptr<const AppTables> GetAppTables() const;
 private:
+    void PublishAppTables();
+    static void BuildHceAidIndex(AppTables &tables);
+    std::shared_ptr<const PaymentCatalog> BuildPaymentCatalog(uint64_t version);
     static sptr<AppExecFwk::IBundleMgr> GetBundleMgrProxy();
     ElementName GetMatchedTagKeyElement(ElementName &element);
     ElementName GetMatchedHceKeyElement(ElementName &element, int32_t appIndex);
@@ -113,6 +147,13 @@ private:
     sptr<IOnCardEmulationNotifyCb> onCardEmulationNotify_ {};
 #endif
     bool appListInitDone_ = false;
+    std::shared_ptr<const AppTables> appTables_ = std::make_shared<const AppTables>();
+    // starts from a random epoch and is bumped on every change of the apps or of the sim vendor bundle, the
+    // catalog of an older version is rebuilt on the next query
+    std::atomic<uint64_t> paymentCatalogVersion_ {0};
+    std::mutex paymentCatalogMutex_ {}; // serializes the rebuilds
+    std::string paymentSimBundleName_ {}; // guarded by paymentCatalogMutex_
+    std::shared_ptr<const PaymentCatalog> paymentCatalog_ {};
 };
 }  // namespace NFC
 }  // namespace OHOS
@@ -217,6 +217,12 @@ void ExternalDepsProxy::WriteDefaultRouteChangeHiSysEvent(int oldRoute, int newR
     NfcHisysEvent::WriteDefaultRouteChangeHiSysEvent(oldRoute, newRoute);
 }
 
+void ExternalDepsProxy::WriteAidRoutingTableHiSysEvent(int tableSize, int usedSize, int requestedCnt,
+                                                       int prefixCnt, int droppedCnt)
+{
+    NfcHisysEvent::WriteAidRoutingTableHiSysEvent(tableSize, usedSize, requestedCnt, prefixCnt, droppedCnt);
+}
+
 void ExternalDepsProxy::WriteShutDownNfcStateHiSysEvent(int nfcState, int nfcStateFromParam)
 {
     NfcHisysEvent::WriteShutDownNfcStateHiSysEvent(nfcState, nfcStateFromParam);
@@ -243,6 +249,13 @@ void ExternalDepsProxy::DispatchTagAbility(std::shared_ptr<KITS::TagInfo> tagInf
     TAG::TagAbilityDispatcher::DispatchTagAbility(tagInfo, tagServiceIface);
 }
 
+void ExternalDepsProxy::DispatchTagAbility(std::shared_ptr<KITS::TagInfo> tagInfo,
+                                           OHOS::sptr<IRemoteObject> tagServiceIface,
+                                           const std::vector<ElementName> &elements)
+{
+    TAG::TagAbilityDispatcher::DispatchTagAbility(tagInfo, tagServiceIface, elements);
+}
+
 bool ExternalDepsProxy::StartNotepadAbility(const std::string &notepadBundleName)
 {
     return TAG::TagAbilityDispatcher::StartNotepadAbility(notepadBundleName);
@@ -263,11 +276,31 @@ void ExternalDepsProxy::GetPaymentAbilityInfos(std::vector<AbilityInfo>& payment
     AppDataParser::GetInstance().GetPaymentAbilityInfos(paymentAbilityInfos);
 }
 
+std::shared_ptr<const AppDataParser::PaymentCatalog> ExternalDepsProxy::GetPaymentCatalog()
+{
+    return AppDataParser::GetInstance().GetPaymentCatalog();
+}
+
+void ExternalDepsProxy::InvalidatePaymentCatalog()
+{
+    AppDataParser::GetInstance().InvalidatePaymentCatalog();
+}
+
+void ExternalDepsProxy::UpdatePaymentSimBundleName(const std::string &simBundleName)
+{
+    AppDataParser::GetInstance().UpdatePaymentSimBundleName(simBundleName);
+}
+
 void ExternalDepsProxy::GetHceAppsByAid(const std::string& aid, std::vector<AppDataParser::HceAppAidInfo>& hceApps)
 {
     AppDataParser::GetInstance().GetHceAppsByAid(aid, hceApps);
 }
 
+std::shared_ptr<const AppDataParser::AppTables> ExternalDepsProxy::GetAppTables()
+{
+    return AppDataParser::GetInstance().GetAppTables();
+}
+
 void ExternalDepsProxy::GetHceApps(std::vector<AppDataParser::HceAppAidInfo>& hceApps)
 {
     AppDataParser::GetInstance().GetHceApps(hceApps);
@@ -84,6 +84,8 @@ public:
     void WriteFirmwareUpdateHiSysEvent(int requestCnt, int failCnt);
     void BuildFailedParams(NfcFailedParams &nfcFailedParams, MainErrorCode mainErrorCode, SubErrorCode subErrorCode);
     void WriteDefaultRouteChangeHiSysEvent(int oldRoute, int newRoute);
+    void WriteAidRoutingTableHiSysEvent(int tableSize, int usedSize, int requestedCnt, int prefixCnt,
+                                        int droppedCnt);
     void WriteShutDownNfcStateHiSysEvent(int nfcState, int nfcStateFromParam);
     void WriteAppBehaviorHiSysEvent(SubErrorCode behaviorCode, const std::string &appName);
     void WriteNfcHceCmdCbHiSysEvent(const std::string &appName, SubErrorCode subErrorCode);
@@ -91,11 +93,17 @@ public:
     bool IsGranted(std::string permission);
 
     void DispatchTagAbility(std::shared_ptr<KITS::TagInfo> tagInfo, OHOS::sptr<IRemoteObject> tagServiceIface);
+    void DispatchTagAbility(std::shared_ptr<KITS::TagInfo> tagInfo, OHOS::sptr<IRemoteObject> tagServiceIface,
+        const std::vector<ElementName> &elements);
     bool StartNotepadAbility(const std::string &notepadBundleName);
     void DispatchAppGallery(OHOS::sptr<IRemoteObject> tagServiceIface, std::string appGalleryBundleName);
     void StartVibratorOnce(bool isNtfPublished = false);
     void GetPaymentAbilityInfos(std::vector<AbilityInfo> &paymentAbilityInfos);
+    std::shared_ptr<const AppDataParser::PaymentCatalog> GetPaymentCatalog();
+    void InvalidatePaymentCatalog();
+    void UpdatePaymentSimBundleName(const std::string &simBundleName);
     void GetHceAppsByAid(const std::string &aid, std::vector<AppDataParser::HceAppAidInfo>& hceApps);
+    std::shared_ptr<const AppDataParser::AppTables> GetAppTables();
     void GetHceApps(std::vector<AppDataParser::HceAppAidInfo> &hceApps);
     bool IsSystemApp(uint32_t uid);
     bool IsHceApp(const ElementName &elementName);
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nfc_bundle_mgr_client.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include "iservice_registry.h"
+#include "loghelper.h"
+#include "system_ability_definition.h"
+
+namespace OHOS {
+namespace NFC {
+static const size_t MAX_CACHE_SIZE = 64; // each cache is cleared once full, the entries are few in practice
+static const char KEY_SEPARATOR = '/';
+
+static std::string GetBundleNameOfKey(const std::string &key)
+{
+    return key.substr(0, key.find(KEY_SEPARATOR));
+}
+
+static void DumpCacheStats(int fd, const char *name, uint64_t hits, uint64_t misses, size_t size)
+{
+    uint64_t total = hits + misses;
+    uint64_t hitRate = (total == 0) ? 0 : (hits * 100 / total); // 100 for percentage
+    dprintf(fd, "  %s: hits %" PRIu64 ", misses %" PRIu64 ", hit rate %" PRIu64 "%%, entries %zu\n",
+        name, hits, misses, hitRate, size);
+}
+
+NfcBundleMgrClient& NfcBundleMgrClient::GetInstance()
+{
+    static NfcBundleMgrClient bundleMgrClient;
+    return bundleMgrClient;
+}
+
+void NfcBundleMgrClient::DeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
+{
+    InfoLog("bundleMgrService dead");
+    NfcBundleMgrClient::GetInstance().OnBundleMgrDied();
+}
+
+sptr<AppExecFwk::IBundleMgr> NfcBundleMgrClient::GetBundleMgrProxy()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (bundleMgrProxy_ != nullptr) {
+            proxyStats_.hits++;
+            return bundleMgrProxy_;
+        }
+        proxyStats_.misses++;
+        if (deathRecipient_ == nullptr) {
+            deathRecipient_ = new (std::nothrow) DeathRecipient();
+        }
+    }
+    // resolve without holding the lock, the cached queries are not blocked by the ipc.
+    sptr<ISystemAbilityManager> systemAbilityManager =
+        SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (!systemAbilityManager) {
+        ErrorLog("GetBundleMgrProxy, systemAbilityManager is null");
+        return nullptr;
+    }
+    sptr<IRemoteObject> remoteObject = systemAbilityManager->GetSystemAbility(BUNDLE_MGR_SERVICE_SYS_ABILITY_ID);
+    if (!remoteObject) {
+        ErrorLog("GetBundleMgrProxy, remoteObject is null");
+        return nullptr;
+    }
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = iface_cast<AppExecFwk::IBundleMgr>(remoteObject);
+    if (bundleMgrProxy == nullptr || bundleMgrProxy->AsObject() == nullptr) {
+        ErrorLog("GetBundleMgrProxy, bundleMgrProxy is nullptr");
+        return nullptr;
+    }
+    // the proxy is only kept if its death can be noticed, otherwise it is resolved on every call.
+    if (deathRecipient_ != nullptr && bundleMgrProxy->AsObject()->AddDeathRecipient(deathRecipient_)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bundleMgrProxy_ = bundleMgrProxy;
+    }
+    return bundleMgrProxy;
+}
+
+void NfcBundleMgrClient::OnBundleMgrDied()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    bundleMgrProxy_ = nullptr;
+    proxyDeaths_++;
+    ClearCachesLocked();
+}
+
+bool NfcBundleMgrClient::QueryAbilityInfo(const AppExecFwk::ElementName &element, int32_t userId,
+    AppExecFwk::AbilityInfo &abilityInfo)
+{
+    std::string key = element.GetBundleName() + KEY_SEPARATOR + element.GetModuleName() + KEY_SEPARATOR +
+        element.GetAbilityName() + KEY_SEPARATOR + std::to_string(userId);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = abilityInfoCache_.find(key);
+        if (iter != abilityInfoCache_.end()) {
+            abilityInfoStats_.hits++;
+            abilityInfo = iter->second;
+            return true;
+        }
+        abilityInfoStats_.misses++;
+    }
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = GetBundleMgrProxy();
+    if (bundleMgrProxy == nullptr) {
+        ErrorLog("QueryAbilityInfo, bundleMgrProxy is nullptr.");
+        return false;
+    }
+    AAFwk::Want want;
+    want.SetElement(element);
+    if (!bundleMgrProxy->QueryAbilityInfo(want, AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_DEFAULT,
+        userId, abilityInfo)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (abilityInfoCache_.size() >= MAX_CACHE_SIZE) {
+        abilityInfoCache_.clear();
+    }
+    abilityInfoCache_[key] = abilityInfo;
+    return true;
+}
+
+int32_t NfcBundleMgrClient::GetLaunchWantForBundle(const std::string &bundleName, int32_t userId,
+    AAFwk::Want &want)
+{
+    std::string key = bundleName + KEY_SEPARATOR + std::to_string(userId);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = launchWantCache_.find(key);
+        if (iter != launchWantCache_.end()) {
+            launchWantStats_.hits++;
+            want = iter->second;
+            return ERR_OK;
+        }
+        launchWantStats_.misses++;
+    }
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = GetBundleMgrProxy();
+    if (bundleMgrProxy == nullptr) {
+        ErrorLog("GetLaunchWantForBundle, bundleMgrProxy is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+    int32_t errCode = bundleMgrProxy->GetLaunchWantForBundle(bundleName, want, userId);
+    if (errCode != ERR_OK) {
+        return errCode;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (launchWantCache_.size() >= MAX_CACHE_SIZE) {
+        launchWantCache_.clear();
+    }
+    launchWantCache_[key] = want;
+    return ERR_OK;
+}
+
+bool NfcBundleMgrClient::ImplicitQueryInfos(const AAFwk::Want &want, int32_t userId)
+{
+    // the result depends on the action, the mime type and the uri scheme only.
+    std::string key = want.GetAction() + KEY_SEPARATOR + want.GetType() + KEY_SEPARATOR +
+        want.GetUri().GetScheme() + KEY_SEPARATOR + std::to_string(userId);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = implicitQueryCache_.find(key);
+        if (iter != implicitQueryCache_.end()) {
+            implicitQueryStats_.hits++;
+            return iter->second;
+        }
+        implicitQueryStats_.misses++;
+    }
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = GetBundleMgrProxy();
+    if (bundleMgrProxy == nullptr) {
+        ErrorLog("ImplicitQueryInfos, bundleMgrProxy is nullptr.");
+        return false;
+    }
+    bool withDefault = false;
+    auto abilityInfoFlag = AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_DEFAULT
+        | AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_SKILL_URI
+        | AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_METADATA;
+    std::vector<AppExecFwk::AbilityInfo> abilityInfos;
+    std::vector<AppExecFwk::ExtensionAbilityInfo> extensionInfos;
+    bool findDefaultApp = false;
+    bool result = bundleMgrProxy->ImplicitQueryInfos(
+        want, abilityInfoFlag, userId, withDefault, abilityInfos, extensionInfos, findDefaultApp);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (implicitQueryCache_.size() >= MAX_CACHE_SIZE) {
+        implicitQueryCache_.clear();
+    }
+    implicitQueryCache_[key] = result;
+    return result;
+}
+
+void NfcBundleMgrClient::InvalidateBundle(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto iter = abilityInfoCache_.begin(); iter != abilityInfoCache_.end();) {
+        iter = (GetBundleNameOfKey(iter->first) == bundleName) ? abilityInfoCache_.erase(iter) : std::next(iter);
+    }
+    for (auto iter = launchWantCache_.begin(); iter != launchWantCache_.end();) {
+        iter = (GetBundleNameOfKey(iter->first) == bundleName) ? launchWantCache_.erase(iter) : std::next(iter);
+    }
+    // any package may add or remove a handler of the mime type or the uri scheme.
+    implicitQueryCache_.clear();
+}
+
+void NfcBundleMgrClient::ClearCachesLocked()
+{
+    abilityInfoCache_.clear();
+    launchWantCache_.clear();
+    implicitQueryCache_.clear();
+}
+
+void NfcBundleMgrClient::Dump(int fd) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    dprintf(fd, "Bundle manager client:\n");
+    dprintf(fd, "  proxy: %s, deaths %" PRIu64 "\n", (bundleMgrProxy_ != nullptr) ? "cached" : "none", proxyDeaths_);
+    DumpCacheStats(fd, "proxy", proxyStats_.hits, proxyStats_.misses, (bundleMgrProxy_ != nullptr) ? 1 : 0);
+    DumpCacheStats(fd, "ability info", abilityInfoStats_.hits, abilityInfoStats_.misses, abilityInfoCache_.size());
+    DumpCacheStats(fd, "launch want", launchWantStats_.hits, launchWantStats_.misses, launchWantCache_.size());
+    DumpCacheStats(fd, "implicit query", implicitQueryStats_.hits, implicitQueryStats_.misses,
+        implicitQueryCache_.size());
+}
+}  // namespace NFC
+}  // namespace OHOS
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NFC_BUNDLE_MGR_CLIENT_H
+#define NFC_BUNDLE_MGR_CLIENT_H
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ability_info.h"
+#include "bundle_mgr_interface.h"
+#include "element_name.h"
+#include "want.h"
+
+namespace OHOS {
+namespace NFC {
+/**
+ * @brief The bundle manager client shared by the service. It holds the bundle manager proxy until the bundle
+ * manager dies, and memoizes the frequent read-only queries until the package of the result changes.
+ */
+class NfcBundleMgrClient final {
+public:
+    static NfcBundleMgrClient& GetInstance();
+
+    sptr<AppExecFwk::IBundleMgr> GetBundleMgrProxy();
+    void OnBundleMgrDied();
+
+    // query the ability info of the element with GET_ABILITY_INFO_DEFAULT.
+    bool QueryAbilityInfo(const AppExecFwk::ElementName &element, int32_t userId,
+        AppExecFwk::AbilityInfo &abilityInfo);
+    // get the launch want of the bundle, returns the error code of the bundle manager.
+    int32_t GetLaunchWantForBundle(const std::string &bundleName, int32_t userId, AAFwk::Want &want);
+    // query the abilities can handle the mime type and the uri scheme of the want, the result is not returned.
+    bool ImplicitQueryInfos(const AAFwk::Want &want, int32_t userId);
+
+    // drop the cached results of the bundle, called on the package added, changed and removed events.
+    void InvalidateBundle(const std::string &bundleName);
+    void Dump(int fd) const;
+
+private:
+    NfcBundleMgrClient() = default;
+    ~NfcBundleMgrClient() = default;
+
+    class DeathRecipient : public IRemoteObject::DeathRecipient {
+    public:
+        void OnRemoteDied(const wptr<IRemoteObject> &remote) override;
+    };
+
+    struct CacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    void ClearCachesLocked();
+
+    mutable std::mutex mutex_ {};
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy_ = nullptr;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient_ = nullptr;
+    std::map<std::string, AppExecFwk::AbilityInfo> abilityInfoCache_ {};
+    std::map<std::string, AAFwk::Want> launchWantCache_ {};
+    std::map<std::string, bool> implicitQueryCache_ {};
+    CacheStats proxyStats_ {};
+    CacheStats abilityInfoStats_ {};
+    CacheStats launchWantStats_ {};
+    CacheStats implicitQueryStats_ {};
+    uint64_t proxyDeaths_ = 0;
+};
+}  // namespace NFC
+}  // namespace OHOS
+#endif  // NFC_BUNDLE_MGR_CLIENT_H
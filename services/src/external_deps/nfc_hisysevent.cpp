@@ -146,6 +146,16 @@ void NfcHisysEvent::WriteDefaultRouteChangeHiSysEvent(int oldRoute, int newRoute
                "NEW_DEFAULT_ROUTE", newRoute);
 }
 
+void NfcHisysEvent::WriteAidRoutingTableHiSysEvent(int tableSize, int usedSize, int requestedCnt, int prefixCnt,
+                                                   int droppedCnt)
+{
+    InfoLog("WriteAidRoutingTableHiSysEvent, usedSize[%{public}d], tableSize[%{public}d], droppedCnt[%{public}d]",
+        usedSize, tableSize, droppedCnt);
+    WriteEvent("HCE_AID_ROUTING_TABLE", HiviewDFX::HiSysEvent::EventType::STATISTIC,
+               "TABLE_SIZE", tableSize, "USED_SIZE", usedSize, "REQUESTED_AID_CNT", requestedCnt,
+               "PREFIX_ENTRY_CNT", prefixCnt, "DROPPED_AID_CNT", droppedCnt);
+}
+
 void NfcHisysEvent::WriteShutDownNfcStateHiSysEvent(int nfcState, int nfcStateFromParam)
 {
     InfoLog("WriteShutDownNfcStateHiSysEvent, nfcState = %{public}d, nfcStateFromParam = %{public}d",
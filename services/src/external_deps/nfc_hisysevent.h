@@ -96,6 +96,8 @@ public:
     static void WriteShutDownNfcStateHiSysEvent(int nfcState, int nfcStateFromParam);
     static void WriteAppBehaviorHiSysEvent(SubErrorCode behaviorCode, const std::string &appName);
     static void WriteNfcHceCmdCbHiSysEvent(const std::string &appName, SubErrorCode subErrorCode);
+    static void WriteAidRoutingTableHiSysEvent(int tableSize, int usedSize, int requestedCnt, int prefixCnt,
+                                               int droppedCnt);
 };
 }  // namespace NFC
 }  // namespace OHOS
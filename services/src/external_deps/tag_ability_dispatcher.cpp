@@ -17,10 +17,9 @@
 #include "app_data_parser.h"
 #include "external_deps_proxy.h"
 #include "loghelper.h"
+#include "nfc_bundle_mgr_client.h"
 #include "nfc_sdk_common.h"
 #include "vibrator_agent.h"
-#include "iservice_registry.h"
-#include "system_ability_definition.h"
 
 namespace OHOS {
 namespace NFC {
@@ -51,31 +50,31 @@ void TagAbilityDispatcher::SetWantExtraParam(const std::shared_ptr<KITS::TagInfo
 
     std::vector<int> techList = tagInfo->GetTagTechList();
     for (size_t i = 0; i < techList.size(); i++) {
-        AppExecFwk::PacMap extra = tagInfo->GetTechExtrasByIndex(i);
+        KITS::TagTechExtras extra = tagInfo->GetTechExtrasAt(i);
         if (techList[i] == static_cast<int>(TagTechnology::NFC_A_TECH)) {
-            want.SetParam(KITS::TagInfo::SAK, extra.GetIntValue(KITS::TagInfo::SAK, 0));
-            want.SetParam(KITS::TagInfo::ATQA, extra.GetStringValue(KITS::TagInfo::ATQA, ""));
+            want.SetParam(KITS::TagInfo::SAK, extra.GetIntValue(KITS::TagTechExtras::SAK, 0));
+            want.SetParam(KITS::TagInfo::ATQA, extra.GetStringValue(KITS::TagTechExtras::ATQA, ""));
         } else if (techList[i] == static_cast<int>(TagTechnology::NFC_B_TECH)) {
-            want.SetParam(KITS::TagInfo::APP_DATA, extra.GetStringValue(KITS::TagInfo::APP_DATA, ""));
-            want.SetParam(KITS::TagInfo::PROTOCOL_INFO, extra.GetStringValue(KITS::TagInfo::PROTOCOL_INFO, ""));
+            want.SetParam(KITS::TagInfo::APP_DATA, extra.GetStringValue(KITS::TagTechExtras::APP_DATA, ""));
+            want.SetParam(KITS::TagInfo::PROTOCOL_INFO, extra.GetStringValue(KITS::TagTechExtras::PROTOCOL_INFO, ""));
         } else if (techList[i] == static_cast<int>(TagTechnology::NFC_F_TECH)) {
-            want.SetParam(KITS::TagInfo::NFCF_SC, extra.GetStringValue(KITS::TagInfo::NFCF_SC, ""));
-            want.SetParam(KITS::TagInfo::NFCF_PMM, extra.GetStringValue(KITS::TagInfo::NFCF_PMM, ""));
+            want.SetParam(KITS::TagInfo::NFCF_SC, extra.GetStringValue(KITS::TagTechExtras::NFCF_SC, ""));
+            want.SetParam(KITS::TagInfo::NFCF_PMM, extra.GetStringValue(KITS::TagTechExtras::NFCF_PMM, ""));
         } else if (techList[i] == static_cast<int>(TagTechnology::NFC_V_TECH)) {
-            want.SetParam(KITS::TagInfo::RESPONSE_FLAGS, extra.GetIntValue(KITS::TagInfo::RESPONSE_FLAGS, 0));
-            want.SetParam(KITS::TagInfo::DSF_ID, extra.GetIntValue(KITS::TagInfo::DSF_ID, 0));
+            want.SetParam(KITS::TagInfo::RESPONSE_FLAGS, extra.GetIntValue(KITS::TagTechExtras::RESPONSE_FLAGS, 0));
+            want.SetParam(KITS::TagInfo::DSF_ID, extra.GetIntValue(KITS::TagTechExtras::DSF_ID, 0));
         } else if (techList[i] == static_cast<int>(TagTechnology::NFC_ISODEP_TECH)) {
-            want.SetParam(KITS::TagInfo::HISTORICAL_BYTES, extra.GetStringValue(KITS::TagInfo::HISTORICAL_BYTES, ""));
-            want.SetParam(KITS::TagInfo::HILAYER_RESPONSE, extra.GetStringValue(KITS::TagInfo::HILAYER_RESPONSE, ""));
+            want.SetParam(KITS::TagInfo::HISTORICAL_BYTES, extra.GetStringValue(KITS::TagTechExtras::HISTORICAL_BYTES, ""));
+            want.SetParam(KITS::TagInfo::HILAYER_RESPONSE, extra.GetStringValue(KITS::TagTechExtras::HILAYER_RESPONSE, ""));
         } else if (techList[i] == static_cast<int>(TagTechnology::NFC_MIFARE_ULTRALIGHT_TECH)) {
             want.SetParam(KITS::TagInfo::MIFARE_ULTRALIGHT_C_TYPE,
-                extra.GetBooleanValue(KITS::TagInfo::MIFARE_ULTRALIGHT_C_TYPE, false));
+                extra.GetIntValue(KITS::TagTechExtras::MIFARE_ULTRALIGHT_C_TYPE, 0) != 0);
         } else if (techList[i] == static_cast<int>(TagTechnology::NFC_NDEF_TECH)) {
             // set ndef message/type/max size/read mode for ndef tag
-            want.SetParam(KITS::TagInfo::NDEF_MSG, extra.GetStringValue(KITS::TagInfo::NDEF_MSG, ""));
-            want.SetParam(KITS::TagInfo::NDEF_FORUM_TYPE, extra.GetIntValue(KITS::TagInfo::NDEF_FORUM_TYPE, 0));
-            want.SetParam(KITS::TagInfo::NDEF_TAG_LENGTH, extra.GetIntValue(KITS::TagInfo::NDEF_TAG_LENGTH, 0));
-            want.SetParam(KITS::TagInfo::NDEF_TAG_MODE, extra.GetIntValue(KITS::TagInfo::NDEF_TAG_MODE, 0));
+            want.SetParam(KITS::TagInfo::NDEF_MSG, extra.GetStringValue(KITS::TagTechExtras::NDEF_MSG, ""));
+            want.SetParam(KITS::TagInfo::NDEF_FORUM_TYPE, extra.GetIntValue(KITS::TagTechExtras::NDEF_FORUM_TYPE, 0));
+            want.SetParam(KITS::TagInfo::NDEF_TAG_LENGTH, extra.GetIntValue(KITS::TagTechExtras::NDEF_TAG_LENGTH, 0));
+            want.SetParam(KITS::TagInfo::NDEF_TAG_MODE, extra.GetIntValue(KITS::TagTechExtras::NDEF_TAG_MODE, 0));
         }
     }
 }
@@ -101,10 +100,19 @@ void TagAbilityDispatcher::DispatchTagAbility(const std::shared_ptr<KITS::TagInf
     if (tagServiceIface == nullptr) {
         WarnLog("DispatchTagAbility tagServiceIface is null");
     }
+    DispatchTagAbility(tagInfo, tagServiceIface,
+        AppDataParser::GetInstance().GetDispatchTagAppsByTech(tagInfo->GetTagTechList()));
+}
 
-    std::vector<int> techList = tagInfo->GetTagTechList();
-    std::vector<ElementName> elements = AppDataParser::GetInstance().GetDispatchTagAppsByTech(techList);
+void TagAbilityDispatcher::DispatchTagAbility(const std::shared_ptr<KITS::TagInfo>& tagInfo,
+    OHOS::sptr<IRemoteObject> tagServiceIface, const std::vector<ElementName>& elements)
+{
+    if (tagInfo == nullptr) {
+        ErrorLog("DispatchTagAbility tagInfo is null");
+        return;
+    }
 #ifdef VENDOR_APPLICATIONS_ENABLED
+    std::vector<int> techList = tagInfo->GetTagTechList();
     std::vector<ElementName> vendorElements = AppDataParser::GetInstance().GetVendorDispatchTagAppsByTech(techList);
     if (elements.size() == 0 && vendorElements.size() == 0) {
         ExternalDepsProxy::GetInstance().PublishNfcNotification(NFC_NO_HAP_SUPPORTED_NOTIFICATION_ID, "", 0);
@@ -200,23 +208,7 @@ bool TagAbilityDispatcher::StartNotepadAbility(const std::string &notepadBundleN
 {
     AAFwk::Want want;
     const int USER_ID = 100;
-    sptr<ISystemAbilityManager> systemAbilityManager =
-        SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (!systemAbilityManager) {
-        ErrorLog("NfcGetBundleMgrProxy, systemAbilityManager is null");
-        return false;
-    }
-    sptr<IRemoteObject> remoteObject = systemAbilityManager->GetSystemAbility(BUNDLE_MGR_SERVICE_SYS_ABILITY_ID);
-    if (!remoteObject) {
-        ErrorLog("NfcGetBundleMgrProxy, remoteObject is null");
-        return false;
-    }
-    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = iface_cast<AppExecFwk::IBundleMgr>(remoteObject);
-    if (bundleMgrProxy == nullptr) {
-        ErrorLog("QueryAbilityInfos, bundleMgrProxy is nullptr.");
-        return false;
-    }
-    int32_t errCode = bundleMgrProxy->GetLaunchWantForBundle(notepadBundleName, want, USER_ID);
+    int32_t errCode = NfcBundleMgrClient::GetInstance().GetLaunchWantForBundle(notepadBundleName, USER_ID, want);
     if (errCode) {
         InfoLog("GetLaunchWantForBundle fail. ret = %{public}d", errCode);
         return false;
@@ -32,6 +32,9 @@ public:
     static void SetWantExtraParam(const std::shared_ptr<KITS::TagInfo>& tagInfo, AAFwk::Want& want);
     static void DispatchTagAbility(
         const std::shared_ptr<KITS::TagInfo>& tagInfo, OHOS::sptr<IRemoteObject> tagServiceIface);
+    // dispatch to the apps already resolved by the techs of the tag.
+    static void DispatchTagAbility(const std::shared_ptr<KITS::TagInfo>& tagInfo,
+        OHOS::sptr<IRemoteObject> tagServiceIface, const std::vector<AppExecFwk::ElementName>& elements);
     static bool StartNotepadAbility(const std::string &notepadBundleName);
     static void DispatchAbilityMultiApp(const std::shared_ptr<KITS::TagInfo>& tagInfo, AAFwk::Want& want);
     static void DispatchAppGallery(OHOS::sptr<IRemoteObject> tagServiceIface, std::string appGalleryBundleName);
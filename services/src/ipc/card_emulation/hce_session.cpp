@@ -16,6 +16,7 @@
 #include "hce_session.h"
 
 #include "accesstoken_kit.h"
+#include "ce_capture_ring.h"
 #include "external_deps_proxy.h"
 #include "hce_cmd_death_recipient.h"
 #include "ipc_skeleton.h"
@@ -25,6 +26,8 @@ namespace OHOS {
 namespace NFC {
 namespace HCE {
 using OHOS::AppExecFwk::ElementName;
+// the records of one call, the caller continues from the sequence of the last one.
+static const size_t MAX_CE_CAPTURE_RECORDS = 128;
 
 HceSession::HceSession(std::shared_ptr<INfcService> service) : nfcService_(service)
 {
@@ -272,6 +275,12 @@ bool IsSystemSA()
 }
 
 ErrCode HceSession::GetPaymentServices(CePaymentServicesParcelable& parcelable)
+{
+    // the versions of the catalog are never 0, the whole catalog is returned.
+    return GetPaymentServicesIfChanged(0, parcelable);
+}
+
+ErrCode HceSession::GetPaymentServicesIfChanged(uint64_t knownVersion, CePaymentServicesParcelable& parcelable)
 {
     if (!ExternalDepsProxy::GetInstance().IsGranted(OHOS::NFC::CARD_EMU_PERM)) {
         ErrorLog("GetPaymentServices, ERR_NO_PERMISSION");
@@ -283,22 +292,62 @@ ErrCode HceSession::GetPaymentServices(CePaymentServicesParcelable& parcelable)
         return KITS::ERR_NOT_SYSTEM_APP;
     }
 
-    ExternalDepsProxy::GetInstance().GetPaymentAbilityInfos(parcelable.paymentAbilityInfos);
 #ifdef NFC_SIM_FEATURE
-    AppendSimBundle(parcelable.paymentAbilityInfos);
+    // the sim bundle is served with the catalog, a change of it bumps the version too.
+    std::string simBundleName = GetSimVendorBundleName();
+    ExternalDepsProxy::GetInstance().UpdatePaymentSimBundleName(simBundleName);
+#endif
+    std::shared_ptr<const AppDataParser::PaymentCatalog> catalog =
+        ExternalDepsProxy::GetInstance().GetPaymentCatalog();
+    parcelable.version = catalog->version;
+    if (knownVersion == catalog->version) {
+        DebugLog("GetPaymentServices: version %{public}llu unchanged", static_cast<unsigned long long>(knownVersion));
+        parcelable.isUnchanged = true;
+        return KITS::ERR_NONE;
+    }
+    parcelable.paymentAbilityInfos = catalog->abilityInfos;
+#ifdef NFC_SIM_FEATURE
+    AppendSimBundle(simBundleName, parcelable.paymentAbilityInfos);
 #endif
     return KITS::ERR_NONE;
 }
 
+ErrCode HceSession::GetCeCapture(uint64_t sinceSequence, std::vector<std::string>& records)
+{
+    if (!ExternalDepsProxy::GetInstance().IsGranted(OHOS::NFC::CARD_EMU_PERM)) {
+        ErrorLog("GetCeCapture, ERR_NO_PERMISSION");
+        return KITS::ERR_NO_PERMISSION;
+    }
+
+    if (!(ExternalDepsProxy::GetInstance().IsSystemApp(IPCSkeleton::GetCallingUid()) || IsSystemSA())) {
+        ErrorLog("GetCeCapture, ERR_NOT_SYSTEM_APP");
+        return KITS::ERR_NOT_SYSTEM_APP;
+    }
+
+    std::vector<CeCaptureRing::CaptureRecord> captured =
+        CeCaptureRing::GetInstance().GetRecords(sinceSequence, MAX_CE_CAPTURE_RECORDS);
+    records.reserve(captured.size());
+    for (const CeCaptureRing::CaptureRecord& record : captured) {
+        records.push_back(CeCaptureRing::FormatRecord(record));
+    }
+    DebugLog("GetCeCapture: %{public}zu records since %{public}llu", records.size(),
+        static_cast<unsigned long long>(sinceSequence));
+    return KITS::ERR_NONE;
+}
+
 #ifdef NFC_SIM_FEATURE
-void HceSession::AppendSimBundle(std::vector<AbilityInfo> &paymentAbilityInfos)
+std::string HceSession::GetSimVendorBundleName()
 {
     auto nfcServicePtr = nfcService_.lock();
     if (nfcServicePtr == nullptr) {
         ErrorLog("nfcService_ nullptr");
-        return;
+        return "";
     }
-    std::string simBundleName = nfcServicePtr->GetSimVendorBundleName();
+    return nfcServicePtr->GetSimVendorBundleName();
+}
+
+void HceSession::AppendSimBundle(const std::string &simBundleName, std::vector<AbilityInfo> &paymentAbilityInfos)
+{
     AppExecFwk::BundleInfo bundleInfo;
     bool result = ExternalDepsProxy::GetInstance().GetBundleInfo(bundleInfo, simBundleName);
     if (!result) {
@@ -51,6 +51,10 @@ public:
 
     ErrCode GetPaymentServices(CePaymentServicesParcelable& parcelable) override;
 
+    ErrCode GetPaymentServicesIfChanged(uint64_t knownVersion, CePaymentServicesParcelable& parcelable) override;
+
+    ErrCode GetCeCapture(uint64_t sinceSequence, std::vector<std::string>& records) override;
+
     ErrCode IsDefaultService(const ElementName& element, const std::string& type, bool& isDefaultService) override;
 
     ErrCode StartHce(const ElementName& element, const std::vector<std::string>& aids) override;
@@ -61,7 +65,8 @@ public:
 
 private:
 #ifdef NFC_SIM_FEATURE
-    void AppendSimBundle(std::vector<AbilityInfo> &paymentAbilityInfos);
+    std::string GetSimVendorBundleName();
+    void AppendSimBundle(const std::string &simBundleName, std::vector<AbilityInfo> &paymentAbilityInfos);
 #endif
 
     std::weak_ptr<NFC::INfcService> nfcService_{};
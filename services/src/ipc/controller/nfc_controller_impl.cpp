@@ -20,6 +20,7 @@
 #include "nfc_service.h"
 #include "loghelper.h"
 #include "external_deps_proxy.h"
+#include "nfc_bundle_mgr_client.h"
 #include "parameter.h"
 
 namespace OHOS {
@@ -319,5 +320,28 @@ ErrCode NfcControllerImpl::VendorRefreshRoutes()
 #endif
     return KITS::ERR_NONE;
 }
+
+int NfcControllerImpl::Dump(int fd, const std::vector<std::u16string>& args)
+{
+    if (fd < 0) {
+        ErrorLog("Dump, invalid fd");
+        return KITS::ERR_NFC_PARAMETERS;
+    }
+    NfcBundleMgrClient::GetInstance().Dump(fd);
+    auto nfcServicePtr = nfcService_.lock();
+    if (nfcServicePtr != nullptr) {
+        if (nfcServicePtr->eventHandler_ != nullptr) {
+            nfcServicePtr->eventHandler_->Dump(fd);
+        }
+        if (nfcServicePtr->ceService_ != nullptr) {
+            nfcServicePtr->ceService_->Dump(fd);
+        }
+        auto nciNfccProxyPtr = nfcServicePtr->GetNciNfccProxy().lock();
+        if (nciNfccProxyPtr != nullptr) {
+            nciNfccProxyPtr->Dump(fd);
+        }
+    }
+    return KITS::ERR_NONE;
+}
 }  // namespace NFC
 }  // namespace OHOS
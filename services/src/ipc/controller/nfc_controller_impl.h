@@ -51,6 +51,7 @@ public:
 
     void RemoveNfcDeathRecipient(const wptr<IRemoteObject> &remote);
     ErrCode VendorRefreshRoutes() override;
+    int Dump(int fd, const std::vector<std::u16string>& args) override;
 
 private:
     std::weak_ptr<NfcService> nfcService_ = {};
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tag_operation_callback_proxy.h"
+#include "loghelper.h"
+#include "nfc_service_ipc_interface_code.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TAG {
+TagOperationCallbackProxy::TagOperationCallbackProxy(const sptr<IRemoteObject> &remote)
+    : IRemoteProxy<KITS::ITagOperationCallback>(remote)
+{}
+
+void TagOperationCallbackProxy::OnTagOperationComplete(int errorCode, const std::string& hexRespData)
+{
+    DebugLog("TagOperationCallbackProxy::OnTagOperationComplete, errorCode = %{public}d", errorCode);
+    MessageOption option = {MessageOption::TF_ASYNC};
+    MessageParcel data;
+    MessageParcel reply;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        ErrorLog("Write interface token error");
+        return;
+    }
+    data.WriteInt32(0);
+    data.WriteInt32(errorCode);
+    data.WriteString(hexRespData);
+
+    auto remote = Remote();
+    if (remote == nullptr) {
+        ErrorLog("remote nullptr");
+        return;
+    }
+    int error = remote->SendRequest(
+        static_cast<uint32_t>(NfcServiceIpcInterfaceCode::COMMAND_TAG_OPERATION_COMPLETE), data, reply, option);
+    if (error != ERR_NONE) {
+        ErrorLog("notify COMMAND_TAG_OPERATION_COMPLETE failed, error code is %{public}d", error);
+    }
+}
+}  // namespace TAG
+}  // namespace NFC
+}  // namespace OHOS
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TAG_OPERATION_CALLBACK_PROXY_H
+#define TAG_OPERATION_CALLBACK_PROXY_H
+
+#include "itag_operation_callback.h"
+#include "iremote_proxy.h"
+#include "message_parcel.h"
+#include "nfc_sdk_common.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TAG {
+class TagOperationCallbackProxy : public IRemoteProxy<KITS::ITagOperationCallback> {
+public:
+    explicit TagOperationCallbackProxy(const sptr<IRemoteObject> &remote);
+
+    virtual ~TagOperationCallbackProxy() {}
+
+    void OnTagOperationComplete(int errorCode, const std::string& hexRespData) override;
+
+private:
+    static inline BrokerDelegator<TagOperationCallbackProxy> g_delegator;
+};
+}  // namespace TAG
+}  // namespace NFC
+}  // namespace OHOS
+#endif
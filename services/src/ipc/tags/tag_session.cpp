@@ -18,6 +18,7 @@
 #include "external_deps_proxy.h"
 #include "ipc_skeleton.h"
 #include "loghelper.h"
+#include "tag_tech_traits.h"
 
 namespace OHOS {
 namespace NFC {
@@ -26,8 +27,8 @@ using OHOS::AppExecFwk::ElementName;
 
 // NFC_A = 1 ~ NDEF_FORMATABLE = 10
 const int MAX_TECH = 12;
+const size_t MAX_TRANSCEIVE_BATCH_SIZE = 16;
 int g_techTimeout[MAX_TECH] = {0};
-int g_maxTransLength[MAX_TECH] = {0, 253, 253, 0xFEFF, 255, 253, 0, 0, 253, 253, 0, 0};
 std::shared_ptr<AppStateObserver> g_appStateObserver = nullptr;
 
 TagSession::TagSession(std::shared_ptr<NfcService> service)
@@ -388,6 +389,109 @@ ErrCode TagSession::SendRawFrame(int32_t tagRfDiscId, const std::string& hexCmdD
     return KITS::ERR_TAG_STATE_IO_FAILED;
 }
 
+ErrCode TagSession::SendRawFrameBytes(int32_t tagRfDiscId, const std::vector<uint8_t>& cmdData, bool raw,
+    std::vector<uint8_t>& respData)
+{
+    // the native transceive works on hex string, convert once here instead of in every caller.
+    std::string hexCmdData = KITS::NfcSdkCommon::BytesVecToHexString(cmdData.data(), cmdData.size());
+    std::string hexRespData;
+    ErrCode result = SendRawFrame(tagRfDiscId, hexCmdData, raw, hexRespData);
+    respData.clear();
+    if (result == KITS::ERR_NONE) {
+        KITS::NfcSdkCommon::HexStringToBytes(hexRespData, respData);
+    }
+    return result;
+}
+
+ErrCode TagSession::SendRawFrameBatch(int32_t tagRfDiscId, const std::vector<int32_t>& rfDiscIds,
+    const std::vector<std::string>& hexCmds, std::vector<std::string>& hexResps, std::vector<int32_t>& results)
+{
+    hexResps.clear();
+    results.clear();
+    if (!ExternalDepsProxy::GetInstance().IsGranted(OHOS::NFC::TAG_PERM)) {
+        ErrorLog("SendRawFrameBatch, ERR_NO_PERMISSION");
+        return KITS::ERR_NO_PERMISSION;
+    }
+    if (hexCmds.empty() || hexCmds.size() > MAX_TRANSCEIVE_BATCH_SIZE || rfDiscIds.size() != hexCmds.size()) {
+        ErrorLog("SendRawFrameBatch, invalid batch size %{public}zu", hexCmds.size());
+        return KITS::ERR_TAG_PARAMETERS;
+    }
+
+    // Check if NFC is enabled
+    auto nfcServicePtr = nfcService_.lock();
+    auto nciTagProxyPtr = nciTagProxy_.lock();
+    if ((nfcServicePtr == nullptr) || (nciTagProxyPtr == nullptr)) {
+        ErrorLog("SendRawFrameBatch nfcService or nciTagProxy is nullptr");
+        return KITS::ERR_TAG_STATE_UNBIND;
+    }
+    if (!nfcServicePtr->IsNfcEnabled()) {
+        ErrorLog("SendRawFrameBatch, IsNfcEnabled error");
+        return KITS::ERR_TAG_STATE_NFC_CLOSED;
+    }
+
+    // Check if length is within limits
+    int maxSize = 0;
+    GetMaxTransceiveLength(nciTagProxyPtr->GetConnectedTech(tagRfDiscId), maxSize);
+    std::vector<NCI::INciTagInterface::TagTransceiveItem> items(hexCmds.size());
+    for (size_t i = 0; i < hexCmds.size(); i++) {
+        if (KITS::NfcSdkCommon::GetHexStrBytesLen(hexCmds[i]) > static_cast<uint32_t>(maxSize)) {
+            ErrorLog("hexCmds[%{public}zu] exceed max size.", i);
+            return KITS::ERR_TAG_PARAMETERS;
+        }
+        items[i].rfDiscId = static_cast<uint32_t>(rfDiscIds[i]);
+        items[i].command = hexCmds[i];
+    }
+
+    int count = nciTagProxyPtr->TransceiveBatch(tagRfDiscId, items);
+    DebugLog("TagSession::SendRawFrameBatch, %{public}d of %{public}zu transceived", count, items.size());
+    // the result of each command is mapped to the error code same as SendRawFrame.
+    for (NCI::INciTagInterface::TagTransceiveItem& item : items) {
+        int errorCode = KITS::ERR_TAG_STATE_IO_FAILED;
+        if ((item.status == 0) && (!item.response.empty())) {
+            errorCode = KITS::ERR_NONE;
+        } else if (item.status == 1) {  // status == 1 means that Tag lost
+            errorCode = KITS::ERR_TAG_STATE_LOST;
+        }
+        results.push_back(errorCode);
+        hexResps.push_back(std::move(item.response));
+    }
+    return KITS::ERR_NONE;
+}
+
+ErrCode TagSession::GetTagInventory(std::vector<int32_t>& rfDiscIds, std::vector<std::string>& uids,
+    std::vector<int32_t>& techCounts, std::vector<int32_t>& techs)
+{
+    rfDiscIds.clear();
+    uids.clear();
+    techCounts.clear();
+    techs.clear();
+    if (!ExternalDepsProxy::GetInstance().IsGranted(OHOS::NFC::TAG_PERM)) {
+        ErrorLog("GetTagInventory, ERR_NO_PERMISSION");
+        return KITS::ERR_NO_PERMISSION;
+    }
+
+    // Check if NFC is enabled
+    auto nfcServicePtr = nfcService_.lock();
+    auto nciTagProxyPtr = nciTagProxy_.lock();
+    if ((nfcServicePtr == nullptr) || (nciTagProxyPtr == nullptr)) {
+        ErrorLog("GetTagInventory nfcService or nciTagProxy is nullptr");
+        return KITS::ERR_TAG_STATE_UNBIND;
+    }
+    if (!nfcServicePtr->IsNfcEnabled()) {
+        ErrorLog("GetTagInventory, IsNfcEnabled error");
+        return KITS::ERR_TAG_STATE_NFC_CLOSED;
+    }
+
+    // the technologies of the tags are flattened, techCounts splits them per tag.
+    for (const NCI::INciTagInterface::TagInventoryItem& item : nciTagProxyPtr->GetTagInventory()) {
+        rfDiscIds.push_back(static_cast<int32_t>(item.rfDiscId));
+        uids.push_back(item.uid);
+        techCounts.push_back(static_cast<int32_t>(item.techList.size()));
+        techs.insert(techs.end(), item.techList.begin(), item.techList.end());
+    }
+    return KITS::ERR_NONE;
+}
+
 /**
  * @brief Reading from the host tag
  * @param tagRfDiscId the rf disc id of tag
@@ -416,6 +520,90 @@ ErrCode TagSession::NdefRead(int32_t tagRfDiscId, std::string& ndefMessage)
     return KITS::ERR_NONE;
 }
 
+ErrCode TagSession::SendRawFrameAsync(int32_t tagRfDiscId, const std::string& hexCmdData, bool raw,
+    const sptr<KITS::ITagOperationCallback>& cb)
+{
+    DebugLog("Send Raw(%{public}d) Frame Async", raw);
+    if (!ExternalDepsProxy::GetInstance().IsGranted(OHOS::NFC::TAG_PERM)) {
+        ErrorLog("SendRawFrameAsync, ERR_NO_PERMISSION");
+        return KITS::ERR_NO_PERMISSION;
+    }
+    if (cb == nullptr) {
+        ErrorLog("SendRawFrameAsync, cb is nullptr");
+        return KITS::ERR_TAG_PARAMETERS;
+    }
+
+    // Check if NFC is enabled
+    auto nfcServicePtr = nfcService_.lock();
+    auto nciTagProxyPtr = nciTagProxy_.lock();
+    if ((nfcServicePtr == nullptr) || (nciTagProxyPtr == nullptr)) {
+        ErrorLog("SendRawFrameAsync nfcService or nciTagProxy is nullptr");
+        return KITS::ERR_TAG_STATE_UNBIND;
+    }
+    if (!nfcServicePtr->IsNfcEnabled()) {
+        ErrorLog("SendRawFrameAsync, IsNfcEnabled error");
+        return KITS::ERR_TAG_STATE_NFC_CLOSED;
+    }
+
+    // Check if length is within limits
+    int maxSize = 0;
+    GetMaxTransceiveLength(nciTagProxyPtr->GetConnectedTech(tagRfDiscId), maxSize);
+    if (KITS::NfcSdkCommon::GetHexStrBytesLen(hexCmdData) > static_cast<uint32_t>(maxSize)) {
+        ErrorLog("hexCmdData exceed max size.");
+        return KITS::ERR_TAG_PARAMETERS;
+    }
+
+    // the response is mapped to the error code same as SendRawFrame.
+    auto onComplete = [cb](int result, const std::string& hexRespData) {
+        DebugLog("TagSession::SendRawFrameAsync, result = 0x%{public}X", result);
+        int errorCode = KITS::ERR_TAG_STATE_IO_FAILED;
+        if ((result == 0) && (!hexRespData.empty())) {
+            errorCode = KITS::ERR_NONE;
+        } else if (result == 1) {  // result == 1 means that Tag lost
+            errorCode = KITS::ERR_TAG_STATE_LOST;
+        }
+        cb->OnTagOperationComplete(errorCode, hexRespData);
+    };
+    if (!nciTagProxyPtr->TransceiveAsync(tagRfDiscId, hexCmdData, onComplete)) {
+        ErrorLog("TagSession::SendRawFrameAsync: send failed.");
+        return KITS::ERR_TAG_STATE_IO_FAILED;
+    }
+    return KITS::ERR_NONE;
+}
+
+ErrCode TagSession::NdefReadAsync(int32_t tagRfDiscId, const sptr<KITS::ITagOperationCallback>& cb)
+{
+    if (!ExternalDepsProxy::GetInstance().IsGranted(OHOS::NFC::TAG_PERM)) {
+        ErrorLog("NdefReadAsync, ERR_NO_PERMISSION");
+        return KITS::ERR_NO_PERMISSION;
+    }
+    if (cb == nullptr) {
+        ErrorLog("NdefReadAsync, cb is nullptr");
+        return KITS::ERR_TAG_PARAMETERS;
+    }
+
+    // Check if NFC is enabled
+    auto nfcServicePtr = nfcService_.lock();
+    auto nciTagProxyPtr = nciTagProxy_.lock();
+    if ((nfcServicePtr == nullptr) || (nciTagProxyPtr == nullptr)) {
+        ErrorLog("NdefReadAsync nfcService or nciTagProxy is nullptr");
+        return KITS::ERR_TAG_STATE_UNBIND;
+    }
+    if (!nfcServicePtr->IsNfcEnabled()) {
+        ErrorLog("NdefReadAsync, IsNfcEnabled error");
+        return KITS::ERR_TAG_STATE_NFC_CLOSED;
+    }
+
+    auto onComplete = [cb](int result, const std::string& ndefMessage) {
+        cb->OnTagOperationComplete((result == 0) ? KITS::ERR_NONE : KITS::ERR_TAG_STATE_IO_FAILED, ndefMessage);
+    };
+    if (!nciTagProxyPtr->ReadNdefAsync(tagRfDiscId, onComplete)) {
+        ErrorLog("TagSession::NdefReadAsync: read failed.");
+        return KITS::ERR_TAG_STATE_IO_FAILED;
+    }
+    return KITS::ERR_NONE;
+}
+
 /**
  * @brief Writing the data into the host tag.
  * @param tagRfDiscId the rf disc id of tag
@@ -549,7 +737,7 @@ ErrCode TagSession::GetMaxTransceiveLength(int32_t technology, int32_t& maxSize)
         ErrorLog("GetMaxTransceiveLength, technology not support");
         return KITS::ERR_TAG_PARAMETERS;
     }
-    maxSize = g_maxTransLength[technology];
+    maxSize = KITS::GetTagTechTraits(technology).maxTransceiveLength;
     return KITS::ERR_NONE;
 }
 
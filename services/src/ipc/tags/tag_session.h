@@ -28,6 +28,7 @@
 #include "infc_app_state_observer.h"
 #include "iforeground_callback.h"
 #include "ireader_mode_callback.h"
+#include "itag_operation_callback.h"
 
 namespace OHOS {
 namespace NFC {
@@ -150,6 +151,38 @@ public:
 
     ErrCode SendRawFrame(
         int32_t tagRfDiscId, const std::string& hexCmdData, bool raw, std::string& hexRespData) override;
+    /**
+     * @brief Send the command to the tag, the command and the response are in bytes.
+     * @param tagRfDiscId the rf disc id of tag
+     * @param cmdData the command bytes
+     * @param raw true if the command is raw frame
+     * @param respData the response bytes
+     * @return the result same as SendRawFrame
+     */
+    ErrCode SendRawFrameBytes(int32_t tagRfDiscId, const std::vector<uint8_t>& cmdData, bool raw,
+        std::vector<uint8_t>& respData) override;
+    /**
+     * @brief Send the commands to the tags in the field, each tag is selected once at most.
+     * @param tagRfDiscId the rf disc id of tag
+     * @param rfDiscIds the rf disc id of the tag in the field, for each command
+     * @param hexCmds the commands in hex string
+     * @param hexResps the response of each command
+     * @param results the result of each command, same as SendRawFrame
+     * @return the result to send the commands
+     */
+    ErrCode SendRawFrameBatch(int32_t tagRfDiscId, const std::vector<int32_t>& rfDiscIds,
+        const std::vector<std::string>& hexCmds, std::vector<std::string>& hexResps,
+        std::vector<int32_t>& results) override;
+    /**
+     * @brief Get the uid and technologies of all tags in the field.
+     * @param rfDiscIds the rf disc id of each tag
+     * @param uids the uid of each tag
+     * @param techCounts the count of the technologies of each tag
+     * @param techs the technologies of all the tags, in the order of the tags
+     * @return the result to get the tags
+     */
+    ErrCode GetTagInventory(std::vector<int32_t>& rfDiscIds, std::vector<std::string>& uids,
+        std::vector<int32_t>& techCounts, std::vector<int32_t>& techs) override;
     /**
      * @brief Reading from the host tag
      * @param tagRfDiscId the rf disc id of tag
@@ -157,6 +190,23 @@ public:
      * @return the read Result
      */
     ErrCode NdefRead(int32_t tagRfDiscId, std::string& ndefMessage) override;
+    /**
+     * @brief Send the command to the tag and return without waiting the response.
+     * @param tagRfDiscId the rf disc id of tag
+     * @param hexCmdData the command in hex string
+     * @param raw true if the command is raw frame
+     * @param cb the callback to receive the response once
+     * @return the result to send the command, cb is not called if failed
+     */
+    ErrCode SendRawFrameAsync(int32_t tagRfDiscId, const std::string& hexCmdData, bool raw,
+        const sptr<KITS::ITagOperationCallback>& cb) override;
+    /**
+     * @brief Read the host tag and return without waiting the data.
+     * @param tagRfDiscId the rf disc id of tag
+     * @param cb the callback to receive the read data once
+     * @return the result to start the read, cb is not called if failed
+     */
+    ErrCode NdefReadAsync(int32_t tagRfDiscId, const sptr<KITS::ITagOperationCallback>& cb) override;
     /**
      * @brief Writing the data into the host tag.
      * @param tagRfDiscId the rf disc id of tag
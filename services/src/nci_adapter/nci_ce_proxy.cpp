@@ -88,6 +88,23 @@ bool NciCeProxy::ClearAidTable()
     }
     return false;
 }
+
+uint32_t NciCeProxy::GetAidRoutingTableSize()
+{
+    if (nciCeInterface_) {
+        return nciCeInterface_->GetAidRoutingTableSize();
+    }
+    return 0;
+}
+
+int NciCeProxy::GetDefaultAidRoute(int defaultPaymentType)
+{
+    if (nciCeInterface_) {
+        return nciCeInterface_->GetDefaultAidRoute(defaultPaymentType);
+    }
+    return 0;
+}
+
 std::string NciCeProxy::GetSimVendorBundleName()
 {
     if (nciCeInterface_) {
@@ -64,6 +64,19 @@ public:
      */
     bool ClearAidTable() override;
 
+    /**
+     * @brief get the size of the listen mode routing table left for the aid entries
+     * @return the size in bytes, 0 if unknown
+     */
+    uint32_t GetAidRoutingTableSize() override;
+
+    /**
+     * @brief get the route of the aids not in the aid table
+     * @param defaultPaymentType see enum DefaultPaymentType
+     * @return the route location of the zero length aid entry
+     */
+    int GetDefaultAidRoute(int defaultPaymentType) override;
+
     /**
      * @brief get sim bundle name of the vendor
      * @return sim bundle name of the vendor
@@ -30,6 +30,8 @@ public:
     bool SendRawFrame(std::string &hexCmdData) override;
     bool AddAidRouting(const std::string &aidStr, int route, int aidInfo, int power) override;
     bool ClearAidTable() override;
+    uint32_t GetAidRoutingTableSize() override;
+    int GetDefaultAidRoute(int defaultPaymentType) override;
     std::string GetSimVendorBundleName() override;
     void NotifyDefaultPaymentType(int paymentType) override;
 };
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NCI_EVENT_TRACE_H
+#define NCI_EVENT_TRACE_H
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace NFC {
+namespace NCI {
+/**
+ * @brief Records the events of the NFA callbacks in a fixed size ring, without locks, so the events before a
+ * slow tap can be dumped from the device and replayed off the device by tools/nci_trace_replay.
+ */
+class NciEventTrace final {
+public:
+    enum Source : uint8_t {
+        SOURCE_CONN = 1, // NFA connection callback
+        SOURCE_DM,       // NFA device management callback
+        SOURCE_CE,       // NFA card emulation callback
+        SOURCE_EE,       // NFA execution environment callback
+    };
+
+    static constexpr size_t MAX_PAYLOAD_LEN = 8;
+    static constexpr size_t TRACE_CAPACITY = 1024; // must be a power of 2
+
+    struct EventRecord {
+        uint64_t timeUs = 0; // monotonic
+        uint8_t source = 0;
+        uint8_t event = 0;
+        uint8_t status = 0;
+        uint8_t payloadLen = 0;
+        uint8_t payload[MAX_PAYLOAD_LEN] = {0};
+    };
+
+    static NciEventTrace& GetInstance();
+
+    /**
+     * @brief Record one event, called from the NFA callbacks.
+     * @param payload The compact payload of the event, truncated to MAX_PAYLOAD_LEN bytes.
+     */
+    void Record(uint8_t source, uint8_t event, uint8_t status, const uint8_t* payload = nullptr,
+        size_t payloadLen = 0);
+
+    /**
+     * @brief Get the recorded events, from the oldest to the newest. The events overwritten while copying
+     * are left out.
+     */
+    std::vector<NciEventTrace::EventRecord> Snapshot() const;
+    uint64_t GetTotalCount() const;
+    void Clear();
+    void Dump(int fd) const;
+
+    static std::string FormatRecord(const NciEventTrace::EventRecord& record);
+    static bool ParseRecord(const std::string& line, NciEventTrace::EventRecord& record);
+    static const char* GetSourceName(uint8_t source);
+
+private:
+    struct Slot {
+        // 2 * (index + 1) once the record of index is written, odd while it is written.
+        std::atomic<uint64_t> sequence {0};
+        NciEventTrace::EventRecord record {};
+    };
+
+    NciEventTrace() = default;
+    ~NciEventTrace() = default;
+
+    std::atomic<uint64_t> writeIndex_ {0};
+    std::atomic<uint64_t> clearIndex_ {0}; // the records before it are cleared
+    std::atomic<uint64_t> droppedCount_ {0};
+    std::array<Slot, TRACE_CAPACITY> slots_ {};
+};
+}  // namespace NCI
+}  // namespace NFC
+}  // namespace OHOS
+#endif  // NCI_EVENT_TRACE_H
@@ -28,12 +28,16 @@ public:
     std::vector<int> GetTechList(uint32_t tagDiscId) override;
     uint32_t GetConnectedTech(uint32_t tagDiscId) override;
     std::vector<AppExecFwk::PacMap> GetTechExtrasData(uint32_t tagDiscId) override;
+    std::vector<KITS::TagTechExtras> GetTechExtras(uint32_t tagDiscId) override;
     std::string GetTagUid(uint32_t tagDiscId) override;
     bool Connect(uint32_t tagDiscId, uint32_t technology) override;
     bool Disconnect(uint32_t tagDiscId) override;
     bool Reconnect(uint32_t tagDiscId) override;
     int Transceive(uint32_t tagDiscId, const std::string &command, std::string &response) override;
+    int TransceiveBatch(uint32_t tagDiscId, std::vector<TagTransceiveItem> &items) override;
     std::string ReadNdef(uint32_t tagDiscId) override;
+    bool TransceiveAsync(uint32_t tagDiscId, const std::string &command, TagOpCallback callback) override;
+    bool ReadNdefAsync(uint32_t tagDiscId, TagOpCallback callback) override;
     std::string FindNdefTech(uint32_t tagDiscId) override;
     bool WriteNdef(uint32_t tagDiscId, std::string &command) override;
     bool FormatNdef(uint32_t tagDiscId, const std::string &key) override;
@@ -47,6 +51,7 @@ public:
     void GetTimeout(uint32_t tagDiscId, uint32_t &timeout, uint32_t technology) override;
     void ResetTimeout(uint32_t tagDiscId) override;
     uint32_t GetIsoDepMaxTransceiveLength() override;
+    std::vector<TagInventoryItem> GetTagInventory() override;
     bool IsExtendedLengthApduSupported() override;
     uint16_t GetTechMaskFromTechList(const std::vector<uint32_t> &discTech) override;
     bool VendorParseHarPackage(std::vector<std::string> &harPackages, const std::string &uri) override;
@@ -159,6 +159,7 @@ public:
     void OnCardEmulationData(const std::vector<uint8_t> &data);
     void OnCardEmulationActivated();
     void OnCardEmulationDeactivated();
+    void OnEeInfoChanged();
     // method for SAK28 issue
     void SendActEvtForSak28Tag(uint8_t connEvent, tNFA_CONN_EVT_DATA* eventData);
 
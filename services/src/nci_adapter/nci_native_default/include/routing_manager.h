@@ -14,7 +14,10 @@
  */
 #ifndef ROUTING_MANAGER_H
 #define ROUTING_MANAGER_H
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
 #include "ndef_utils.h"
 #include "nfa_api.h"
@@ -38,10 +41,83 @@ public:
     bool ComputeRoutingParams(int defaultPaymentType);
     bool AddAidRouting(const std::string &aidStr, int route, int aidInfo, int power);
     bool ClearAidTable();
+    uint32_t GetAidRoutingTableSize();
+    int GetDefaultAidRoute(int defaultPaymentType);
+    void Dump(int fd) const;
 
 private:
+    // the state of the EE discovery on enabling NFC
+    enum EeDiscoveryState {
+        EE_STATE_IDLE = 0,
+        EE_STATE_REGISTERING, // waiting for NFA_EE_REGISTER_EVT
+        EE_STATE_WAITING_INFO, // waiting for NFA_EE_DISCOVER_REQ_EVT
+        EE_STATE_READY,
+        EE_STATE_FAILED,
+    };
+
+    // the timing of the last Initialize, in ms, and the timeouts of all of them
+    struct EnableTiming {
+        uint32_t initCount = 0;
+        uint32_t eeRegisterMs = 0;
+        uint32_t eeInfoWaitMs = 0;
+        uint32_t initializeMs = 0;
+        uint32_t eeRegisterTimeouts = 0;
+        uint32_t eeInfoTimeouts = 0;
+    };
+
+    // a proto, tech or default aid routing entry, compared to skip the unchanged entries on recompute
+    struct RouteEntry {
+        uint32_t route = 0;
+        uint32_t power = 0;
+        bool isSet = false; // set to the NFCC, not compared
+        bool operator==(const RouteEntry& other) const
+        {
+            return route == other.route && power == other.power;
+        }
+        bool operator!=(const RouteEntry& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    // the routes computed by ComputeRoutingParams, as set to the NFCC
+    struct RoutingState {
+        bool isSecureNfcEnabled = false;
+        RouteEntry protoIsoDep {};
+        RouteEntry techAB {};
+        RouteEntry techF {};
+        RouteEntry defaultAid {}; // the route is the ee handle
+    };
+
+    struct CommitStats {
+        uint32_t commitCount = 0;
+        uint32_t skippedCommitCount = 0; // commits without any change since the last one
+        uint32_t skippedEntryCount = 0; // entries unchanged on recompute
+        uint32_t commitTimeouts = 0;
+        uint32_t lastCommitMs = 0;
+        uint32_t maxCommitMs = 0;
+        uint64_t totalCommitMs = 0;
+    };
+
+    // the entries of a desired state to set, or the ones set successfully
+    struct RoutingDiff {
+        bool isProtoIsoDepChanged = false;
+        bool isTechChanged = false; // tech A/B and F, cleared together
+        bool isDefaultAidChanged = false;
+        uint32_t skippedCount = 0;
+    };
+
     RoutingManager();
     ~RoutingManager();
+    RoutingState BuildRoutingState(int defaultPaymentType);
+    static RoutingDiff DiffRoutingState(const RoutingState& current, const RoutingState& desired,
+                                        bool isDefaultAidRouted);
+    RoutingDiff ApplyRoutingDiff(const RoutingState& desired, const RoutingDiff& diff);
+    void RecordRoutingState(const RoutingState& desired, const RoutingDiff& diff, const RoutingDiff& applied);
+    void InvalidateRoutingState();
+    bool RegisterEe();
+    void WaitForEeInfo();
+    static uint32_t GetElapsedMs(std::chrono::steady_clock::time_point start);
     uint32_t GetDefaultProtoRouteAndPower(int defaultPaymentType);
 
     // update route settings
@@ -53,12 +129,12 @@ private:
     // routing entries
     bool ClearRoutingEntry(uint32_t type);
     bool SetRoutingEntry(uint32_t type, uint32_t value, uint32_t route, uint32_t power);
-    void SetDefaultAidRoute(int defaultPaymentType);
-    void RegisterProtoRoutingEntry(tNFA_HANDLE eeHandle, tNFA_PROTOCOL_MASK protoSwitchOn,
+    bool SetDefaultAidRoute(tNFA_HANDLE handle, uint32_t power);
+    bool RegisterProtoRoutingEntry(tNFA_HANDLE eeHandle, tNFA_PROTOCOL_MASK protoSwitchOn,
                                    tNFA_PROTOCOL_MASK protoSwitchOff, tNFA_PROTOCOL_MASK protoBatteryOn,
                                    tNFA_PROTOCOL_MASK protoScreenLock, tNFA_PROTOCOL_MASK protoScreenOff,
                                    tNFA_PROTOCOL_MASK protoSwitchOffLock);
-    void RegisterTechRoutingEntry(tNFA_HANDLE eeHandle,
+    bool RegisterTechRoutingEntry(tNFA_HANDLE eeHandle,
         tNFA_PROTOCOL_MASK protoSwitchOn, tNFA_PROTOCOL_MASK protoSwitchOff,
         tNFA_PROTOCOL_MASK protoBatteryOn, tNFA_PROTOCOL_MASK protoScreenLock,
         tNFA_PROTOCOL_MASK protoScreenOff, tNFA_PROTOCOL_MASK protoSwitchOffLock);
@@ -115,6 +191,18 @@ private:
     bool isAidRoutingConfigured_ = false;
     uint8_t hostListenTechMask_ = 0;
     uint32_t offHostAidRoutingPowerState_ = 0;
+
+    std::atomic<EeDiscoveryState> eeState_ {EE_STATE_IDLE};
+    EnableTiming enableTiming_ {};
+
+    // serializes the computes and commits, held across their NFA calls
+    std::mutex routingCommitMutex_ {};
+    // guards the routing state and the commit stats, never held across an NFA call, Dump takes it
+    mutable std::mutex routingStateMutex_ {};
+    RoutingState routingState_ {};
+    bool isDefaultAidRouted_ = false; // cleared with the aid table
+    bool hasPendingChanges_ = true; // routing changed since the last NFA_EeUpdateNow
+    CommitStats commitStats_ {};
 };
 }
 }
@@ -14,15 +14,18 @@
  */
 #ifndef TAG_HOST_H
 #define TAG_HOST_H
+#include <memory>
 #include <mutex>
 #include <vector>
+#include "inci_tag_interface.h"
 #include "pac_map.h"
 #include "synchronize_event.h"
+#include "tag_tech_extras.h"
 
 namespace OHOS {
 namespace NFC {
 namespace NCI {
-class TagHost final {
+class TagHost final : public std::enable_shared_from_this<TagHost> {
 public:
     static const uint32_t DATA_BYTE2 = 2;
     static const uint32_t DATA_BYTE3 = 3;
@@ -46,14 +49,6 @@ public:
     // Iso15693
     static const uint32_t NCI_POLL_LENGTH_MIN = 2;
     static const uint32_t DEFAULT_PRESENCE_CHECK_WATCH_DOG_TIMEOUT = 125;
-    // T1T~T4T for NDEF tag
-    static const auto NDEF_UNKNOWN_TYPE = 0;
-    static const auto NDEF_TYPE1_TAG = 1;
-    static const auto NDEF_TYPE2_TAG = 2;
-    static const auto NDEF_TYPE3_TAG = 3;
-    static const auto NDEF_TYPE4_TAG = 4;
-    static const auto NDEF_MIFARE_CLASSIC_TAG = 101;
-
     // NfcF, Felica
     static const uint32_t SENSF_RES_LENGTH = 8;
     static const uint32_t F_POLL_LENGTH = 10;
@@ -67,21 +62,30 @@ public:
             const std::vector<std::string>& tagActivatedBytes,
             const uint32_t connectedTechIndex);
     ~TagHost();
+
+    void SetGeneration(uint32_t generation);
+    uint32_t GetGeneration();
+
     bool Connect(int technology);
     bool Disconnect();
     bool Reconnect();
     int Transceive(const std::string& request, std::string& response);
+    int TransceiveBatch(std::vector<INciTagInterface::TagTransceiveItem>& items);
+    bool TransceiveAsync(const std::string& request, INciTagInterface::TagOpCallback callback);
 
     // get the tag related technologies or uid info.
     std::vector<int> GetTechList();
+    static int ConvertToKitsTech(int targetType);
     uint32_t GetConnectedTech();
     void RemoveTech(int tech);
+    std::vector<KITS::TagTechExtras> GetTechExtras();
     std::vector<AppExecFwk::PacMap> GetTechExtrasData();
     std::string GetTagUid();
     uint32_t GetTagRfDiscId();
 
     // functions for ndef tag only.
     std::string ReadNdef();
+    bool ReadNdefAsync(INciTagInterface::TagOpCallback callback);
     bool WriteNdef(std::string& data);
     bool IsNdefFormatable();
     bool FormatNdef(const std::string& key);
@@ -100,28 +104,29 @@ public:
     void ResetTimeout();
 
 private:
-    AppExecFwk::PacMap ParseTechExtras(uint32_t index);
+    KITS::TagTechExtras ParseTechExtras(uint32_t index);
     void FieldCheckingThread(uint32_t delayedMs);
     void PauseFieldChecking();
     void ResumeFieldChecking();
     void StopFieldCheckingInner();
-    void AddNdefTechToTagInfo(uint32_t tech, uint32_t discId, uint32_t actProto, AppExecFwk::PacMap pacMap);
+    void AddNdefTechToTagInfo(uint32_t tech, uint32_t discId, uint32_t actProto, KITS::TagTechExtras extras);
     uint32_t GetNdefType(uint32_t protocol) const;
     bool IsUltralightC();
 
-    void DoTargetTypeIso144433a(AppExecFwk::PacMap &pacMap, uint32_t index);
-    void DoTargetTypeIso144433b(AppExecFwk::PacMap &pacMap, uint32_t index);
-    void DoTargetTypeIso144434(AppExecFwk::PacMap &pacMap, uint32_t index);
-    void DoTargetTypeV(AppExecFwk::PacMap &pacMap, uint32_t index);
-    void DoTargetTypeF(AppExecFwk::PacMap &pacMap, uint32_t index);
-    void DoTargetTypeNdef(AppExecFwk::PacMap &pacMap);
+    void DoTargetTypeIso144433a(KITS::TagTechExtras &extras, uint32_t index);
+    void DoTargetTypeIso144433b(KITS::TagTechExtras &extras, uint32_t index);
+    void DoTargetTypeIso144434(KITS::TagTechExtras &extras, uint32_t index);
+    void DoTargetTypeV(KITS::TagTechExtras &extras, uint32_t index);
+    void DoTargetTypeF(KITS::TagTechExtras &extras, uint32_t index);
+    void DoTargetTypeMifareUl(KITS::TagTechExtras &extras, uint32_t index);
+    void DoTargetTypeNdef(KITS::TagTechExtras &extras, uint32_t index);
 
     static OHOS::NFC::SynchronizeEvent fieldCheckWatchDog_;
     std::mutex mutex_ {};
 
     // tag datas for tag dispatcher
     std::vector<int> tagTechList_;
-    std::vector<AppExecFwk::PacMap> tagTechExtras_;
+    std::vector<KITS::TagTechExtras> tagTechExtras_;
     std::vector<uint32_t> tagRfDiscIdList_;
     std::vector<uint32_t> tagRfProtocols_;
     std::string tagUid_;
@@ -133,15 +138,17 @@ private:
     uint32_t connectedTechIndex_; // index to find value in arrays of tag data
     volatile bool isTagFieldOn_;
     volatile bool isFieldChecking_;
+    bool isFieldCheckingStarted_; // false when the reader app skips the presence check
     volatile bool isPauseFieldChecking_;
     volatile bool isSkipNextFieldChecking_;
     bool addNdefTech_;
+    uint32_t generation_ {0}; // set by TagNativeImpl, tells this tag from a later one with the same disc id
     std::vector<int> technologyList_ {};
     /* NDEF */
     static const uint32_t NDEF_INFO_SIZE = 2; // includes size + mode;
     static const uint32_t NDEF_SIZE_INDEX = 0;
     static const uint32_t NDEF_MODE_INDEX = 1;
-    AppExecFwk::PacMap ndefExtras_;
+    KITS::TagTechExtras ndefExtras_;
 };
 }  // namespace NCI
 }  // namespace NFC
@@ -14,6 +14,8 @@
  */
 #ifndef TAG_NATIVE_IMPL_H
 #define TAG_NATIVE_IMPL_H
+#include <array>
+#include <mutex>
 #include "tag_host.h"
 #include "inci_tag_interface.h"
 
@@ -40,8 +42,9 @@ public:
     /**
      * @brief Tag lost, need to callback to nfc service.
      * @param tagDiscId The tag discovered id given from nci stack.
+     * @param generation The generation of the lost TagHost, ignored when the id is taken by a newer tag.
      */
-    void OnTagLost(uint32_t tagDiscId);
+    void OnTagLost(uint32_t tagDiscId, uint32_t generation);
 
     /**
      * @brief Get the TagHost instance by the tag discovered id.
@@ -69,6 +72,12 @@ public:
      */
     uint32_t GetIsoDepMaxTransceiveLength();
 
+    /**
+     * @brief Get the uid and technologies of all tags discovered in the field in one pass.
+     * @return The inventory of the discovered tags.
+     */
+    std::vector<INciTagInterface::TagInventoryItem> GetTagInventory();
+
     /**
      * @brief Check if the nfc controller support extended APDU or not.
      * @param length The max isodep length to check.
@@ -76,8 +85,17 @@ public:
      */
     bool IsExtendedLengthApduSupported(uint32_t length);
 private:
+    // the rf discovery id is one byte in nci, so the slot of a tag is indexed by it.
+    static const uint32_t TAG_SLOT_COUNT = 256;
+
+    struct TagSlot {
+        std::shared_ptr<TagHost> tagHost {};
+        uint32_t generation {0};
+    };
+
     std::weak_ptr<INciTagInterface::ITagListener> tagListener_ {};
-    std::map<uint32_t, std::shared_ptr<TagHost>> tagHostMap_ {};
+    std::mutex mutex_ {};
+    std::array<TagSlot, TAG_SLOT_COUNT> tagSlots_ {};
 };
 }  // namespace NCI
 }  // namespace NFC
@@ -14,6 +14,7 @@
  */
 #ifndef TAG_NCI_ADAPTER_COMMON_H
 #define TAG_NCI_ADAPTER_COMMON_H
+#include <map>
 #include <mutex>
 #include <vector>
 #include "ndef_utils.h"
@@ -47,6 +48,25 @@ public:
     static const auto TARGET_TYPE_NDEF_FORMATABLE = 7;
     static const auto TARGET_TYPE_MIFARE_CLASSIC = 8;
     static const auto TARGET_TYPE_MIFARE_UL = 9;
+    static const uint32_t INVALID_DISC_ID = 0xFFFF;
+
+    // session state of one tag in the field, a field may hold several tags at the same time.
+    typedef struct TagSession {
+        uint32_t rfDiscId = INVALID_DISC_ID;
+        uint32_t protocol = 0;
+        uint32_t rfInterface = NFA_INTERFACE_ISO_DEP;
+        std::string uid {};
+        std::vector<int> techList {};
+        int timeouts[MAX_NUM_TECHNOLOGY] = {0};
+    } TagSession;
+
+    // functions for multiple tag sessions
+    void AddTagSession(uint32_t rfDiscId, uint32_t protocol, uint32_t rfInterface, const std::string& uid,
+        const std::vector<int>& techList);
+    bool IsActiveTagSession(uint32_t rfDiscId) const;
+    void SwitchTagSession(uint32_t rfDiscId, uint32_t rfInterface);
+    std::vector<TagSession> GetTagSessions() const;
+    void ClearTagSessions();
     bool isLegacyMifareReader_ = false;
     bool isMultiTagSupported_ = false;
     uint32_t discNtfIndex_ = 0;
@@ -57,6 +77,8 @@ public:
     uint32_t connectedRfIface_ = NFA_INTERFACE_ISO_DEP;
     // timeout and time diffs
     int technologyTimeoutsTable_[MAX_NUM_TECHNOLOGY] = {0}; // index equals to the technology value
+    bool isTimeoutOverridden_[MAX_NUM_TECHNOLOGY] = {false}; // timeout set by app, not learned
+    uint32_t isoDepFwt_ = 0; // frame waiting time of the ISO-DEP tag, in ms
     // tag technology data for tag host and nfcservice.
     std::vector<int> tagTechList_ {};
     std::vector<uint32_t> tagRfDiscIdList_ {};          // disc id
@@ -92,6 +114,11 @@ public:
     bool isNdefWriteSuccess_ = false;
     bool isNdefFormatSuccess_ = false;
     uint32_t t1tMaxMessageSize_ = 0;
+    // tag sessions keyed by rf disc id, the active one is the tag currently selected by nfcc.
+    std::map<uint32_t, TagSession> tagSessions_ {};
+    std::vector<uint32_t> tagSessionOrder_ {};
+    uint32_t activeSessionDiscId_ = INVALID_DISC_ID;
+    mutable std::mutex tagSessionMutex_ {};
 
     OHOS::NFC::SynchronizeEvent reconnectEvent_;
     OHOS::NFC::SynchronizeEvent readNdefEvent_;
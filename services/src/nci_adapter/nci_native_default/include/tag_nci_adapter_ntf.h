@@ -38,7 +38,6 @@ public:
     } MultiTagParams;
 
     void HandleSelectResult(uint8_t status);
-    void HandleTranceiveData(uint8_t status, uint8_t* data, uint32_t dataLen);
     void HandleReadComplete(uint8_t status);
     void HandleWriteComplete(uint8_t status);
     void HandleFormatComplete(uint8_t status);
@@ -88,7 +87,6 @@ public:
 private:
     uint32_t GetT1tMaxMessageSize(tNFA_ACTIVATED activated) const;
     std::string GetUidFromData(tNFA_ACTIVATED activated) const;
-    tNFA_INTF_TYPE GetRfInterface(uint32_t protocol) const;
     bool IsDiscTypeA(uint8_t discType) const;
     bool IsDiscTypeB(uint8_t discType) const;
     bool IsDiscTypeF(uint8_t discType) const;
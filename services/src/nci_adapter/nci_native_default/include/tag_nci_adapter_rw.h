@@ -14,13 +14,19 @@
  */
 #ifndef TAG_NCI_ADAPTER_RW_H
 #define TAG_NCI_ADAPTER_RW_H
+#include <chrono>
+#include <functional>
 #include <mutex>
+#include <thread>
 #include <vector>
+#include "inci_tag_interface.h"
 #include "ndef_utils.h"
 #include "nfa_api.h"
 #include "nfa_rw_api.h"
 #include "nfc_config.h"
 #include "synchronize_event.h"
+#include "tag_rtt_estimator.h"
+#include "tag_transceive_profile.h"
 
 namespace OHOS {
 namespace NFC {
@@ -47,8 +53,18 @@ public:
     bool Disconnect();
     bool Reconnect();
     int Transceive(const std::string& request, std::string& response);
+    int TransceiveBatch(std::vector<INciTagInterface::TagTransceiveItem>& items);
     void SetTimeout(const uint32_t timeout, const uint32_t technology);
+    void SetUserTimeout(const uint32_t timeout, const uint32_t technology);
     uint32_t GetTimeout(uint32_t technology) const;
+    void Dump(int fd) const;
+
+    // asynchronous operations, return the request id or INVALID_REQUEST_ID if not started. the callback is
+    // invoked once, from the async worker thread when completed or timeout.
+    static const uint32_t INVALID_REQUEST_ID = 0;
+    uint32_t TransceiveAsync(const std::string& request, INciTagInterface::TagOpCallback callback);
+    uint32_t ReadNdefAsync(INciTagInterface::TagOpCallback callback);
+    bool HandleAsyncReadComplete(uint8_t status);
 
     // functions for ndef tag only.
     void ReadNdef(std::string& response);
@@ -81,7 +97,39 @@ public:
 
 private:
     bool Reselect(tNFA_INTF_TYPE rfInterface, bool isSwitchingIface);
+    tNFA_INTF_TYPE GetConnectRfInterface() const;
+    tNFA_STATUS SwitchToTag(uint32_t discId, tNFA_INTF_TYPE rfInterface);
+    std::vector<uint32_t> GetBatchTagOrder(const std::vector<INciTagInterface::TagTransceiveItem>& items) const;
     tNFA_STATUS HandleMfcTransceiveData(std::string& response);
+    template <TagTransceiveProfile::RspHandler handler>
+    tNFA_STATUS HandleTransceiveRsp(std::string& response);
+    tNFA_STATUS HandleTransceiveRsp(TagTransceiveProfile::RspHandler handler, std::string& response);
+    enum class AsyncOpType { NONE = 0, TRANSCEIVE, READ_NDEF };
+    typedef struct AsyncOp {
+        uint32_t requestId = INVALID_REQUEST_ID;
+        AsyncOpType type = AsyncOpType::NONE;
+        INciTagInterface::TagOpCallback callback = nullptr;
+        uint32_t key = 0;
+        uint32_t timeout = 0;
+        std::chrono::steady_clock::time_point sendTime {};
+        std::chrono::steady_clock::time_point deadline {};
+        uint32_t softTimeout = 0;   // the response is overdue after it, 0 for none
+        bool isOverdue = false;
+        bool isDone = false;
+        tNFA_STATUS status = NFA_STATUS_OK;
+        std::string response {};    // the NDEF message read, the response of transceive is in receivedData_
+    } AsyncOp;
+    bool IsAsyncOpPending();
+    uint32_t NextRequestId();
+    void HandleAsyncTranceiveData(uint8_t status, uint8_t* data, uint32_t dataLen);
+    void StartAsyncWorker();
+    void AsyncOpWorker();
+    bool WaitAsyncOpDone();
+    void CompleteAsyncOp(AsyncOp& op);
+    uint32_t GetTransceiveKey(const std::basic_string<uint8_t>& request) const;
+    uint32_t GetSoftTimeout(uint32_t key, uint32_t fullTimeout);
+    uint32_t GetFullTimeout() const;
+    uint32_t GetFwtFloor() const;
     tNFA_STATUS SendRawFrameForHaltPICC();
     bool IsTagActive() const;
     // spacial card
@@ -92,11 +140,11 @@ private:
     bool IsCashbeeCard();
     tNFA_STATUS SelectCard(tNFA_INTF_TYPE rfInterface);
     tNFA_STATUS RetryToWaitSuccess(tNFA_INTF_TYPE rfInterface);
-    bool IsMifareUL(tNFA_ACTIVATED activated);
-    void SetIsoDepFwt(tNFA_ACTIVATED activated, uint32_t technology);
     void RetryThreeTimes(int retryIn);
     tNFA_RW_PRES_CHK_OPTION presChkOption_;
     std::basic_string<uint8_t> receivedData_ {};
+    std::basic_string<uint8_t> requestData_ {}; // reused by every transceive, guarded by transceiveEvent_
+    TagRttEstimator rttEstimator_ {};
     bool isMfcTransRspErr_ = false;
     // synchronized lock
     std::mutex rfDiscoveryMutex_;
@@ -105,6 +153,11 @@ private:
     OHOS::NFC::SynchronizeEvent checkNdefEvent_;
     OHOS::NFC::SynchronizeEvent activatedEvent_;
     OHOS::NFC::SynchronizeEvent deactivatedEvent_;
+    OHOS::NFC::SynchronizeEvent asyncOpEvent_;
+    AsyncOp asyncOp_ {};
+    std::thread asyncWorker_ {};
+    bool isAsyncWorkerExit_ = false;
+    uint32_t lastRequestId_ = INVALID_REQUEST_ID;
 
     bool isWaitingDeactRst_ = false; // deactive wrating state in reselect command can be modeified only in reselect
     bool isCashbee_ = false;
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TAG_RTT_ESTIMATOR_H
+#define TAG_RTT_ESTIMATOR_H
+#include <map>
+#include <mutex>
+
+namespace OHOS {
+namespace NFC {
+namespace NCI {
+/**
+ * @brief Learns the response time of tag commands, per tag, technology and command class, the way TCP computes its
+ * retransmission timeout. The learned time is a soft deadline only: a command past it is overdue, which flags the
+ * health of the tag and backs the soft deadline off, but the command still waits for its full timeout.
+ */
+class TagRttEstimator final {
+public:
+    TagRttEstimator() = default;
+    ~TagRttEstimator() = default;
+
+    static uint32_t BuildKey(uint32_t discId, uint32_t technology, uint8_t cmdClass);
+
+    /**
+     * @brief Get the soft deadline of the next command, its response is overdue after it.
+     * @param key The key built by BuildKey.
+     * @param fullTimeout The full timeout of the command, the result never exceeds it.
+     * @param minTimeout The lower bound of the result, such as the ISO-DEP frame waiting time.
+     * @return The soft deadline in milliseconds after the command is sent.
+     */
+    uint32_t GetSoftTimeout(uint32_t key, uint32_t fullTimeout, uint32_t minTimeout);
+    void OnResponse(uint32_t key, uint32_t rttUs, bool isOverdue);
+    void OnOverdue(uint32_t key, uint32_t softTimeout);
+    void OnTimeout(uint32_t key);
+    void Reset();
+    void Dump(int fd) const;
+
+private:
+    struct RttStats {
+        uint32_t srttUs = 0;      // smoothed round trip time
+        uint32_t rttVarUs = 0;    // round trip time variation
+        uint32_t maxRttUs = 0;
+        uint32_t samples = 0;
+        uint32_t overdues = 0;
+        uint32_t timeouts = 0;
+        uint32_t backoff = 0;
+        uint32_t lastSoftTimeoutMs = 0;
+    };
+
+    mutable std::mutex mutex_ {};
+    std::map<uint32_t, RttStats> stats_ {};
+
+    // counters kept across tags
+    uint64_t totalSamples_ = 0;
+    uint64_t softWaits_ = 0;      // commands with a soft deadline shorter than the full timeout
+    uint64_t overdueCmds_ = 0;    // commands past the soft deadline
+    uint64_t lateResponses_ = 0;  // overdue commands answered within the full timeout
+    uint64_t timeouts_ = 0;
+};
+}  // namespace NCI
+}  // namespace NFC
+}  // namespace OHOS
+#endif  // TAG_RTT_ESTIMATOR_H
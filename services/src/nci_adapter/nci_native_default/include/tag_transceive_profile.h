@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TAG_TRANSCEIVE_PROFILE_H
+#define TAG_TRANSCEIVE_PROFILE_H
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "nfa_api.h"
+#include "nfc_sdk_common.h"
+
+// the logs of every frame on the transceive path, built only with NFC_TRANSCEIVE_TRACE.
+#ifdef NFC_TRANSCEIVE_TRACE
+#define TransceiveTraceLog(fmt, ...) DebugLog(fmt, ##__VA_ARGS__)
+#else
+#define TransceiveTraceLog(fmt, ...)
+#endif
+
+namespace OHOS {
+namespace NFC {
+namespace NCI {
+/**
+ * @brief How a tag of each protocol is handled, resolved from a constant table instead of the protocol checks
+ * spread over the transceive path and the tag host. A protocol is added by one entry of PROFILES.
+ */
+class TagTransceiveProfile final {
+public:
+    enum RspHandler : uint8_t {
+        RSP_RAW = 0,       // the response as it is
+        RSP_T2T_NACK,      // a NACK puts the tag in HALT state, reconnect it
+        RSP_MFC,           // assembled by extns for the legacy mifare reader
+        RSP_HANDLER_COUNT,
+    };
+
+    struct Profile {
+        uint8_t protocol;
+        bool canReconnect;
+        tNFA_INTF_TYPE rfInterface;
+        RspHandler rspHandler;
+        KITS::EmNfcForumType ndefType;
+    };
+
+    static constexpr Profile PROFILES[] = {
+        { NFA_PROTOCOL_T1T, false, NFA_INTERFACE_FRAME, RSP_RAW, KITS::NFC_FORUM_TYPE_1 },
+        { NFA_PROTOCOL_T2T, true, NFA_INTERFACE_FRAME, RSP_T2T_NACK, KITS::NFC_FORUM_TYPE_2 },
+        { NFA_PROTOCOL_T3T, false, NFA_INTERFACE_FRAME, RSP_RAW, KITS::NFC_FORUM_TYPE_3 },
+        { NFA_PROTOCOL_ISO_DEP, true, NFA_INTERFACE_ISO_DEP, RSP_RAW, KITS::NFC_FORUM_TYPE_4 },
+        { NFA_PROTOCOL_T5T, false, NFA_INTERFACE_FRAME, RSP_RAW, KITS::NFC_FORUM_TYPE_UNKNOWN },
+        { NFC_PROTOCOL_MIFARE, true, NFA_INTERFACE_MIFARE, RSP_MFC, KITS::MIFARE_CLASSIC },
+    };
+    // for the protocols not in the table, such as kovio barcode.
+    static constexpr Profile DEFAULT_PROFILE = { 0, false, NFA_INTERFACE_FRAME, RSP_RAW, KITS::NFC_FORUM_TYPE_UNKNOWN };
+
+    static constexpr const Profile& Get(uint8_t protocol)
+    {
+        for (const Profile& profile : PROFILES) {
+            if (profile.protocol == protocol) {
+                return profile;
+            }
+        }
+        return DEFAULT_PROFILE;
+    }
+
+    /**
+     * @brief Decode the hex string of a command into the reused buffer, without allocating once the buffer
+     * has grown to the longest command.
+     * @return False if the string is not hex, the buffer is cleared then.
+     */
+    static bool DecodeHex(const std::string& hex, std::basic_string<uint8_t>& bytes);
+    static void EncodeHex(const uint8_t* data, size_t len, std::string& hex);
+};
+
+static_assert(TagTransceiveProfile::Get(NFA_PROTOCOL_T2T).rspHandler == TagTransceiveProfile::RSP_T2T_NACK,
+    "the NACK of T2T must be checked");
+static_assert(!TagTransceiveProfile::Get(NFA_PROTOCOL_T3T).canReconnect, "T3T does not reconnect");
+}  // namespace NCI
+}  // namespace NFC
+}  // namespace OHOS
+#endif  // TAG_TRANSCEIVE_PROFILE_H
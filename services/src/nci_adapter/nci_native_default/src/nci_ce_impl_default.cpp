@@ -57,6 +57,17 @@ bool NciCeImplDefault::ClearAidTable()
 {
     return RoutingManager::GetInstance().ClearAidTable();
 }
+
+uint32_t NciCeImplDefault::GetAidRoutingTableSize()
+{
+    return RoutingManager::GetInstance().GetAidRoutingTableSize();
+}
+
+int NciCeImplDefault::GetDefaultAidRoute(int defaultPaymentType)
+{
+    return RoutingManager::GetInstance().GetDefaultAidRoute(defaultPaymentType);
+}
+
 std::string NciCeImplDefault::GetSimVendorBundleName()
 {
     // please change it to the sim bundle name of your vendor
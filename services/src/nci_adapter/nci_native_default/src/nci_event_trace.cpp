@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nci_event_trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include "securec.h"
+
+namespace OHOS {
+namespace NFC {
+namespace NCI {
+static_assert((NciEventTrace::TRACE_CAPACITY & (NciEventTrace::TRACE_CAPACITY - 1)) == 0,
+    "TRACE_CAPACITY must be a power of 2");
+static const uint64_t INDEX_MASK = NciEventTrace::TRACE_CAPACITY - 1;
+static const uint64_t SEQUENCE_STEP = 2;
+static const int HEX_BASE = 16;
+static const size_t HEX_CHARS_PER_BYTE = 2;
+static const char* const EMPTY_PAYLOAD = "-";
+
+static uint64_t GetMonotonicTimeUs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+NciEventTrace& NciEventTrace::GetInstance()
+{
+    static NciEventTrace instance;
+    return instance;
+}
+
+void NciEventTrace::Record(uint8_t source, uint8_t event, uint8_t status, const uint8_t* payload,
+    size_t payloadLen)
+{
+    uint64_t index = writeIndex_.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots_[index & INDEX_MASK];
+    // odd while written, the readers skip the slot until it is even again. a writer that falls a whole ring
+    // behind finds the slot written or taken by a newer record, and drops its own.
+    uint64_t claimed = SEQUENCE_STEP * index + 1;
+    uint64_t current = slot.sequence.load(std::memory_order_relaxed);
+    do {
+        if (current >= claimed || (current % SEQUENCE_STEP) != 0) {
+            droppedCount_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    } while (!slot.sequence.compare_exchange_weak(current, claimed, std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+    EventRecord& record = slot.record;
+    record.timeUs = GetMonotonicTimeUs();
+    record.source = source;
+    record.event = event;
+    record.status = status;
+    record.payloadLen = 0;
+    if (payload != nullptr && payloadLen > 0) {
+        size_t len = std::min(payloadLen, MAX_PAYLOAD_LEN);
+        if (memcpy_s(record.payload, sizeof(record.payload), payload, len) == EOK) {
+            record.payloadLen = static_cast<uint8_t>(len);
+        }
+    }
+    slot.sequence.store(SEQUENCE_STEP * (index + 1), std::memory_order_release);
+}
+
+std::vector<NciEventTrace::EventRecord> NciEventTrace::Snapshot() const
+{
+    std::vector<NciEventTrace::EventRecord> records;
+    uint64_t end = writeIndex_.load(std::memory_order_acquire);
+    uint64_t begin = std::max(clearIndex_.load(std::memory_order_acquire),
+        (end > TRACE_CAPACITY) ? (end - TRACE_CAPACITY) : 0);
+    records.reserve(end - begin);
+    for (uint64_t index = begin; index < end; index++) {
+        const Slot& slot = slots_[index & INDEX_MASK];
+        uint64_t expected = SEQUENCE_STEP * (index + 1);
+        if (slot.sequence.load(std::memory_order_acquire) != expected) {
+            continue; // still written, or overwritten by a newer record
+        }
+        NciEventTrace::EventRecord record = slot.record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != expected) {
+            continue;
+        }
+        records.push_back(record);
+    }
+    return records;
+}
+
+uint64_t NciEventTrace::GetTotalCount() const
+{
+    return writeIndex_.load(std::memory_order_relaxed);
+}
+
+void NciEventTrace::Clear()
+{
+    clearIndex_.store(writeIndex_.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+const char* NciEventTrace::GetSourceName(uint8_t source)
+{
+    switch (source) {
+        case SOURCE_CONN:
+            return "CONN";
+        case SOURCE_DM:
+            return "DM";
+        case SOURCE_CE:
+            return "CE";
+        case SOURCE_EE:
+            return "EE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+std::string NciEventTrace::FormatRecord(const NciEventTrace::EventRecord& record)
+{
+    // <time us> <source> <event> <status> <payload>, parsed back by ParseRecord.
+    char head[64] = {0};
+    if (sprintf_s(head, sizeof(head), "%" PRIu64 " %s 0x%02X 0x%02X ", record.timeUs,
+        GetSourceName(record.source), record.event, record.status) < 0) {
+        return "";
+    }
+    std::string line = head;
+    if (record.payloadLen == 0) {
+        return line + EMPTY_PAYLOAD;
+    }
+    char hex[HEX_CHARS_PER_BYTE + 1] = {0};
+    for (uint8_t i = 0; i < record.payloadLen && i < MAX_PAYLOAD_LEN; i++) {
+        if (sprintf_s(hex, sizeof(hex), "%02X", record.payload[i]) < 0) {
+            break;
+        }
+        line += hex;
+    }
+    return line;
+}
+
+static bool ParseSource(const std::string& name, uint8_t& source)
+{
+    for (uint8_t candidate = NciEventTrace::SOURCE_CONN; candidate <= NciEventTrace::SOURCE_EE; candidate++) {
+        if (name == NciEventTrace::GetSourceName(candidate)) {
+            source = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool ParseByte(const std::string& str, uint8_t& value)
+{
+    char* end = nullptr;
+    unsigned long parsed = strtoul(str.c_str(), &end, HEX_BASE);
+    if (end == str.c_str() || *end != '\0' || parsed > UINT8_MAX) {
+        return false;
+    }
+    value = static_cast<uint8_t>(parsed);
+    return true;
+}
+
+bool NciEventTrace::ParseRecord(const std::string& line, NciEventTrace::EventRecord& record)
+{
+    std::istringstream stream(line);
+    std::string sourceName;
+    std::string event;
+    std::string status;
+    std::string payload;
+    NciEventTrace::EventRecord parsed;
+    if (!(stream >> parsed.timeUs >> sourceName >> event >> status >> payload)) {
+        return false;
+    }
+    if (!ParseSource(sourceName, parsed.source) || !ParseByte(event, parsed.event) ||
+        !ParseByte(status, parsed.status)) {
+        return false;
+    }
+    if (payload != EMPTY_PAYLOAD) {
+        if ((payload.size() % HEX_CHARS_PER_BYTE) != 0 ||
+            payload.size() > MAX_PAYLOAD_LEN * HEX_CHARS_PER_BYTE) {
+            return false;
+        }
+        for (size_t i = 0; i < payload.size(); i += HEX_CHARS_PER_BYTE) {
+            if (!ParseByte(payload.substr(i, HEX_CHARS_PER_BYTE), parsed.payload[parsed.payloadLen])) {
+                return false;
+            }
+            parsed.payloadLen++;
+        }
+    }
+    record = parsed;
+    return true;
+}
+
+void NciEventTrace::Dump(int fd) const
+{
+    std::vector<NciEventTrace::EventRecord> records = Snapshot();
+    dprintf(fd, "NCI event trace:\n");
+    dprintf(fd, "  total: %" PRIu64 ", dropped: %" PRIu64 ", kept: %zu, capacity: %zu\n", GetTotalCount(),
+        droppedCount_.load(std::memory_order_relaxed), records.size(), TRACE_CAPACITY);
+    for (const NciEventTrace::EventRecord& record : records) {
+        dprintf(fd, "  %s\n", FormatRecord(record).c_str());
+    }
+}
+}  // namespace NCI
+}  // namespace NFC
+}  // namespace OHOS
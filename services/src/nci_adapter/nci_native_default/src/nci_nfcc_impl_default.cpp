@@ -68,6 +68,11 @@ void NciNfccImplDefault::Shutdown()
 void NciNfccImplDefault::NotifyMessageToVendor(int key, const std::string& value)
 {
 }
+
+void NciNfccImplDefault::Dump(int fd)
+{
+    NfccNciAdapter::GetInstance().Dump(static_cast<uint32_t>(fd));
+}
 }  // namespace NCI
 }  // namespace NFC
 }  // namespace OHOS
\ No newline at end of file
@@ -52,6 +52,15 @@ std::vector<AppExecFwk::PacMap> NciTagImplDefault::GetTechExtrasData(uint32_t ta
     return {};
 }
 
+std::vector<KITS::TagTechExtras> NciTagImplDefault::GetTechExtras(uint32_t tagDiscId)
+{
+    auto tag = TagNativeImpl::GetInstance().GetTag(tagDiscId).lock();
+    if (tag) {
+        return tag->GetTechExtras();
+    }
+    return {};
+}
+
 std::string NciTagImplDefault::GetTagUid(uint32_t tagDiscId)
 {
     auto tag = TagNativeImpl::GetInstance().GetTag(tagDiscId).lock();
@@ -97,6 +106,15 @@ int NciTagImplDefault::Transceive(uint32_t tagDiscId, const std::string &command
     return 0;
 }
 
+int NciTagImplDefault::TransceiveBatch(uint32_t tagDiscId, std::vector<TagTransceiveItem> &items)
+{
+    auto tag = TagNativeImpl::GetInstance().GetTag(tagDiscId).lock();
+    if (tag) {
+        return tag->TransceiveBatch(items);
+    }
+    return 0;
+}
+
 std::string NciTagImplDefault::ReadNdef(uint32_t tagDiscId)
 {
     auto tag = TagNativeImpl::GetInstance().GetTag(tagDiscId).lock();
@@ -106,6 +124,24 @@ std::string NciTagImplDefault::ReadNdef(uint32_t tagDiscId)
     return {};
 }
 
+bool NciTagImplDefault::TransceiveAsync(uint32_t tagDiscId, const std::string &command, TagOpCallback callback)
+{
+    auto tag = TagNativeImpl::GetInstance().GetTag(tagDiscId).lock();
+    if (tag) {
+        return tag->TransceiveAsync(command, callback);
+    }
+    return false;
+}
+
+bool NciTagImplDefault::ReadNdefAsync(uint32_t tagDiscId, TagOpCallback callback)
+{
+    auto tag = TagNativeImpl::GetInstance().GetTag(tagDiscId).lock();
+    if (tag) {
+        return tag->ReadNdefAsync(callback);
+    }
+    return false;
+}
+
 std::string NciTagImplDefault::FindNdefTech(uint32_t tagDiscId)
 {
     auto tag = TagNativeImpl::GetInstance().GetTag(tagDiscId).lock();
@@ -213,6 +249,11 @@ uint32_t NciTagImplDefault::GetIsoDepMaxTransceiveLength()
     return TagNativeImpl::GetInstance().GetIsoDepMaxTransceiveLength();
 }
 
+std::vector<INciTagInterface::TagInventoryItem> NciTagImplDefault::GetTagInventory()
+{
+    return TagNativeImpl::GetInstance().GetTagInventory();
+}
+
 bool NciTagImplDefault::IsExtendedLengthApduSupported()
 {
     return TagNativeImpl::GetInstance().GetIsoDepMaxTransceiveLength() > ISO_DEP_FRAME_MAX_LEN;
@@ -18,12 +18,14 @@
 #include <unistd.h>
 
 #include "loghelper.h"
+#include "nci_event_trace.h"
 #include "nfc_config.h"
 #include "nfc_sdk_common.h"
 #include "routing_manager.h"
 #include "securec.h"
 #include "tag_nci_adapter_ntf.h"
 #include "tag_nci_adapter_common.h"
+#include "tag_nci_adapter_rw.h"
 
 using namespace OHOS::NFC;
 namespace OHOS {
@@ -40,6 +42,7 @@ const unsigned int FLAG_MULTI_TAG_MIFARE = 0x02;
 // wait nci event 2000 ms
 const unsigned int NCI_EVT_WAIT_TIMEOUT = 2000;
 const uint16_t RAWDATA_MAX_LEN = 1000;
+const uint8_t BYTE_SHIFT = 8;
 
 NfccNciAdapter::NfccNciAdapter() = default;
 NfccNciAdapter::~NfccNciAdapter() = default;
@@ -361,12 +364,57 @@ void NfccNciAdapter::DoNfaPresenceEvt(tNFA_CONN_EVT_DATA* eventData)
     }
 }
 
+static void TraceConnectionEvent(uint8_t connEvent, tNFA_CONN_EVT_DATA* eventData)
+{
+    // the discovery and activation keep the fields that tell the tags apart, the data only its length.
+    uint8_t status = eventData->status;
+    uint8_t payload[NciEventTrace::MAX_PAYLOAD_LEN] = {0};
+    size_t payloadLen = 0;
+    switch (connEvent) {
+        case NFA_DISC_RESULT_EVT: {
+            const tNFC_RESULT_DEVT& discoveryNtf = eventData->disc_result.discovery_ntf;
+            status = eventData->disc_result.status;
+            payload[payloadLen++] = discoveryNtf.rf_disc_id;
+            payload[payloadLen++] = discoveryNtf.protocol;
+            payload[payloadLen++] = discoveryNtf.rf_tech_param.mode;
+            payload[payloadLen++] = discoveryNtf.more;
+            break;
+        }
+        case NFA_ACTIVATED_EVT: {
+            const tNFC_ACTIVATE_DEVT& activateNtf = eventData->activated.activate_ntf;
+            status = NFA_STATUS_OK;
+            payload[payloadLen++] = activateNtf.rf_disc_id;
+            payload[payloadLen++] = activateNtf.protocol;
+            payload[payloadLen++] = activateNtf.rf_tech_param.mode;
+            payload[payloadLen++] = activateNtf.intf_param.type;
+            break;
+        }
+        case NFA_DEACTIVATED_EVT:
+            status = NFA_STATUS_OK;
+            payload[payloadLen++] = eventData->deactivated.type;
+            break;
+        case NFA_DATA_EVT:
+            payload[payloadLen++] = static_cast<uint8_t>(eventData->data.len >> BYTE_SHIFT);
+            payload[payloadLen++] = static_cast<uint8_t>(eventData->data.len);
+            break;
+        case NFA_NDEF_DETECT_EVT:
+            status = eventData->ndef_detect.status;
+            payload[payloadLen++] = eventData->ndef_detect.protocol;
+            payload[payloadLen++] = eventData->ndef_detect.flags;
+            break;
+        default:
+            break;
+    }
+    NciEventTrace::GetInstance().Record(NciEventTrace::SOURCE_CONN, connEvent, status, payload, payloadLen);
+}
+
 void NfccNciAdapter::NfcConnectionCallback(uint8_t connEvent, tNFA_CONN_EVT_DATA* eventData)
 {
     if (eventData == nullptr) {
         ErrorLog("NfcConnectionCallback, eventData is null. connEvent = %{public}X", connEvent);
         return;
     }
+    TraceConnectionEvent(connEvent, eventData);
     switch (connEvent) {
         /* whether polling successfully started */
         case NFA_POLL_ENABLED_EVT: {
@@ -426,9 +474,9 @@ void NfccNciAdapter::NfcConnectionCallback(uint8_t connEvent, tNFA_CONN_EVT_DATA
         }
         /* Data message received (for non-NDEF reads) */
         case NFA_DATA_EVT: {
-            DebugLog("NfaConnectionCallback: NFA_DATA_EVT: status = 0x%{public}X, len = %{public}d",
+            TransceiveTraceLog("NfaConnectionCallback: NFA_DATA_EVT: status = 0x%{public}X, len = %{public}d",
                 eventData->status, eventData->data.len);
-            TagNciAdapterNtf::GetInstance().HandleTranceiveData(eventData->status, eventData->data.p_data,
+            TagNciAdapterRw::GetInstance().HandleTranceiveData(eventData->status, eventData->data.p_data,
                 eventData->data.len);
             break;
         }
@@ -584,6 +632,7 @@ void NfccNciAdapter::NfcDeviceManagementCallback(uint8_t dmEvent, tNFA_DM_CBACK_
         ErrorLog("NfcDeviceManagementCallback, eventData is null. dmEvent = %{public}X", dmEvent);
         return;
     }
+    NciEventTrace::GetInstance().Record(NciEventTrace::SOURCE_DM, dmEvent, eventData->status);
     DebugLog("NfaDeviceManagementCallback: event= %{public}u", dmEvent);
 
     switch (dmEvent) {
@@ -1001,6 +1050,9 @@ void NfccNciAdapter::Dump(uint32_t fd) const
 {
     DebugLog("NfccNciAdapter::Dump, fd=%{public}d", fd);
     NfcAdaptation::GetInstance().Dump(fd);
+    TagNciAdapterRw::GetInstance().Dump(static_cast<int>(fd));
+    RoutingManager::GetInstance().Dump(static_cast<int>(fd));
+    NciEventTrace::GetInstance().Dump(static_cast<int>(fd));
 }
 
 /**
@@ -1079,6 +1131,17 @@ void  NfccNciAdapter::OnCardEmulationDeactivated()
     }
     cardEmulationListenerPtr->OnCardEmulationDeactivated();
 }
+
+void NfccNciAdapter::OnEeInfoChanged()
+{
+    DebugLog("NfccNciAdapter::OnEeInfoChanged");
+    auto cardEmulationListenerPtr = cardEmulationListener_.lock();
+    if (cardEmulationListenerPtr == nullptr) {
+        ErrorLog("cardEmulationListener_ is null");
+        return;
+    }
+    cardEmulationListenerPtr->OnEeInfoChanged();
+}
 }  // namespace NCI
 }  // namespace NFC
 }  // namespace OHOS
@@ -13,9 +13,12 @@
  * limitations under the License.
  */
 #include "routing_manager.h"
+#include <algorithm>
+#include <cstdio>
 #include <unistd.h>
 #include <securec.h>
 #include "loghelper.h"
+#include "nci_event_trace.h"
 #include "nfc_config.h"
 #include "nfc_sdk_common.h"
 
@@ -35,8 +38,11 @@ static const std::vector<uint8_t> DEFAULT_UICC_ROUTE_DEST = {0x02, 0x03};
 static const tNFA_EE_PWR_STATE DEFAULT_SYS_CODE_PWR_STA = 0x00;
 static const tNFA_HANDLE DEFAULT_SYS_CODE_ROUTE_DEST = 0xC0;
 static const uint8_t MAX_NUM_OF_EE = 5;
-static const int EE_INFO_WAITE_INTERVAL = 100 * 1000; // ms for usleep
+static const long EE_REGISTER_WAIT_TIME_MS = 2000;
+static const long EE_INFO_WAIT_TIME_MS = 1000;
+static const long EE_UPDATE_WAIT_TIME_MS = 2000;
 static const int AID_DEFAULT_ROUTING_WAIT_TIME_MS = 2000;
+static const uint8_t BYTE_SHIFT = 8;
 
 // power state masks
 static const uint8_t PWR_STA_SWTCH_ON_SCRN_UNLCK = 0x01;
@@ -56,6 +62,15 @@ static const uint32_t ROUTE_LOC_HOST_ID = 0x400;
 static const uint32_t ROUTE_LOC_ESE_ID = 0x4C0;
 static const uint32_t ROUTE_UICC1_ID = 0x480;
 static const uint32_t ROUTE_UICC2_ID = 0x481;
+
+// bytes of the listen mode routing table taken by the entries other than the aids
+static const uint32_t PROTO_ROUTING_ENTRY_SIZE = 5;
+static const uint32_t TECH_ROUTING_ENTRY_SIZE = 5;
+static const uint32_t NUM_OF_TECH_ROUTING_ENTRY = 2; // type A and type B
+static const uint32_t SYS_CODE_ROUTING_ENTRY_SIZE = 6;
+static const uint32_t EMPTY_AID_ROUTING_ENTRY_SIZE = 4; // the default aid route
+static const uint32_t RESERVED_ROUTING_TABLE_SIZE = PROTO_ROUTING_ENTRY_SIZE +
+    TECH_ROUTING_ENTRY_SIZE * NUM_OF_TECH_ROUTING_ENTRY + SYS_CODE_ROUTING_ENTRY_SIZE + EMPTY_AID_ROUTING_ENTRY_SIZE;
 static const uint32_t DEFAULT_PROTO_ROUTE_AND_POWER_ESE = 0x013B;
 static const uint32_t DEFAULT_PROTO_ROUTE_AND_POWER_SIM1 = 0x023B;
 static const uint8_t ROUTE_LOC_MASK = 8;
@@ -68,35 +83,86 @@ RoutingManager& RoutingManager::GetInstance()
     return manager;
 }
 
-bool RoutingManager::Initialize()
+uint32_t RoutingManager::GetElapsedMs(std::chrono::steady_clock::time_point start)
 {
-    mRxDataBuffer.clear();
-    tNFA_STATUS status;
-    {
-        SynchronizeGuard guard(eeRegisterEvent_);
-        InfoLog("Initialize: try ee register");
-        status = NFA_EeRegister(NfaEeCallback);
-        if (status != NFA_STATUS_OK) {
-            ErrorLog("Initialize: fail ee register; error=0x%{public}X", status);
-            return false;
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+bool RoutingManager::RegisterEe()
+{
+    auto start = std::chrono::steady_clock::now();
+    SynchronizeGuard guard(eeRegisterEvent_);
+    InfoLog("Initialize: try ee register");
+    eeState_ = EE_STATE_REGISTERING;
+    tNFA_STATUS status = NFA_EeRegister(NfaEeCallback);
+    if (status != NFA_STATUS_OK) {
+        ErrorLog("Initialize: fail ee register; error=0x%{public}X", status);
+        eeState_ = EE_STATE_FAILED;
+        return false;
+    }
+    // the state is checked again on every wake up, ClearAllEvents wakes up the waiters too.
+    auto deadline = start + std::chrono::milliseconds(EE_REGISTER_WAIT_TIME_MS);
+    while (eeState_ == EE_STATE_REGISTERING) {
+        long remainingMs = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count());
+        if (remainingMs <= 0 || !eeRegisterEvent_.Wait(remainingMs)) {
+            break;
         }
-        eeRegisterEvent_.Wait(); // wait for NFA_EE_REGISTER_EVT
     }
+    enableTiming_.eeRegisterMs = GetElapsedMs(start);
+    if (eeState_ == EE_STATE_REGISTERING) {
+        ErrorLog("Initialize: ee register timeout after %{public}u ms", enableTiming_.eeRegisterMs);
+        enableTiming_.eeRegisterTimeouts++;
+        eeState_ = EE_STATE_FAILED;
+        return false;
+    }
+    return true;
+}
 
-    // NFA_EE_REGISTER_EVT and NFA_EE_DISCOVER_REQ_EVT may come at the same time
-    // wait 100ms here to avoid timing issue in executing eeInfoEvent_
-    usleep(EE_INFO_WAITE_INTERVAL);
+void RoutingManager::WaitForEeInfo()
+{
+    auto start = std::chrono::steady_clock::now();
+    SynchronizeGuard guard(eeInfoEvent_);
+    // NFA_EE_DISCOVER_REQ_EVT may have come with NFA_EE_REGISTER_EVT, it is checked under the lock of the event.
     if ((defaultOffHostRoute_ != 0) || (defaultFelicaRoute_ != 0)) {
-        SynchronizeGuard guard(eeInfoEvent_);
-        if (!isEeInfoReceived_) {
+        auto deadline = start + std::chrono::milliseconds(EE_INFO_WAIT_TIME_MS);
+        while (!isEeInfoReceived_) {
+            long remainingMs = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count());
+            if (remainingMs <= 0) {
+                break;
+            }
             InfoLog("Initialize: Waiting for EE info");
-            eeInfoEvent_.Wait(); // wait for NFA_EE_DISCOVER_REQ_EVT if eeinfo not received
+            if (!eeInfoEvent_.Wait(remainingMs)) {
+                break;
+            }
+        }
+        if (!isEeInfoReceived_) {
+            // the off host routes are set up on the next commit once the EE info comes.
+            WarnLog("Initialize: no EE info in %{public}ld ms, continue with the host routes", EE_INFO_WAIT_TIME_MS);
+            enableTiming_.eeInfoTimeouts++;
         }
     }
+    enableTiming_.eeInfoWaitMs = GetElapsedMs(start);
+    eeState_ = EE_STATE_READY;
+}
+
+bool RoutingManager::Initialize()
+{
+    auto start = std::chrono::steady_clock::now();
+    mRxDataBuffer.clear();
+    // the routing of the NFCC is set up again, nothing of the last enable is kept.
+    InvalidateRoutingState();
+    enableTiming_.initCount++;
+    if (!RegisterEe()) {
+        return false;
+    }
+    WaitForEeInfo();
     seTechMask_ = UpdateEeTechRouteSetting();
 
     // Set the host-routing Tech
-    status = NFA_CeSetIsoDepListenTech(
+    tNFA_STATUS status = NFA_CeSetIsoDepListenTech(
         hostListenTechMask_ & (NFA_TECHNOLOGY_MASK_A | NFA_TECHNOLOGY_MASK_B));
     if (status != NFA_STATUS_OK) {
         ErrorLog("Initialize: Failed to configure CE IsoDep technologies");
@@ -111,9 +177,30 @@ bool RoutingManager::Initialize()
     UpdateDefaultRoute();
     UpdateDefaultProtoRoute();
     SetOffHostNfceeTechMask();
+    enableTiming_.initializeMs = GetElapsedMs(start);
+    InfoLog("Initialize: done in %{public}u ms, ee register %{public}u ms, ee info %{public}u ms",
+        enableTiming_.initializeMs, enableTiming_.eeRegisterMs, enableTiming_.eeInfoWaitMs);
     return true;
 }
 
+void RoutingManager::Dump(int fd) const
+{
+    dprintf(fd, "Routing manager:\n");
+    dprintf(fd, "  ee state: %d, initialized %u times, ee register timeouts: %u, ee info timeouts: %u\n",
+        static_cast<int>(eeState_.load()), enableTiming_.initCount, enableTiming_.eeRegisterTimeouts,
+        enableTiming_.eeInfoTimeouts);
+    dprintf(fd, "  last initialize: %u ms, ee register: %u ms, ee info wait: %u ms\n",
+        enableTiming_.initializeMs, enableTiming_.eeRegisterMs, enableTiming_.eeInfoWaitMs);
+    std::lock_guard<std::mutex> lock(routingStateMutex_);
+    const CommitStats& stats = commitStats_;
+    uint64_t avgCommitMs = (stats.commitCount == 0) ? 0 : (stats.totalCommitMs / stats.commitCount);
+    dprintf(fd, "  commits: %u, skipped commits: %u, unchanged entries: %u, commit timeouts: %u, pending: %d\n",
+        stats.commitCount, stats.skippedCommitCount, stats.skippedEntryCount, stats.commitTimeouts,
+        hasPendingChanges_);
+    dprintf(fd, "  commit latency: last %u ms, avg %llu ms, max %u ms\n", stats.lastCommitMs,
+        static_cast<unsigned long long>(avgCommitMs), stats.maxCommitMs);
+}
+
 void RoutingManager::UpdateDefaultProtoRoute()
 {
     // update default proto route for iso-dep
@@ -149,29 +236,129 @@ void RoutingManager::SetOffHostNfceeTechMask()
     }
 }
 
-bool RoutingManager::ComputeRoutingParams(int defaultPaymentType)
+RoutingManager::RoutingState RoutingManager::BuildRoutingState(int defaultPaymentType)
 {
-    InfoLog("ComputeRoutingParams");
-    uint8_t valueProtoIsoDep = 0x01;
+    RoutingState state;
+    state.isSecureNfcEnabled = isSecureNfcEnabled_;
 
     // route for protocol
-    ClearRoutingEntry(NFA_SET_PROTO_ROUTING);
     uint32_t defaultRouteAndPower = GetDefaultProtoRouteAndPower(defaultPaymentType);
-    SetRoutingEntry(NFA_SET_PROTO_ROUTING, valueProtoIsoDep,
-                    ((defaultRouteAndPower >> ROUTE_LOC_MASK) & DEFAULT_LISTEN_TECH_MASK),
-                    defaultRouteAndPower & PWR_STA_MASK);
+    state.protoIsoDep.route = static_cast<uint32_t>(GetDefaultAidRoute(defaultPaymentType));
+    state.protoIsoDep.power = defaultRouteAndPower & PWR_STA_MASK;
 
     // route for technology
     // currently set tech F default to ese with power 0x3B
-    uint8_t techSeId = DEFAULT_EE_ROUTE_DEST;
-    uint8_t techFSeId = DEFAULT_EE_ROUTE_DEST;
+    state.techAB.route = DEFAULT_EE_ROUTE_DEST;
+    state.techAB.power = DEFAULT_PWR_STA_FOR_TECH_A_B;
+    state.techF.route = DEFAULT_EE_ROUTE_DEST;
+    state.techF.power = DEFAULT_PWR_STA_FOR_TECH_A_B;
+
+    // route for the aids not in the aid table
+    tNFA_HANDLE handle = GetEeHandle(state.protoIsoDep.route);
+    state.defaultAid.route = handle;
+    state.defaultAid.power = state.protoIsoDep.power;
+    if (handle == ROUTE_LOC_HOST_ID || isSecureNfcEnabled_) {
+        state.defaultAid.power = PWR_STA_SWTCH_ON_SCRN_UNLCK;
+    }
+    return state;
+}
+
+void RoutingManager::InvalidateRoutingState()
+{
+    std::lock_guard<std::mutex> lock(routingStateMutex_);
+    routingState_ = RoutingState();
+    isDefaultAidRouted_ = false;
+    hasPendingChanges_ = true;
+}
+
+RoutingManager::RoutingDiff RoutingManager::DiffRoutingState(const RoutingState& current,
+    const RoutingState& desired, bool isDefaultAidRouted)
+{
+    RoutingDiff diff;
+    bool isAllChanged = current.isSecureNfcEnabled != desired.isSecureNfcEnabled;
+    diff.isProtoIsoDepChanged = isAllChanged || !current.protoIsoDep.isSet ||
+        current.protoIsoDep != desired.protoIsoDep;
+    diff.isTechChanged = isAllChanged || !current.techAB.isSet || !current.techF.isSet ||
+        current.techAB != desired.techAB || current.techF != desired.techF;
+    diff.isDefaultAidChanged = isAllChanged || !isDefaultAidRouted || !current.defaultAid.isSet ||
+        current.defaultAid != desired.defaultAid;
+    diff.skippedCount = static_cast<uint32_t>(!diff.isProtoIsoDepChanged) +
+        static_cast<uint32_t>(!diff.isTechChanged) + static_cast<uint32_t>(!diff.isDefaultAidChanged);
+    return diff;
+}
+
+RoutingManager::RoutingDiff RoutingManager::ApplyRoutingDiff(const RoutingState& desired, const RoutingDiff& diff)
+{
+    uint8_t valueProtoIsoDep = 0x01;
     uint8_t techRouteForTypeAB = 0x03;
     uint8_t techRouteForTypeF = 0x04;
-    ClearRoutingEntry(NFA_SET_TECH_ROUTING);
-    SetRoutingEntry(NFA_SET_TECH_ROUTING, techRouteForTypeAB, techSeId, DEFAULT_PWR_STA_FOR_TECH_A_B);
-    SetRoutingEntry(NFA_SET_TECH_ROUTING, techRouteForTypeF, techFSeId, DEFAULT_PWR_STA_FOR_TECH_A_B);
+    RoutingDiff applied;
+    if (diff.isProtoIsoDepChanged) {
+        bool isCleared = ClearRoutingEntry(NFA_SET_PROTO_ROUTING);
+        applied.isProtoIsoDepChanged = SetRoutingEntry(NFA_SET_PROTO_ROUTING, valueProtoIsoDep,
+            desired.protoIsoDep.route, desired.protoIsoDep.power) && isCleared;
+    }
+    // clearing the tech routing clears both of the entries
+    if (diff.isTechChanged) {
+        bool isCleared = ClearRoutingEntry(NFA_SET_TECH_ROUTING);
+        bool isTechABSet = SetRoutingEntry(NFA_SET_TECH_ROUTING, techRouteForTypeAB, desired.techAB.route,
+            desired.techAB.power);
+        bool isTechFSet = SetRoutingEntry(NFA_SET_TECH_ROUTING, techRouteForTypeF, desired.techF.route,
+            desired.techF.power);
+        applied.isTechChanged = isCleared && isTechABSet && isTechFSet;
+    }
+    if (diff.isDefaultAidChanged) {
+        applied.isDefaultAidChanged = SetDefaultAidRoute(desired.defaultAid.route, desired.defaultAid.power);
+    }
+    return applied;
+}
+
+void RoutingManager::RecordRoutingState(const RoutingState& desired, const RoutingDiff& diff,
+    const RoutingDiff& applied)
+{
+    // an entry failed to set is left unset, so the next compute sets it again.
+    RoutingState& current = routingState_;
+    current.isSecureNfcEnabled = desired.isSecureNfcEnabled;
+    if (diff.isProtoIsoDepChanged) {
+        current.protoIsoDep = desired.protoIsoDep;
+        current.protoIsoDep.isSet = applied.isProtoIsoDepChanged;
+    }
+    if (diff.isTechChanged) {
+        current.techAB = desired.techAB;
+        current.techAB.isSet = applied.isTechChanged;
+        current.techF = desired.techF;
+        current.techF.isSet = applied.isTechChanged;
+    }
+    if (diff.isDefaultAidChanged) {
+        current.defaultAid = desired.defaultAid;
+        current.defaultAid.isSet = applied.isDefaultAidChanged;
+        isDefaultAidRouted_ = applied.isDefaultAidChanged;
+    }
+    if (diff.isProtoIsoDepChanged || diff.isTechChanged || diff.isDefaultAidChanged) {
+        hasPendingChanges_ = true;
+    }
+    commitStats_.skippedEntryCount += diff.skippedCount;
+}
 
-    SetDefaultAidRoute(defaultPaymentType);
+bool RoutingManager::ComputeRoutingParams(int defaultPaymentType)
+{
+    InfoLog("ComputeRoutingParams");
+    RoutingState desired = BuildRoutingState(defaultPaymentType);
+    std::lock_guard<std::mutex> commitLock(routingCommitMutex_);
+    // only the entries differing from the ones set to the NFCC are set again.
+    RoutingDiff diff;
+    {
+        std::lock_guard<std::mutex> lock(routingStateMutex_);
+        diff = DiffRoutingState(routingState_, desired, isDefaultAidRouted_);
+    }
+    // the NFA calls wait for their events, out of the state lock.
+    RoutingDiff applied = ApplyRoutingDiff(desired, diff);
+    std::lock_guard<std::mutex> lock(routingStateMutex_);
+    RecordRoutingState(desired, diff, applied);
+    InfoLog("ComputeRoutingParams: %{public}u entries unchanged, proto %{public}d/%{public}d, "
+        "tech %{public}d/%{public}d, default aid %{public}d/%{public}d, pending changes %{public}d",
+        diff.skippedCount, diff.isProtoIsoDepChanged, applied.isProtoIsoDepChanged, diff.isTechChanged,
+        applied.isTechChanged, diff.isDefaultAidChanged, applied.isDefaultAidChanged, hasPendingChanges_);
     return true;
 }
 
@@ -209,6 +396,8 @@ bool RoutingManager::AddAidRouting(const std::string &aidStr, int route,
     tNFA_STATUS status = NFA_EeAddAidRouting(route, aidLen, static_cast<uint8_t*>(aidBytes.data()), power, aidInfo);
     if (status == NFA_STATUS_OK) {
         InfoLog("AddAidRouting: Succeed ");
+        std::lock_guard<std::mutex> lock(routingStateMutex_);
+        hasPendingChanges_ = true;
         return true;
     } else {
         ErrorLog("AddAidRouting: failed ");
@@ -223,6 +412,10 @@ bool RoutingManager::ClearAidTable()
         reinterpret_cast<uint8_t *>(NFA_REMOVE_ALL_AID));
     if (status == NFA_STATUS_OK) {
         InfoLog("ClearAidTable: Succeed ");
+        // the zero length aid is removed with the others
+        std::lock_guard<std::mutex> lock(routingStateMutex_);
+        isDefaultAidRouted_ = false;
+        hasPendingChanges_ = true;
         return true;
     } else {
         ErrorLog("ClearAidTable: failed ");
@@ -230,13 +423,30 @@ bool RoutingManager::ClearAidTable()
     }
 }
 
+uint32_t RoutingManager::GetAidRoutingTableSize()
+{
+    uint32_t lmrtSize = NFC_GetLmrtSize();
+    if (lmrtSize <= RESERVED_ROUTING_TABLE_SIZE) {
+        WarnLog("GetAidRoutingTableSize: lmrt size %{public}u unknown or too small", lmrtSize);
+        return 0;
+    }
+    return lmrtSize - RESERVED_ROUTING_TABLE_SIZE;
+}
+
+int RoutingManager::GetDefaultAidRoute(int defaultPaymentType)
+{
+    // the zero length aid entry follows the iso-dep route
+    uint32_t defaultRouteAndPower = GetDefaultProtoRouteAndPower(defaultPaymentType);
+    return static_cast<int>((defaultRouteAndPower >> ROUTE_LOC_MASK) & DEFAULT_LISTEN_TECH_MASK);
+}
+
 bool RoutingManager::SetRoutingEntry(uint32_t type, uint32_t value, uint32_t route, uint32_t power)
 {
     InfoLog("SetRoutingEntry: type:0x%{public}X, value:0x%{public}X, route:0x%{public}X, power:0x%{public}X",
         type, value, route, power);
     uint8_t maxTechMask = 0x03; // 0x01 for type A, 0x02 for type B, 0x03 for both
     uint8_t last4BitsMask = 0xF0;
-    tNFA_STATUS status = NFA_STATUS_FAILED;
+    bool isSet = true;
     tNFA_HANDLE handle = GetEeHandle(route);
     uint8_t swtchOnMask = 0;
     uint8_t swtchOffMask = 0;
@@ -261,8 +471,8 @@ bool RoutingManager::SetRoutingEntry(uint32_t type, uint32_t value, uint32_t rou
         scrnOffMask = (power & PWR_STA_SWTCH_ON_SCRN_OFF) ? value : 0;
         scrnOffLockMask = (power & PWR_STA_SWTCH_ON_SCRN_OFF_LOCK) ? value : 0;
         if (hostListenTechMask_) {
-            RegisterTechRoutingEntry(handle, swtchOnMask, swtchOffMask, battOffMask, scrnLockMask, scrnOffMask,
-                scrnOffLockMask);
+            isSet = RegisterTechRoutingEntry(handle, swtchOnMask, swtchOffMask, battOffMask, scrnLockMask,
+                scrnOffMask, scrnOffLockMask);
         }
     } else if (type == NFA_SET_PROTO_ROUTING) {
         value &= ~last4BitsMask;
@@ -273,7 +483,7 @@ bool RoutingManager::SetRoutingEntry(uint32_t type, uint32_t value, uint32_t rou
                 (maxTechMask & (NFA_TECHNOLOGY_MASK_A | NFA_TECHNOLOGY_MASK_B)) == 0) {
                 InfoLog("SetRoutingEntry: proto entry rejected, handle 0x%{public}x does not support"
                     "proto mask 0x%{public}x", handle, protoMask);
-                return status;
+                return false;
             }
             swtchOnMask = (power & PWR_STA_SWTCH_ON_SCRN_UNLCK) ? protoMask : 0;
             swtchOffMask = (power & PWR_STA_SWTCH_OFF) ? protoMask : 0;
@@ -281,39 +491,29 @@ bool RoutingManager::SetRoutingEntry(uint32_t type, uint32_t value, uint32_t rou
             scrnLockMask = (power & PWR_STA_SWTCH_ON_SCRN_LOCK) ? protoMask : 0;
             scrnOffMask = (power & PWR_STA_SWTCH_ON_SCRN_OFF) ? protoMask : 0;
             scrnOffLockMask = (power & PWR_STA_SWTCH_ON_SCRN_OFF_LOCK) ? protoMask : 0;
-            RegisterProtoRoutingEntry(handle, swtchOnMask, swtchOffMask, battOffMask, scrnLockMask, scrnOffMask,
-                scrnOffLockMask);
+            isSet = RegisterProtoRoutingEntry(handle, swtchOnMask, swtchOffMask, battOffMask, scrnLockMask,
+                scrnOffMask, scrnOffLockMask) && isSet;
             protoMask = 0;
         }
     }
-    return status;
+    return isSet;
 }
 
-void RoutingManager::SetDefaultAidRoute(int defaultPaymentType)
+bool RoutingManager::SetDefaultAidRoute(tNFA_HANDLE handle, uint32_t power)
 {
     tNFA_STATUS status = NFA_STATUS_FAILED;
     SynchronizeGuard guard(routingEvent_);
-    uint32_t defaultRouteAndPower = GetDefaultProtoRouteAndPower(defaultPaymentType);
-    uint32_t routeLoc = (defaultRouteAndPower >> ROUTE_LOC_MASK) & DEFAULT_LISTEN_TECH_MASK;
-    uint32_t power = defaultRouteAndPower & PWR_STA_MASK;
-    tNFA_HANDLE handle = GetEeHandle(routeLoc);
-    if (handle == ROUTE_LOC_HOST_ID) {
-        power = PWR_STA_SWTCH_ON_SCRN_UNLCK;
-    }
-
-    if (isSecureNfcEnabled_) {
-        power = PWR_STA_SWTCH_ON_SCRN_UNLCK;
-    }
     status = NFA_EeAddAidRouting(handle, 0, NULL, power, AID_ROUTE_QUAL_PREFIX);
     if (status == NFA_STATUS_OK) {
         if (routingEvent_.Wait(AID_DEFAULT_ROUTING_WAIT_TIME_MS) == false) {
             ErrorLog("SetDefaultAidRoute:  register zero length AID time out ");
-        } else {
-            InfoLog("SetDefaultAidRoute: Succeed to register zero length AID");
+            return false;
         }
-    } else {
-        ErrorLog("SetDefaultAidRoute: failed to register zero length AID");
+        InfoLog("SetDefaultAidRoute: Succeed to register zero length AID");
+        return true;
     }
+    ErrorLog("SetDefaultAidRoute: failed to register zero length AID");
+    return false;
 }
 
 uint8_t RoutingManager::GetProtoMaskFromTechMask(uint32_t& value)
@@ -334,7 +534,7 @@ uint8_t RoutingManager::GetProtoMaskFromTechMask(uint32_t& value)
     return 0;
 }
 
-void RoutingManager::RegisterProtoRoutingEntry(tNFA_HANDLE eeHandle,
+bool RoutingManager::RegisterProtoRoutingEntry(tNFA_HANDLE eeHandle,
     tNFA_PROTOCOL_MASK protoSwitchOn, tNFA_PROTOCOL_MASK protoSwitchOff,
     tNFA_PROTOCOL_MASK protoBatteryOn, tNFA_PROTOCOL_MASK protoScreenLock,
     tNFA_PROTOCOL_MASK protoScreenOff, tNFA_PROTOCOL_MASK protoSwitchOffLock)
@@ -355,9 +555,10 @@ void RoutingManager::RegisterProtoRoutingEntry(tNFA_HANDLE eeHandle,
             ErrorLog("RegisterProtoRoutingEntry: Register Proto Routing Entry Failed");
         }
     }
+    return (status == NFA_STATUS_OK);
 }
 
-void RoutingManager::RegisterTechRoutingEntry(tNFA_HANDLE eeHandle,
+bool RoutingManager::RegisterTechRoutingEntry(tNFA_HANDLE eeHandle,
     tNFA_PROTOCOL_MASK protoSwitchOn, tNFA_PROTOCOL_MASK protoSwitchOff,
     tNFA_PROTOCOL_MASK protoBatteryOn, tNFA_PROTOCOL_MASK protoScreenLock,
     tNFA_PROTOCOL_MASK protoScreenOff, tNFA_PROTOCOL_MASK protoSwitchOffLock)
@@ -378,6 +579,7 @@ void RoutingManager::RegisterTechRoutingEntry(tNFA_HANDLE eeHandle,
             ErrorLog("RegisterTechRoutingEntry: Register Tech Routing Entry Failed");
         }
     }
+    return (status == NFA_STATUS_OK);
 }
 
 bool RoutingManager::ClearRoutingEntry(uint32_t type)
@@ -548,6 +750,7 @@ void RoutingManager::ClearAllEvents()
 void RoutingManager::Deinitialize()
 {
     InfoLog("Deinitialize");
+    InvalidateRoutingState();
     ClearAllEvents();
     OnNfcDeinit();
 }
@@ -612,17 +815,49 @@ tNFA_TECHNOLOGY_MASK RoutingManager::UpdateEeTechRouteSetting()
 bool RoutingManager::CommitRouting()
 {
     tNFA_STATUS status = 0;
-    if (isEeInfoChanged_) {
-        seTechMask_ = UpdateEeTechRouteSetting();
+    std::lock_guard<std::mutex> commitLock(routingCommitMutex_);
+    bool isEeInfoChanged = false;
+    {
+        SynchronizeGuard guard(eeInfoEvent_);
+        isEeInfoChanged = isEeInfoChanged_;
         isEeInfoChanged_ = false;
     }
+    // the NFA calls wait for their events, out of the state lock.
+    if (isEeInfoChanged) {
+        seTechMask_ = UpdateEeTechRouteSetting();
+    }
+    {
+        std::lock_guard<std::mutex> lock(routingStateMutex_);
+        hasPendingChanges_ = hasPendingChanges_ || isEeInfoChanged;
+        if (!hasPendingChanges_) {
+            commitStats_.skippedCommitCount++;
+            InfoLog("CommitRouting: routing unchanged, skip update");
+            return true;
+        }
+        // changes made during the update are committed on the next one
+        hasPendingChanges_ = false;
+    }
+    auto start = std::chrono::steady_clock::now();
+    bool isTimeout = false;
     {
         SynchronizeGuard guard(eeUpdateEvent_);
         status = NFA_EeUpdateNow();
-        if (status == NFA_STATUS_OK) {
-            eeUpdateEvent_.Wait();  // wait for NFA_EE_UPDATED_EVT
+        if (status == NFA_STATUS_OK && !eeUpdateEvent_.Wait(EE_UPDATE_WAIT_TIME_MS)) { // wait for NFA_EE_UPDATED_EVT
+            ErrorLog("CommitRouting: update timeout");
+            isTimeout = true;
+            status = NFA_STATUS_FAILED;
         }
     }
+    uint32_t costMs = GetElapsedMs(start);
+    std::lock_guard<std::mutex> lock(routingStateMutex_);
+    commitStats_.commitTimeouts += static_cast<uint32_t>(isTimeout);
+    commitStats_.commitCount++;
+    commitStats_.lastCommitMs = costMs;
+    commitStats_.maxCommitMs = std::max(commitStats_.maxCommitMs, costMs);
+    commitStats_.totalCommitMs += costMs;
+    // a failed commit is retried on the next one
+    hasPendingChanges_ = hasPendingChanges_ || (status != NFA_STATUS_OK);
+    InfoLog("CommitRouting: status 0x%{public}X in %{public}u ms", status, costMs);
     return (status == NFA_STATUS_OK);
 }
 
@@ -640,6 +875,15 @@ void RoutingManager::NfaCeStackCallback(uint8_t event,
         ErrorLog("NfaCeStackCallback: eventData is null");
         return;
     }
+    if (event == NFA_CE_DATA_EVT) {
+        // only the length of the apdu, not its content.
+        uint8_t dataLen[] = {static_cast<uint8_t>(eventData->ce_data.len >> BYTE_SHIFT),
+            static_cast<uint8_t>(eventData->ce_data.len)};
+        NciEventTrace::GetInstance().Record(NciEventTrace::SOURCE_CE, event, eventData->ce_data.status, dataLen,
+            sizeof(dataLen));
+    } else {
+        NciEventTrace::GetInstance().Record(NciEventTrace::SOURCE_CE, event, eventData->status);
+    }
     InfoLog("NfaCeStackCallback: event = %{public}d", event);
     switch (event) {
         case NFA_EE_REGISTER_EVT: {
@@ -703,6 +947,7 @@ void RoutingManager::NfaEeCallback(tNFA_EE_EVT event, tNFA_EE_CBACK_DATA* eventD
         ErrorLog("NfaEeCallback: eventData is null");
         return;
     }
+    NciEventTrace::GetInstance().Record(NciEventTrace::SOURCE_EE, event, eventData->status);
     InfoLog("NfaEeCallback: event = %{public}d, status=0x%{public}X", event, eventData->status);
     switch (event) {
         case NFA_EE_REGISTER_EVT: {
@@ -779,6 +1024,9 @@ void RoutingManager::DoNfaEeRegisterEvent()
     RoutingManager& rm = RoutingManager::GetInstance();
     SynchronizeGuard guard(rm.eeRegisterEvent_);
     InfoLog("NfaEeCallback: NFA_EE_REGISTER_EVT");
+    if (rm.eeState_ == EE_STATE_REGISTERING) {
+        rm.eeState_ = EE_STATE_WAITING_INFO;
+    }
     rm.eeRegisterEvent_.NotifyOne();
 }
 
@@ -795,8 +1043,10 @@ void RoutingManager::DoNfaEeDeregisterEvent(tNFA_EE_CBACK_DATA* eventData)
 {
     RoutingManager& rm = RoutingManager::GetInstance();
     InfoLog("NfaEeCallback: NFA_EE_DEREGISTER_EVT status=0x%{public}X", eventData->status);
+    SynchronizeGuard guard(rm.eeInfoEvent_);
     rm.isEeInfoReceived_ = false;
     rm.isDeinitializing_ = false;
+    rm.eeState_ = EE_STATE_IDLE;
 }
 
 void RoutingManager::NotifyRoutingEvent()
@@ -820,16 +1070,26 @@ void RoutingManager::DoNfaEeDiscoverReqEvent(tNFA_EE_CBACK_DATA* eventData)
     InfoLog("NfaEeCallback: NFA_EE_DISCOVER_REQ_EVT; status=0x%{public}X; num ee=%{public}u",
         eventData->discover_req.status, eventData->discover_req.num_ee);
     RoutingManager& rm = RoutingManager::GetInstance();
-    SynchronizeGuard guard(rm.eeInfoEvent_);
-    int status = memcpy_s(&rm.eeInfo_, sizeof(rm.eeInfo_), &eventData->discover_req, sizeof(rm.eeInfo_));
-    if (status != 0) {
-        return;
+    bool isLateEeInfo = false;
+    {
+        SynchronizeGuard guard(rm.eeInfoEvent_);
+        int status = memcpy_s(&rm.eeInfo_, sizeof(rm.eeInfo_), &eventData->discover_req, sizeof(rm.eeInfo_));
+        if (status != 0) {
+            return;
+        }
+        // the EE info coming after Initialize applied the routes is applied on the next commit.
+        if ((rm.isEeInfoReceived_ || rm.eeState_ == EE_STATE_READY) && !rm.isDeinitializing_) {
+            rm.isEeInfoChanged_ = true;
+            isLateEeInfo = (rm.eeState_ == EE_STATE_READY);
+        }
+        rm.isEeInfoReceived_ = true;
+        rm.eeInfoEvent_.NotifyOne();
     }
-    if (rm.isEeInfoReceived_ && !rm.isDeinitializing_) {
-        rm.isEeInfoChanged_ = true;
+    // no commit may come until the next app or payment change, ask the service for one. it is posted to the
+    // event handler of the service, the NFA callback thread can't wait for the routing events itself.
+    if (isLateEeInfo) {
+        NfccNciAdapter::GetInstance().OnEeInfoChanged();
     }
-    rm.isEeInfoReceived_ = true;
-    rm.eeInfoEvent_.NotifyOne();
 }
 
 void RoutingManager::DoNfaEeUpdateEvent()
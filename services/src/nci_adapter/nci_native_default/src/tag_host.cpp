@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "tag_host.h"
+#include <iterator>
 #include <thread>
 #include <unistd.h>
 #include "loghelper.h"
@@ -45,6 +46,7 @@ TagHost::TagHost(const std::vector<int>& tagTechList,
       connectedTechIndex_(connectedTechIndex),
       isTagFieldOn_(true),
       isFieldChecking_(false),
+      isFieldCheckingStarted_(false),
       isPauseFieldChecking_(false),
       isSkipNextFieldChecking_(false),
       addNdefTech_(false)
@@ -61,6 +63,16 @@ TagHost::~TagHost()
     tagActivatedBytes_.clear();
 }
 
+void TagHost::SetGeneration(uint32_t generation)
+{
+    generation_ = generation;
+}
+
+uint32_t TagHost::GetGeneration()
+{
+    return generation_;
+}
+
 bool TagHost::Connect(int technology)
 {
     DebugLog("TagHost::Connect tech = %{public}d", technology);
@@ -102,6 +114,16 @@ bool TagHost::Disconnect()
     std::lock_guard<std::mutex> lock(mutex_);
     connectedTagDiscId_ = DEFAULT_VALUE;
     connectedTechIndex_ = DEFAULT_VALUE;
+    if (!isFieldCheckingStarted_) {
+        // no field checking thread to release the tag, disconnect it here to resume the polling.
+        if (isTagFieldOn_) {
+            isTagFieldOn_ = false;
+            TagNciAdapterCommon::GetInstance().ResetTag();
+            TagNciAdapterRw::GetInstance().Disconnect();
+        }
+        DebugLog("TagHost::Disconnect exit, no field checking");
+        return true;
+    }
     StopFieldCheckingInner();
     DebugLog("TagHost::Disconnect exit");
     return true;
@@ -133,6 +155,34 @@ int TagHost::Transceive(const std::string& request, std::string& response)
     return status;
 }
 
+int TagHost::TransceiveBatch(std::vector<INciTagInterface::TagTransceiveItem>& items)
+{
+    DebugLog("TagHost::TransceiveBatch, size = %{public}zu", items.size());
+    PauseFieldChecking();
+    std::lock_guard<std::mutex> lock(mutex_);
+    int count = TagNciAdapterRw::GetInstance().TransceiveBatch(items);
+    // the batch may leave another tag of the field selected
+    uint32_t techIdx = TagNciAdapterCommon::GetInstance().connectedTechIdx_;
+    if (techIdx < tagRfDiscIdList_.size()) {
+        connectedTagDiscId_ = tagRfDiscIdList_[techIdx];
+        connectedTechIndex_ = techIdx;
+    }
+    ResumeFieldChecking();
+    DebugLog("TagHost::TransceiveBatch exit, count = %{public}d", count);
+    return count;
+}
+
+bool TagHost::TransceiveAsync(const std::string& request, INciTagInterface::TagOpCallback callback)
+{
+    DebugLog("TagHost::TransceiveAsync");
+    PauseFieldChecking();
+    std::lock_guard<std::mutex> lock(mutex_);
+    // the field checking is resumed once sent, the adapter reports the tag present until the response arrives.
+    uint32_t requestId = TagNciAdapterRw::GetInstance().TransceiveAsync(request, callback);
+    ResumeFieldChecking();
+    return requestId != TagNciAdapterRw::INVALID_REQUEST_ID;
+}
+
 bool TagHost::FieldOnCheckingThread()
 {
     DebugLog("TagHost::FieldOnCheckingThread");
@@ -192,7 +242,7 @@ void TagHost::FieldCheckingThread(uint32_t delayedMs)
     TagNciAdapterRw::GetInstance().Disconnect();
     if (isFieldChecking_ && tagRfDiscIdList_.size() > 0) {
         DebugLog("FieldCheckingThread::Disconnect callback %{public}d", tagRfDiscIdList_[0]);
-        TagNativeImpl::GetInstance().OnTagLost(tagRfDiscIdList_[0]);
+        TagNativeImpl::GetInstance().OnTagLost(tagRfDiscIdList_[0], generation_);
     }
     DebugLog("FieldCheckingThread::End Field Checking");
 }
@@ -202,12 +252,15 @@ void TagHost::StartFieldOnChecking(uint32_t delayedMs)
     DebugLog("TagHost::StartFieldOnChecking");
     isTagFieldOn_ = true;
     isFieldChecking_ = true;
+    isFieldCheckingStarted_ = true;
     isSkipNextFieldChecking_ = false;
     isPauseFieldChecking_ = false;
     if (delayedMs <= 0) {
         delayedMs = DEFAULT_PRESENCE_CHECK_WATCH_DOG_TIMEOUT;
     }
-    std::thread([this, delayedMs]() { this->FieldCheckingThread(delayedMs); }).detach();
+    // the thread holds the instance, so the tag lost or a newer tag with the same id can't destroy it under the thread.
+    std::shared_ptr<TagHost> self = weak_from_this().lock();
+    std::thread([this, self, delayedMs]() { this->FieldCheckingThread(delayedMs); }).detach();
 }
 
 void TagHost::StopFieldChecking()
@@ -233,7 +286,7 @@ void TagHost::StopFieldCheckingInner()
 void TagHost::SetTimeout(uint32_t timeout, int technology)
 {
     DebugLog("TagHost::SetTimeout");
-    TagNciAdapterRw::GetInstance().SetTimeout(timeout, technology);
+    TagNciAdapterRw::GetInstance().SetUserTimeout(timeout, technology);
 }
 
 uint32_t TagHost::GetTimeout(uint32_t technology)
@@ -251,46 +304,51 @@ void TagHost::ResetTimeout()
 std::vector<int> TagHost::GetTechList()
 {
     for (std::vector<int>::iterator it = tagTechList_.begin(); it != tagTechList_.end(); ++it) {
-        KITS::TagTechnology technology = KITS::TagTechnology::NFC_INVALID_TECH;
-        switch (*it) {
-            case TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A:
-                technology = KITS::TagTechnology::NFC_A_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_ISO14443_3B:
-                technology = KITS::TagTechnology::NFC_B_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_ISO14443_4:
-                technology = KITS::TagTechnology::NFC_ISODEP_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_FELICA:
-                technology = KITS::TagTechnology::NFC_F_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_V:
-                technology = KITS::TagTechnology::NFC_V_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_NDEF:
-                technology = KITS::TagTechnology::NFC_NDEF_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_NDEF_FORMATABLE:
-                technology = KITS::TagTechnology::NFC_NDEF_FORMATABLE_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_MIFARE_CLASSIC:
-                technology = KITS::TagTechnology::NFC_MIFARE_CLASSIC_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_MIFARE_UL:
-                technology = KITS::TagTechnology::NFC_MIFARE_ULTRALIGHT_TECH;
-                break;
-            case TagNciAdapterCommon::TARGET_TYPE_UNKNOWN:
-                break;
-            default:
-                technology = KITS::TagTechnology::NFC_INVALID_TECH;
-                break;
-        }
-        technologyList_.push_back(static_cast<int>(technology));
+        technologyList_.push_back(ConvertToKitsTech(*it));
     }
     return technologyList_;
 }
 
+int TagHost::ConvertToKitsTech(int targetType)
+{
+    KITS::TagTechnology technology = KITS::TagTechnology::NFC_INVALID_TECH;
+    switch (targetType) {
+        case TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A:
+            technology = KITS::TagTechnology::NFC_A_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_ISO14443_3B:
+            technology = KITS::TagTechnology::NFC_B_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_ISO14443_4:
+            technology = KITS::TagTechnology::NFC_ISODEP_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_FELICA:
+            technology = KITS::TagTechnology::NFC_F_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_V:
+            technology = KITS::TagTechnology::NFC_V_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_NDEF:
+            technology = KITS::TagTechnology::NFC_NDEF_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_NDEF_FORMATABLE:
+            technology = KITS::TagTechnology::NFC_NDEF_FORMATABLE_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_MIFARE_CLASSIC:
+            technology = KITS::TagTechnology::NFC_MIFARE_CLASSIC_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_MIFARE_UL:
+            technology = KITS::TagTechnology::NFC_MIFARE_ULTRALIGHT_TECH;
+            break;
+        case TagNciAdapterCommon::TARGET_TYPE_UNKNOWN:
+            break;
+        default:
+            technology = KITS::TagTechnology::NFC_INVALID_TECH;
+            break;
+    }
+    return static_cast<int>(technology);
+}
+
 void TagHost::RemoveTech(int tech)
 {
     DebugLog("TagHost::RemoveTech");
@@ -301,20 +359,20 @@ std::string TagHost::GetTagUid()
     return tagUid_;
 }
 
-void TagHost::DoTargetTypeIso144433a(AppExecFwk::PacMap &pacMap, uint32_t index)
+void TagHost::DoTargetTypeIso144433a(KITS::TagTechExtras &extras, uint32_t index)
 {
     std::string act = tagActivatedBytes_[index];
     std::string poll = tagPollBytes_[index];
     if (!(act.empty())) {
         uint32_t sak = (KITS::NfcSdkCommon::GetByteFromHexStr(act, 0) & 0xff);
-        pacMap.PutIntValue(KITS::TagInfo::SAK, sak);
+        extras.PutIntValue(KITS::TagTechExtras::SAK, sak);
         DebugLog("DoTargetTypeIso144433a SAK: 0x%{public}X", sak);
     }
-    pacMap.PutStringValue(KITS::TagInfo::ATQA, poll);
+    extras.PutStringValue(KITS::TagTechExtras::ATQA, poll);
     DebugLog("DoTargetTypeIso144433a ATQA: %{public}s", poll.c_str());
 }
 
-void TagHost::DoTargetTypeIso144433b(AppExecFwk::PacMap &pacMap, uint32_t index)
+void TagHost::DoTargetTypeIso144433b(KITS::TagTechExtras &extras, uint32_t index)
 {
     std::string poll = tagPollBytes_[index];
     if (poll.empty()) {
@@ -329,16 +387,16 @@ void TagHost::DoTargetTypeIso144433b(AppExecFwk::PacMap &pacMap, uint32_t index)
     }
 
     std::string appData = poll.substr(0, (NCI_APP_DATA_LENGTH * KITS::HEX_BYTE_LEN));
-    pacMap.PutStringValue(KITS::TagInfo::APP_DATA, appData);
+    extras.PutStringValue(KITS::TagTechExtras::APP_DATA, appData);
     DebugLog("ParseTechExtras::TARGET_TYPE_ISO14443_3B APP_DATA: %{public}s", appData.c_str());
 
     std::string protoInfo = poll.substr((NCI_APP_DATA_LENGTH * KITS::HEX_BYTE_LEN),
                                         (NCI_PROTOCOL_INFO_LENGTH * KITS::HEX_BYTE_LEN));
-    pacMap.PutStringValue(KITS::TagInfo::PROTOCOL_INFO, protoInfo);
+    extras.PutStringValue(KITS::TagTechExtras::PROTOCOL_INFO, protoInfo);
     DebugLog("ParseTechExtras::TARGET_TYPE_ISO14443_3B PROTOCOL_INFO: %{public}s", protoInfo.c_str());
 }
 
-void TagHost::DoTargetTypeIso144434(AppExecFwk::PacMap &pacMap, uint32_t index)
+void TagHost::DoTargetTypeIso144434(KITS::TagTechExtras &extras, uint32_t index)
 {
     bool hasNfcA = false;
     std::string act = tagActivatedBytes_[index];
@@ -349,15 +407,15 @@ void TagHost::DoTargetTypeIso144434(AppExecFwk::PacMap &pacMap, uint32_t index)
         }
     }
     if (hasNfcA) {
-        pacMap.PutStringValue(KITS::TagInfo::HISTORICAL_BYTES, act);
+        extras.PutStringValue(KITS::TagTechExtras::HISTORICAL_BYTES, act);
         DebugLog("DoTargetTypeIso144434::HISTORICAL_BYTES: %{public}s", act.c_str());
     } else {
-        pacMap.PutStringValue(KITS::TagInfo::HILAYER_RESPONSE, act);
+        extras.PutStringValue(KITS::TagTechExtras::HILAYER_RESPONSE, act);
         DebugLog("DoTargetTypeIso144434::HILAYER_RESPONSE: %{public}s", act.c_str());
     }
 }
 
-void TagHost::DoTargetTypeV(AppExecFwk::PacMap &pacMap, uint32_t index)
+void TagHost::DoTargetTypeV(KITS::TagTechExtras &extras, uint32_t index)
 {
     std::string poll = tagPollBytes_[index];
     if (poll.empty()) {
@@ -371,13 +429,13 @@ void TagHost::DoTargetTypeV(AppExecFwk::PacMap &pacMap, uint32_t index)
     }
 
     // 1st byte is response flag, 2nd byte is dsf id.
-    pacMap.PutIntValue(KITS::TagInfo::RESPONSE_FLAGS, KITS::NfcSdkCommon::GetByteFromHexStr(poll, 0));
+    extras.PutIntValue(KITS::TagTechExtras::RESPONSE_FLAGS, KITS::NfcSdkCommon::GetByteFromHexStr(poll, 0));
     DebugLog("DoTargetTypeV::RESPONSE_FLAGS: %{public}d", KITS::NfcSdkCommon::GetByteFromHexStr(poll, 0));
-    pacMap.PutIntValue(KITS::TagInfo::DSF_ID, KITS::NfcSdkCommon::GetByteFromHexStr(poll, 1));
+    extras.PutIntValue(KITS::TagTechExtras::DSF_ID, KITS::NfcSdkCommon::GetByteFromHexStr(poll, 1));
     DebugLog("DoTargetTypeV::DSF_ID: %{public}d", KITS::NfcSdkCommon::GetByteFromHexStr(poll, 1));
 }
 
-void TagHost::DoTargetTypeF(AppExecFwk::PacMap &pacMap, uint32_t index)
+void TagHost::DoTargetTypeF(KITS::TagTechExtras &extras, uint32_t index)
 {
     std::string poll = tagPollBytes_[index];
     if (poll.empty()) {
@@ -389,83 +447,80 @@ void TagHost::DoTargetTypeF(AppExecFwk::PacMap &pacMap, uint32_t index)
         DebugLog("DoTargetTypeF no ppm, poll.len: %{public}d", KITS::NfcSdkCommon::GetHexStrBytesLen(poll));
         return;
     }
-    pacMap.PutStringValue(KITS::TagInfo::NFCF_PMM, poll.substr(0, SENSF_RES_LENGTH)); // 8 bytes for ppm
+    extras.PutStringValue(KITS::TagTechExtras::NFCF_PMM, poll.substr(0, SENSF_RES_LENGTH)); // 8 bytes for ppm
 
     if (KITS::NfcSdkCommon::GetHexStrBytesLen(poll) < F_POLL_LENGTH) {
         DebugLog("DoTargetTypeF no sc, poll.len: %{public}d", KITS::NfcSdkCommon::GetHexStrBytesLen(poll));
         return;
     }
-    pacMap.PutStringValue(KITS::TagInfo::NFCF_SC, poll.substr(SENSF_RES_LENGTH, 2)); // 2 bytes for sc
+    extras.PutStringValue(KITS::TagTechExtras::NFCF_SC, poll.substr(SENSF_RES_LENGTH, 2)); // 2 bytes for sc
+}
+
+void TagHost::DoTargetTypeMifareUl(KITS::TagTechExtras &extras, [[maybe_unused]] uint32_t index)
+{
+    bool isUlC = IsUltralightC();
+    extras.PutIntValue(KITS::TagTechExtras::MIFARE_ULTRALIGHT_C_TYPE, isUlC ? 1 : 0);
+    DebugLog("ParseTechExtras::TARGET_TYPE_MIFARE_UL MIFARE_ULTRALIGHT_C_TYPE: %{public}d", isUlC);
 }
 
-void TagHost::DoTargetTypeNdef(AppExecFwk::PacMap &pacMap)
+void TagHost::DoTargetTypeNdef(KITS::TagTechExtras &extras, [[maybe_unused]] uint32_t index)
 {
     DebugLog("DoTargetTypeNdef");
-    pacMap = ndefExtras_;
+    extras = ndefExtras_;
     ndefExtras_.Clear();
 }
 
-AppExecFwk::PacMap TagHost::ParseTechExtras(uint32_t index)
-{
-    AppExecFwk::PacMap pacMap;
+KITS::TagTechExtras TagHost::ParseTechExtras(uint32_t index)
+{
+    using ExtrasParser = void (TagHost::*)(KITS::TagTechExtras &, uint32_t);
+    // the layout of the extras, indexed by the target type, nullptr for the types without extras.
+    static constexpr ExtrasParser EXTRAS_PARSERS[] = {
+        nullptr,                           // TARGET_TYPE_UNKNOWN
+        &TagHost::DoTargetTypeIso144433a,  // TARGET_TYPE_ISO14443_3A
+        &TagHost::DoTargetTypeIso144433b,  // TARGET_TYPE_ISO14443_3B
+        &TagHost::DoTargetTypeIso144434,   // TARGET_TYPE_ISO14443_4
+        &TagHost::DoTargetTypeF,           // TARGET_TYPE_FELICA
+        &TagHost::DoTargetTypeV,           // TARGET_TYPE_V
+        &TagHost::DoTargetTypeNdef,        // TARGET_TYPE_NDEF
+        nullptr,                           // TARGET_TYPE_NDEF_FORMATABLE
+        &TagHost::DoTargetTypeIso144433a,  // TARGET_TYPE_MIFARE_CLASSIC
+        &TagHost::DoTargetTypeMifareUl,    // TARGET_TYPE_MIFARE_UL
+    };
+    static_assert(std::size(EXTRAS_PARSERS) == TagNciAdapterCommon::TARGET_TYPE_MIFARE_UL + 1,
+        "every target type needs its extras layout");
+
+    KITS::TagTechExtras extras;
     uint32_t targetType = static_cast<uint32_t>(tagTechList_[index]);
     DebugLog("ParseTechExtras::targetType: %{public}d", targetType);
-    switch (targetType) {
-        case TagNciAdapterCommon::TARGET_TYPE_MIFARE_CLASSIC:
-            DoTargetTypeIso144433a(pacMap, index);
-            break;
-        case TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A: {
-            DoTargetTypeIso144433a(pacMap, index);
-            break;
-        }
-        case TagNciAdapterCommon::TARGET_TYPE_ISO14443_3B: {
-            DoTargetTypeIso144433b(pacMap, index);
-            break;
-        }
-        case TagNciAdapterCommon::TARGET_TYPE_ISO14443_4: {
-            DoTargetTypeIso144434(pacMap, index);
-            break;
-        }
-        case TagNciAdapterCommon::TARGET_TYPE_V: {
-            DoTargetTypeV(pacMap, index);
-            break;
-        }
-        case TagNciAdapterCommon::TARGET_TYPE_MIFARE_UL: {
-            bool isUlC = IsUltralightC();
-            pacMap.PutBooleanValue(KITS::TagInfo::MIFARE_ULTRALIGHT_C_TYPE, isUlC);
-            DebugLog("ParseTechExtras::TARGET_TYPE_MIFARE_UL MIFARE_ULTRALIGHT_C_TYPE: %{public}d", isUlC);
-            break;
-        }
-        case TagNciAdapterCommon::TARGET_TYPE_FELICA: {
-            DoTargetTypeF(pacMap, index);
-            break;
-        }
-        case TagNciAdapterCommon::TARGET_TYPE_NDEF: {
-            DoTargetTypeNdef(pacMap);
-            break;
-        }
-        case TagNciAdapterCommon::TARGET_TYPE_NDEF_FORMATABLE:
-            break;
-        case TagNciAdapterCommon::TARGET_TYPE_UNKNOWN:
-            break;
-        default:
-            DebugLog("ParseTechExtras::unhandle for : %{public}d", targetType);
-            break;
+    if (targetType >= std::size(EXTRAS_PARSERS)) {
+        DebugLog("ParseTechExtras::unhandle for : %{public}d", targetType);
+        return extras;
+    }
+    if (EXTRAS_PARSERS[targetType] != nullptr) {
+        (this->*EXTRAS_PARSERS[targetType])(extras, index);
     }
-    return pacMap;
+    return extras;
 }
 
-std::vector<AppExecFwk::PacMap> TagHost::GetTechExtrasData()
+std::vector<KITS::TagTechExtras> TagHost::GetTechExtras()
 {
-    DebugLog("TagHost::GetTechExtrasData, tech len.%{public}zu", tagTechList_.size());
+    DebugLog("TagHost::GetTechExtras, tech len.%{public}zu", tagTechList_.size());
     tagTechExtras_.clear();
     for (std::size_t i = 0; i < tagTechList_.size(); i++) {
-        AppExecFwk::PacMap extra = ParseTechExtras(i);
-        tagTechExtras_.push_back(extra);
+        tagTechExtras_.push_back(ParseTechExtras(i));
     }
     return tagTechExtras_;
 }
 
+std::vector<AppExecFwk::PacMap> TagHost::GetTechExtrasData()
+{
+    std::vector<AppExecFwk::PacMap> tagTechExtrasData;
+    for (const KITS::TagTechExtras& extras : GetTechExtras()) {
+        tagTechExtrasData.push_back(extras.ToPacMap());
+    }
+    return tagTechExtrasData;
+}
+
 uint32_t TagHost::GetTagRfDiscId()
 {
     if (tagTechList_.size() > 0) {
@@ -495,6 +550,16 @@ std::string TagHost::ReadNdef()
     return response;
 }
 
+bool TagHost::ReadNdefAsync(INciTagInterface::TagOpCallback callback)
+{
+    DebugLog("TagHost::ReadNdefAsync");
+    PauseFieldChecking();
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint32_t requestId = TagNciAdapterRw::GetInstance().ReadNdefAsync(callback);
+    ResumeFieldChecking();
+    return requestId != TagNciAdapterRw::INVALID_REQUEST_ID;
+}
+
 std::string TagHost::FindNdefTech()
 {
     if (addNdefTech_) {
@@ -532,19 +597,19 @@ std::string TagHost::FindNdefTech()
             }
             DebugLog("Add ndef tag info, index: %{public}d", index);
             // parse extras data for ndef tech.
-            AppExecFwk::PacMap pacMap;
+            KITS::TagTechExtras extras;
             ndefMsg = ReadNdef();
             if (ndefMsg.size() > 0) {
-                pacMap.PutStringValue(KITS::TagInfo::NDEF_MSG, ndefMsg);
-                pacMap.PutIntValue(KITS::TagInfo::NDEF_FORUM_TYPE, GetNdefType(tagRfProtocols_[i]));
+                extras.PutStringValue(KITS::TagTechExtras::NDEF_MSG, ndefMsg);
+                extras.PutIntValue(KITS::TagTechExtras::NDEF_FORUM_TYPE, GetNdefType(tagRfProtocols_[i]));
                 DebugLog("ParseTechExtras::TARGET_TYPE_NDEF NDEF_FORUM_TYPE: %{public}d",
                     GetNdefType(tagRfProtocols_[i]));
-                pacMap.PutIntValue(KITS::TagInfo::NDEF_TAG_LENGTH, ndefInfo[NDEF_SIZE_INDEX]);
-                pacMap.PutIntValue(KITS::TagInfo::NDEF_TAG_MODE, ndefInfo[NDEF_MODE_INDEX]);
+                extras.PutIntValue(KITS::TagTechExtras::NDEF_TAG_LENGTH, ndefInfo[NDEF_SIZE_INDEX]);
+                extras.PutIntValue(KITS::TagTechExtras::NDEF_TAG_MODE, ndefInfo[NDEF_MODE_INDEX]);
                 DebugLog("ParseTechExtras::TARGET_TYPE_NDEF NDEF_TAG_MODE: %{public}d", ndefInfo[1]);
 
                 AddNdefTechToTagInfo(TagNciAdapterCommon::TARGET_TYPE_NDEF, tagRfDiscIdList_[i],
-                    tagRfProtocols_[i], pacMap);
+                    tagRfProtocols_[i], extras);
                 foundFormat = false;
                 Reconnect();
             }
@@ -553,39 +618,28 @@ std::string TagHost::FindNdefTech()
     }
     if (foundFormat) {
         DebugLog("Add ndef formatable tag info, index: %{public}d", index);
-        AppExecFwk::PacMap pacMap;
-        AddNdefTechToTagInfo(TagNciAdapterCommon::TARGET_TYPE_NDEF_FORMATABLE, formatHandle, formatLibNfcType, pacMap);
+        AddNdefTechToTagInfo(TagNciAdapterCommon::TARGET_TYPE_NDEF_FORMATABLE, formatHandle, formatLibNfcType,
+            KITS::TagTechExtras());
     }
     return ndefMsg;
 }
 
-void TagHost::AddNdefTechToTagInfo(uint32_t tech, uint32_t discId, uint32_t actProto, AppExecFwk::PacMap pacMap)
+void TagHost::AddNdefTechToTagInfo(uint32_t tech, uint32_t discId, uint32_t actProto, KITS::TagTechExtras extras)
 {
     InfoLog("AddNdefTechToTagInfo: tech = %{public}d", tech);
     tagTechList_.push_back(tech);
     tagRfDiscIdList_.push_back(discId);
     tagRfProtocols_.push_back(actProto);
-    ndefExtras_ = pacMap; // techExtras_ will be handled in ParseTechExtras()
+    ndefExtras_ = extras; // techExtras_ will be handled in ParseTechExtras()
 }
 
 uint32_t TagHost::GetNdefType(uint32_t protocol) const
 {
-    uint32_t ndefType;
-    if (NFA_PROTOCOL_T1T == protocol) {
-        ndefType = NDEF_TYPE1_TAG;
-    } else if (NFA_PROTOCOL_T2T == protocol) {
-        ndefType = NDEF_TYPE2_TAG;
-    } else if (NFA_PROTOCOL_T3T == protocol) {
-        ndefType = NDEF_TYPE3_TAG;
-    } else if (NFA_PROTOCOL_ISO_DEP == protocol) {
-        ndefType = NDEF_TYPE4_TAG;
-    } else if (NFC_PROTOCOL_MIFARE == protocol) {
-        ndefType = NDEF_MIFARE_CLASSIC_TAG;
-    } else {
-        /* NFA_PROTOCOL_T5T, NFA_PROTOCOL_INVALID and others */
-        ndefType = NDEF_UNKNOWN_TYPE;
+    // NFA_PROTOCOL_T5T, NFA_PROTOCOL_INVALID and others are NFC_FORUM_TYPE_UNKNOWN
+    if (protocol > UINT8_MAX) {
+        return KITS::NFC_FORUM_TYPE_UNKNOWN;
     }
-    return ndefType;
+    return static_cast<uint32_t>(TagTransceiveProfile::Get(static_cast<uint8_t>(protocol)).ndefType);
 }
 
 bool TagHost::WriteNdef(std::string& data)
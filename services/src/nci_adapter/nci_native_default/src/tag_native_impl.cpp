@@ -16,6 +16,8 @@
 #include "nfa_api.h"
 #include "nfc_config.h"
 #include "nfc_sdk_common.h"
+#include "tag_nci_adapter_common.h"
+#include "tag_tech_traits.h"
 
 namespace OHOS {
 namespace NFC {
@@ -25,8 +27,6 @@ namespace NCI {
  */
 constexpr uint32_t ISO_DEP_FRAME_MAX_LEN = 261;
 
-constexpr uint32_t ISO_DEP_MAX_TRANSEIVE_LENGTH = 0xFEFF;
-
 TagNativeImpl& TagNativeImpl::GetInstance()
 {
     static TagNativeImpl tagNativeImpl;
@@ -48,11 +48,11 @@ void TagNativeImpl::SetTagListener(std::weak_ptr<INciTagInterface::ITagListener>
  */
 std::weak_ptr<TagHost> TagNativeImpl::GetTag(uint32_t tagDiscId)
 {
-    std::map<uint32_t, std::shared_ptr<TagHost>>::iterator iter = tagHostMap_.find(tagDiscId);
-    if (iter == tagHostMap_.end()) {
+    if (tagDiscId >= TAG_SLOT_COUNT) {
         return std::shared_ptr<TagHost>();
     }
-    return iter->second;
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tagSlots_[tagDiscId].tagHost;
 }
 
 /**
@@ -67,22 +67,47 @@ void TagNativeImpl::OnTagDiscovered(uint32_t tagDiscId, std::shared_ptr<TagHost>
         ErrorLog("tagListener nullptr");
         return;
     }
-    tagHostMap_.insert(make_pair(tagDiscId, tagHost));
+    if (tagDiscId >= TAG_SLOT_COUNT || tagHost == nullptr) {
+        ErrorLog("OnTagDiscovered, invalid tag, tagDiscId = %{public}u", tagDiscId);
+        return;
+    }
+    // released out of the lock, a running field checking thread keeps its own TagHost alive.
+    std::shared_ptr<TagHost> replaced = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TagSlot& slot = tagSlots_[tagDiscId];
+        replaced = std::move(slot.tagHost);
+        slot.generation++;
+        tagHost->SetGeneration(slot.generation);
+        slot.tagHost = tagHost;
+    }
     tagListenerPtr->OnTagDiscovered(tagDiscId);
 }
 
 /**
  * @brief Tag lost, need to callback to nfc service.
  * @param tagDiscId The tag discovered id given from nci stack.
+ * @param generation The generation of the lost TagHost, ignored when the id is taken by a newer tag.
  */
-void TagNativeImpl::OnTagLost(uint32_t tagDiscId)
+void TagNativeImpl::OnTagLost(uint32_t tagDiscId, uint32_t generation)
 {
     auto tagListenerPtr = tagListener_.lock();
     if (tagListenerPtr == nullptr) {
         ErrorLog("tagListener nullptr");
         return;
     }
-    tagHostMap_.erase(tagDiscId);
+    if (tagDiscId >= TAG_SLOT_COUNT) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TagSlot& slot = tagSlots_[tagDiscId];
+        if (slot.generation != generation || slot.tagHost == nullptr) {
+            InfoLog("OnTagLost, stale tag, tagDiscId = %{public}u", tagDiscId);
+            return;
+        }
+        slot.tagHost = nullptr;
+    }
     tagListenerPtr->OnTagLost(tagDiscId);
 }
 
@@ -122,6 +147,12 @@ uint16_t TagNativeImpl::GetTechMaskFromTechList(const std::vector<uint32_t> &dis
             case static_cast<int32_t>(KITS::TagTechnology::NFC_SKIP_NDEF_CHECK_TECH):
                 techMask |= KITS::SKIP_NDEF_CHECK_TECH_MASK;
                 break;
+            case static_cast<int32_t>(KITS::TagTechnology::NFC_LOW_LATENCY_READER_TECH):
+                techMask |= KITS::LOW_LATENCY_READER_TECH_MASK;
+                break;
+            case static_cast<int32_t>(KITS::TagTechnology::NFC_SKIP_PRESENCE_CHECK_TECH):
+                techMask |= KITS::SKIP_PRESENCE_CHECK_TECH_MASK;
+                break;
             default:
                 break;
         }
@@ -138,8 +169,30 @@ uint32_t TagNativeImpl::GetIsoDepMaxTransceiveLength()
     if (NfcConfig::hasKey(NAME_ISO_DEP_MAX_TRANSCEIVE)) {
         return NfcConfig::getUnsigned(NAME_ISO_DEP_MAX_TRANSCEIVE);
     } else {
-        return ISO_DEP_MAX_TRANSEIVE_LENGTH;
+        return static_cast<uint32_t>(
+            KITS::GetTagTechTraits(KITS::TagTechnology::NFC_ISODEP_TECH).maxTransceiveLength);
+    }
+}
+
+/**
+ * @brief Get the uid and technologies of all tags discovered in the field in one pass.
+ * @return The inventory of the discovered tags.
+ */
+std::vector<INciTagInterface::TagInventoryItem> TagNativeImpl::GetTagInventory()
+{
+    std::vector<TagNciAdapterCommon::TagSession> sessions = TagNciAdapterCommon::GetInstance().GetTagSessions();
+    std::vector<INciTagInterface::TagInventoryItem> inventory;
+    inventory.reserve(sessions.size());
+    for (const TagNciAdapterCommon::TagSession& session : sessions) {
+        INciTagInterface::TagInventoryItem item;
+        item.rfDiscId = session.rfDiscId;
+        item.uid = session.uid;
+        for (int targetType : session.techList) {
+            item.techList.push_back(TagHost::ConvertToKitsTech(targetType));
+        }
+        inventory.push_back(std::move(item));
     }
+    return inventory;
 }
 
 /**
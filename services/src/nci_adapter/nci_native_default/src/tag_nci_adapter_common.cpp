@@ -22,19 +22,11 @@
 #include "rw_int.h"
 #include "securec.h"
 #include "extns.h"
+#include "tag_tech_traits.h"
 
 namespace OHOS {
 namespace NFC {
 namespace NCI {
-static const uint32_t ISO14443_3A_DEFAULT_TIMEOUT = 618;   // NfcA
-static const uint32_t ISO14443_3B_DEFAULT_TIMEOUT = 1000;  // NfcB
-static const uint32_t ISO14443_4_DEFAULT_TIMEOUT = 618;    // ISO-DEP
-static const uint32_t FELICA_DEFAULT_TIMEOUT = 255;        // Felica
-static const uint32_t ISO15693_DEFAULT_TIMEOUT = 1000;     // NfcV
-static const uint32_t NDEF_DEFAULT_TIMEOUT = 1000;
-static const uint32_t NDEF_FORMATABLE_DEFAULT_TIMEOUT = 1000;
-static const uint32_t MIFARE_CLASSIC_DEFAULT_TIMEOUT = 618;  // MifareClassic
-static const uint32_t MIFARE_UL_DEFAULT_TIMEOUT = 618;       // MifareUltralight
 
 TagNciAdapterCommon::TagNciAdapterCommon()
     : discNtfIndex_(0),
@@ -112,6 +104,7 @@ void TagNciAdapterCommon::ResetTag()
 
     // connection datas
     connectedProtocol_ = NCI_PROTOCOL_UNKNOWN;
+    isoDepFwt_ = 0;
 
     isFelicaLite_ = false;
     isMifareUltralight_ = false;
@@ -119,6 +112,7 @@ void TagNciAdapterCommon::ResetTag()
     isMultiTag_ = false;
 
     ResetTimeout();
+    ClearTagSessions();
 
     //  special data
 #if (NXP_EXTNS == TRUE)
@@ -128,15 +122,88 @@ void TagNciAdapterCommon::ResetTag()
 
 void TagNciAdapterCommon::ResetTimeout()
 {
-    technologyTimeoutsTable_[TARGET_TYPE_ISO14443_3A] = ISO14443_3A_DEFAULT_TIMEOUT;
-    technologyTimeoutsTable_[TARGET_TYPE_ISO14443_3B] = ISO14443_3B_DEFAULT_TIMEOUT;
-    technologyTimeoutsTable_[TARGET_TYPE_ISO14443_4] = ISO14443_4_DEFAULT_TIMEOUT;
-    technologyTimeoutsTable_[TARGET_TYPE_FELICA] = FELICA_DEFAULT_TIMEOUT;
-    technologyTimeoutsTable_[TARGET_TYPE_V] = ISO15693_DEFAULT_TIMEOUT;
-    technologyTimeoutsTable_[TARGET_TYPE_NDEF] = NDEF_DEFAULT_TIMEOUT;
-    technologyTimeoutsTable_[TARGET_TYPE_NDEF_FORMATABLE] = NDEF_FORMATABLE_DEFAULT_TIMEOUT;
-    technologyTimeoutsTable_[TARGET_TYPE_MIFARE_CLASSIC] = MIFARE_CLASSIC_DEFAULT_TIMEOUT;
-    technologyTimeoutsTable_[TARGET_TYPE_MIFARE_UL] = MIFARE_UL_DEFAULT_TIMEOUT;
+    // the target types equal to the values of KITS::TagTechnology.
+    for (uint32_t i = 0; i < MAX_NUM_TECHNOLOGY; i++) {
+        uint32_t defaultTimeout = KITS::GetTagTechTraits(static_cast<int>(i)).defaultTimeout;
+        if (defaultTimeout > 0) {
+            technologyTimeoutsTable_[i] = static_cast<int>(defaultTimeout);
+        }
+        isTimeoutOverridden_[i] = false;
+    }
+}
+
+void TagNciAdapterCommon::AddTagSession(uint32_t rfDiscId, uint32_t protocol, uint32_t rfInterface,
+    const std::string& uid, const std::vector<int>& techList)
+{
+    std::lock_guard<std::mutex> lock(tagSessionMutex_);
+    if (tagSessions_.find(rfDiscId) == tagSessions_.end()) {
+        tagSessionOrder_.push_back(rfDiscId);
+    }
+    TagSession& session = tagSessions_[rfDiscId];
+    session.rfDiscId = rfDiscId;
+    session.protocol = protocol;
+    session.rfInterface = rfInterface;
+    session.uid = uid;
+    session.techList = techList;
+    (void)memcpy_s(session.timeouts, sizeof(session.timeouts), technologyTimeoutsTable_,
+        sizeof(technologyTimeoutsTable_));
+    // the tag activated last is the one selected by nfcc.
+    activeSessionDiscId_ = rfDiscId;
+    InfoLog("TagNciAdapterCommon::AddTagSession: rfDiscId = %{public}d, sessions = %{public}zu",
+        rfDiscId, tagSessions_.size());
+}
+
+bool TagNciAdapterCommon::IsActiveTagSession(uint32_t rfDiscId) const
+{
+    std::lock_guard<std::mutex> lock(tagSessionMutex_);
+    // no session recorded means single tag, always active.
+    if (tagSessions_.size() <= 1 || activeSessionDiscId_ == INVALID_DISC_ID) {
+        return true;
+    }
+    return activeSessionDiscId_ == rfDiscId;
+}
+
+void TagNciAdapterCommon::SwitchTagSession(uint32_t rfDiscId, uint32_t rfInterface)
+{
+    std::lock_guard<std::mutex> lock(tagSessionMutex_);
+    auto active = tagSessions_.find(activeSessionDiscId_);
+    if (active != tagSessions_.end()) {
+        (void)memcpy_s(active->second.timeouts, sizeof(active->second.timeouts), technologyTimeoutsTable_,
+            sizeof(technologyTimeoutsTable_));
+    }
+    auto target = tagSessions_.find(rfDiscId);
+    if (target == tagSessions_.end()) {
+        WarnLog("TagNciAdapterCommon::SwitchTagSession: unknown rfDiscId = %{public}d", rfDiscId);
+        return;
+    }
+    (void)memcpy_s(technologyTimeoutsTable_, sizeof(technologyTimeoutsTable_), target->second.timeouts,
+        sizeof(target->second.timeouts));
+    target->second.rfInterface = rfInterface;
+    connectedRfIface_ = rfInterface;
+    activeSessionDiscId_ = rfDiscId;
+    DebugLog("TagNciAdapterCommon::SwitchTagSession: active rfDiscId = %{public}d", rfDiscId);
+}
+
+std::vector<TagNciAdapterCommon::TagSession> TagNciAdapterCommon::GetTagSessions() const
+{
+    std::lock_guard<std::mutex> lock(tagSessionMutex_);
+    std::vector<TagSession> sessions;
+    sessions.reserve(tagSessionOrder_.size());
+    for (uint32_t rfDiscId : tagSessionOrder_) {
+        auto iter = tagSessions_.find(rfDiscId);
+        if (iter != tagSessions_.end()) {
+            sessions.push_back(iter->second);
+        }
+    }
+    return sessions;
+}
+
+void TagNciAdapterCommon::ClearTagSessions()
+{
+    std::lock_guard<std::mutex> lock(tagSessionMutex_);
+    tagSessions_.clear();
+    tagSessionOrder_.clear();
+    activeSessionDiscId_ = INVALID_DISC_ID;
 }
 }  // namespace NCI
 }  // namespace NFC
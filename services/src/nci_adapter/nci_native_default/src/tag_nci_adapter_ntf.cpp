@@ -44,8 +44,47 @@ static const uint32_t INVALID_TAG_INDEX = 0xFF;
 static const uint32_t TIME_MUL_100MS = 100; // ms
 static const uint8_t MIN_FWI = 0;  // min waiting time integer for protocol frame
 static const uint8_t MAX_FWI = 14; // max waiting time integer for protocol frame
+static const uint32_t SENSB_RES_FWI_POS = 10; // protocol info byte 3 of SENSB_RES, FWI in the upper half
+static const uint32_t FWI_SHIFT = 4;
+static const uint32_t FWT_CLOCKS_FWI_0 = 4096;  // 256 * 16 / fc, the frame waiting time of FWI 0
+static const uint32_t CARRIER_FREQUENCY_KHZ = 13560;
 static const uint8_t NON_STD_CARD_SAK = 0x13;
 
+enum DiscTech : uint8_t {
+    DISC_TECH_UNKNOWN = 0,
+    DISC_TECH_A,
+    DISC_TECH_B,
+    DISC_TECH_F,
+    DISC_TECH_V,
+};
+
+// the technology of the poll and listen modes of a discovery type, one jump for all of them.
+static constexpr DiscTech GetDiscTech(uint8_t discType)
+{
+    switch (discType) {
+        case NCI_DISCOVERY_TYPE_POLL_A:
+        case NCI_DISCOVERY_TYPE_POLL_A_ACTIVE:
+        case NCI_DISCOVERY_TYPE_LISTEN_A:
+        case NCI_DISCOVERY_TYPE_LISTEN_A_ACTIVE:
+            return DISC_TECH_A;
+        case NCI_DISCOVERY_TYPE_POLL_B:
+        case NFC_DISCOVERY_TYPE_POLL_B_PRIME:
+        case NCI_DISCOVERY_TYPE_LISTEN_B:
+        case NFC_DISCOVERY_TYPE_LISTEN_B_PRIME:
+            return DISC_TECH_B;
+        case NCI_DISCOVERY_TYPE_POLL_F:
+        case NCI_DISCOVERY_TYPE_POLL_F_ACTIVE:
+        case NCI_DISCOVERY_TYPE_LISTEN_F:
+        case NCI_DISCOVERY_TYPE_LISTEN_F_ACTIVE:
+            return DISC_TECH_F;
+        case NCI_DISCOVERY_TYPE_POLL_V:
+        case NCI_DISCOVERY_TYPE_LISTEN_ISO15693:
+            return DISC_TECH_V;
+        default:
+            return DISC_TECH_UNKNOWN;
+    }
+}
+
 #define g_commonMultiTagDiscId (TagNciAdapterCommon::GetInstance().multiTagDiscId_)
 #define g_commonMultiTagDiscProtocol (TagNciAdapterCommon::GetInstance().multiTagDiscProtocol_)
 #define g_commonTechListIndex (TagNciAdapterCommon::GetInstance().techListIndex_)
@@ -311,6 +350,9 @@ void TagNciAdapterNtf::HandleReadComplete(uint8_t status)
     if (!g_commonIsNdefReading) {
         return;
     }
+    if (TagNciAdapterRw::GetInstance().HandleAsyncReadComplete(status)) {
+        return;
+    }
     NFC::SynchronizeGuard guard(g_commonReadNdefEvent);
     if (status != NFA_STATUS_OK) {
         ErrorLog("Read ndef fail");
@@ -338,64 +380,22 @@ void TagNciAdapterNtf::HandleFormatComplete(uint8_t status)
 
 bool TagNciAdapterNtf::IsDiscTypeA(uint8_t discType) const
 {
-    if (discType == NCI_DISCOVERY_TYPE_POLL_A) {
-        return true;
-    }
-    if (discType == NCI_DISCOVERY_TYPE_POLL_A_ACTIVE) {
-        return true;
-    }
-    if (discType == NCI_DISCOVERY_TYPE_LISTEN_A) {
-        return true;
-    }
-    if (discType == NCI_DISCOVERY_TYPE_LISTEN_A_ACTIVE) {
-        return true;
-    }
-    return false;
+    return GetDiscTech(discType) == DISC_TECH_A;
 }
 
 bool TagNciAdapterNtf::IsDiscTypeB(uint8_t discType) const
 {
-    if (discType == NCI_DISCOVERY_TYPE_POLL_B) {
-        return true;
-    }
-    if (discType == NFC_DISCOVERY_TYPE_POLL_B_PRIME) {
-        return true;
-    }
-    if (discType == NCI_DISCOVERY_TYPE_LISTEN_B) {
-        return true;
-    }
-    if (discType == NFC_DISCOVERY_TYPE_LISTEN_B_PRIME) {
-        return true;
-    }
-    return false;
+    return GetDiscTech(discType) == DISC_TECH_B;
 }
 
 bool TagNciAdapterNtf::IsDiscTypeF(uint8_t discType) const
 {
-    if (discType == NCI_DISCOVERY_TYPE_POLL_F) {
-        return true;
-    }
-    if (discType == NCI_DISCOVERY_TYPE_POLL_F_ACTIVE) {
-        return true;
-    }
-    if (discType == NCI_DISCOVERY_TYPE_LISTEN_F) {
-        return true;
-    }
-    if (discType == NCI_DISCOVERY_TYPE_LISTEN_F_ACTIVE) {
-        return true;
-    }
-    return false;
+    return GetDiscTech(discType) == DISC_TECH_F;
 }
 
 bool TagNciAdapterNtf::IsDiscTypeV(uint8_t discType) const
 {
-    if (discType == NCI_DISCOVERY_TYPE_POLL_V) {
-        return true;
-    }
-    if (discType == NCI_DISCOVERY_TYPE_LISTEN_ISO15693) {
-        return true;
-    }
-    return false;
+    return GetDiscTech(discType) == DISC_TECH_V;
 }
 
 bool TagNciAdapterNtf::IsMifareUL(tNFA_ACTIVATED activated)
@@ -412,17 +412,30 @@ bool TagNciAdapterNtf::IsMifareUL(tNFA_ACTIVATED activated)
 
 void TagNciAdapterNtf::SetIsoDepFwt(tNFA_ACTIVATED activated, uint32_t technology)
 {
+    uint8_t fwi = MAX_FWI + 1;
     if ((activated.activate_ntf.rf_tech_param.mode == NFC_DISCOVERY_TYPE_POLL_A) ||
         (activated.activate_ntf.rf_tech_param.mode == NFC_DISCOVERY_TYPE_POLL_A_ACTIVE)) {
         // get frame Waiting time Integer(fwi) from activated data
-        uint8_t fwi = activated.activate_ntf.intf_param.intf_param.pa_iso.fwi;
+        fwi = activated.activate_ntf.intf_param.intf_param.pa_iso.fwi;
         if (fwi <= MAX_FWI) {
             // 2^MIN_FWI * 256 * 16 * 1000 / 13560000 is approximately 618
             int fwt = (1 << (fwi - MIN_FWI)) * 618;
             InfoLog("TagNciAdapterNtf::GetTechFromData timeout = %{public}d, fwi = %{public}0#x", fwt, fwi);
             TagNciAdapterRw::GetInstance().SetTimeout(fwt, technology);
         }
+    } else if (activated.activate_ntf.rf_tech_param.mode == NFC_DISCOVERY_TYPE_POLL_B) {
+        const tNFC_RF_PB_PARAMS& pb = activated.activate_ntf.rf_tech_param.param.pb;
+        if (pb.sensb_res_len > SENSB_RES_FWI_POS) {
+            fwi = pb.sensb_res[SENSB_RES_FWI_POS] >> FWI_SHIFT;
+        }
     }
+    // the lower bound of the learned timeout, the real frame waiting time rather than the timeout above.
+    uint32_t fwtMs = 0;
+    if (fwi <= MAX_FWI) {
+        fwtMs = ((FWT_CLOCKS_FWI_0 << (fwi - MIN_FWI)) + CARRIER_FREQUENCY_KHZ - 1) / CARRIER_FREQUENCY_KHZ;
+    }
+    TagNciAdapterCommon::GetInstance().isoDepFwt_ = fwtMs;
+    DebugLog("TagNciAdapterNtf::SetIsoDepFwt fwt = %{public}u ms, fwi = %{public}d", fwtMs, fwi);
 }
 
 void TagNciAdapterNtf::GetTechFromData(tNFA_ACTIVATED activated)
@@ -663,6 +676,15 @@ void TagNciAdapterNtf::BuildTagInfo(tNFA_ACTIVATED activated)
     GetTechActFromData(activated);
     ParseSpecTagType(activated);
 
+    // record the session of this tag, techs from the last tag index belong to it.
+    std::vector<int>& techList = TagNciAdapterCommon::GetInstance().tagTechList_;
+    std::vector<int> sessionTechList;
+    if (g_commonMultiTagTmpTechIdx < techList.size()) {
+        sessionTechList.assign(techList.begin() + g_commonMultiTagTmpTechIdx, techList.end());
+    }
+    TagNciAdapterCommon::GetInstance().AddTagSession(activated.activate_ntf.rf_disc_id,
+        activated.activate_ntf.protocol, activated.activate_ntf.intf_param.type, tagUid, sessionTechList);
+
     if (g_commonDiscRstEvtNum == 0) {
         g_commonMultiTagTmpTechIdx = 0;
         std::shared_ptr<NCI::TagHost> tagHost = std::make_shared<NCI::TagHost>(
@@ -822,19 +844,6 @@ uint32_t TagNciAdapterNtf::GetT1tMaxMessageSize(tNFA_ACTIVATED activated) const
     return t1tMaxMessageSize;
 }
 
-tNFA_INTF_TYPE TagNciAdapterNtf::GetRfInterface(uint32_t protocol) const
-{
-    tNFA_INTF_TYPE rfInterface;
-    if (protocol == NFA_PROTOCOL_ISO_DEP) {
-        rfInterface = NFA_INTERFACE_ISO_DEP;
-    } else if (protocol == NFA_PROTOCOL_MIFARE) {
-        rfInterface = NFA_INTERFACE_MIFARE;
-    } else {
-        rfInterface = NFA_INTERFACE_FRAME;
-    }
-    return rfInterface;
-}
-
 void TagNciAdapterNtf::SetIsMultiTag(bool isMultiTag)
 {
     TagNciAdapterCommon::GetInstance().isMultiTag_ = isMultiTag &&
@@ -1044,11 +1053,6 @@ void TagNciAdapterNtf::HandleNdefCheckResult(uint8_t status, uint32_t currentSiz
     TagNciAdapterRw::GetInstance().HandleNdefCheckResult(status, currentSize, flag, maxSize);
 }
 
-void TagNciAdapterNtf::HandleTranceiveData(uint8_t status, uint8_t* data, uint32_t dataLen)
-{
-    TagNciAdapterRw::GetInstance().HandleTranceiveData(status, data, dataLen);
-}
-
 }  // namespace NCI
 }  // namespace NFC
 }  // namespace OHOS
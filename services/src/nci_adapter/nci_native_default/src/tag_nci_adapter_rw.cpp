@@ -14,6 +14,9 @@
  */
 #include "tag_nci_adapter_rw.h"
 #include "tag_nci_adapter_common.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
 #include <unistd.h>
 #include "nfc_brcm_defs.h"
 #include "nfc_config.h"
@@ -81,6 +84,14 @@ TagNciAdapterRw::TagNciAdapterRw()
 
 TagNciAdapterRw::~TagNciAdapterRw()
 {
+    {
+        NFC::SynchronizeGuard guard(asyncOpEvent_);
+        isAsyncWorkerExit_ = true;
+        asyncOpEvent_.NotifyOne();
+    }
+    if (asyncWorker_.joinable()) {
+        asyncWorker_.join();
+    }
     receivedData_.clear();
 };
 
@@ -101,6 +112,63 @@ uint32_t TagNciAdapterRw::GetTimeout(uint32_t technology) const
     return timeout;
 }
 
+/**
+ * @brief Build the key to learn the response time of the command, commands of the same tag, technology and
+ * command code are expected to take similar time.
+ */
+uint32_t TagNciAdapterRw::GetTransceiveKey(const std::basic_string<uint8_t>& request) const
+{
+    const std::vector<uint32_t>& discIdList = TagNciAdapterCommon::GetInstance().tagRfDiscIdList_;
+    uint32_t discId = (g_commonConnectedTechIdx < discIdList.size()) ? discIdList[g_commonConnectedTechIdx] : 0;
+    // the INS of an APDU, the command code after the length byte of FeliCa and after the flags byte of NFC-V,
+    // the first byte of the other frames.
+    size_t cmdCodePos = 0;
+    if (GetConnectRfInterface() == NFA_INTERFACE_ISO_DEP ||
+        g_commonConnectedType == TagNciAdapterCommon::TARGET_TYPE_FELICA ||
+        g_commonConnectedType == TagNciAdapterCommon::TARGET_TYPE_V) {
+        cmdCodePos = 1;
+    }
+    uint8_t cmdCode = (request.size() > cmdCodePos) ? request[cmdCodePos] : 0;
+    return TagRttEstimator::BuildKey(discId, g_commonConnectedType, cmdCode);
+}
+
+/**
+ * @brief Get the hard deadline of the command, the timeout set by app as it is, otherwise the configured
+ * timeout of the technology, but not shorter than the ISO-DEP frame waiting time.
+ */
+uint32_t TagNciAdapterRw::GetFullTimeout() const
+{
+    uint32_t configuredTimeout = GetTimeout(g_commonConnectedType);
+    if (g_commonConnectedType < MAX_NUM_TECHNOLOGY &&
+        TagNciAdapterCommon::GetInstance().isTimeoutOverridden_[g_commonConnectedType]) {
+        return configuredTimeout;
+    }
+    return std::max(configuredTimeout, GetFwtFloor());
+}
+
+uint32_t TagNciAdapterRw::GetFwtFloor() const
+{
+    // ISO-DEP of both NFC-A and NFC-B, the other technologies have no frame waiting time from activation.
+    if (g_commonConnectedType == TagNciAdapterCommon::TARGET_TYPE_ISO14443_4) {
+        return TagNciAdapterCommon::GetInstance().isoDepFwt_;
+    }
+    return 0;
+}
+
+/**
+ * @brief Get the soft deadline of the command from the learned response time, not shorter than the ISO-DEP frame
+ * waiting time. Past it the response is overdue, but the command still waits the full timeout. There is no soft
+ * deadline for the timeout set by app.
+ */
+uint32_t TagNciAdapterRw::GetSoftTimeout(uint32_t key, uint32_t fullTimeout)
+{
+    if (g_commonConnectedType < MAX_NUM_TECHNOLOGY &&
+        TagNciAdapterCommon::GetInstance().isTimeoutOverridden_[g_commonConnectedType]) {
+        return fullTimeout;
+    }
+    return rttEstimator_.GetSoftTimeout(key, fullTimeout, GetFwtFloor());
+}
+
 bool TagNciAdapterRw::DeactiveForReselect()
 {
     NFC::SynchronizeGuard guard(g_commonReconnectEvent);
@@ -326,9 +394,46 @@ bool TagNciAdapterRw::Reselect(tNFA_INTF_TYPE rfInterface, bool isSwitchingIface
     return (status == NFA_STATUS_OK) ? true : false;
 }
 
+tNFA_INTF_TYPE TagNciAdapterRw::GetConnectRfInterface() const
+{
+    if (g_commonConnectedProtocol != NFC_PROTOCOL_ISO_DEP && g_commonConnectedProtocol != NFC_PROTOCOL_MIFARE) {
+        return NFA_INTERFACE_FRAME;
+    }
+    if (g_commonConnectedType == TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A ||
+        g_commonConnectedType == TagNciAdapterCommon::TARGET_TYPE_ISO14443_3B) {
+#if (NXP_EXTNS != TRUE)
+        if (g_commonConnectedProtocol == NFC_PROTOCOL_MIFARE) {
+            return NFA_INTERFACE_MIFARE;
+        }
+#endif
+        return NFA_INTERFACE_FRAME;
+    } else if (g_commonConnectedType == TagNciAdapterCommon::TARGET_TYPE_MIFARE_CLASSIC) {
+        return NFA_INTERFACE_MIFARE;
+    }
+    return NFA_INTERFACE_ISO_DEP;
+}
+
+/**
+ * @brief Put the selected tag to sleep and select another tag of the field, the session data of
+ * the target tag, such as the timeouts, take effect after selected.
+ * @param discId The rf disc id of the target tag.
+ * @param rfInterface The rf interface to select the target tag.
+ * @return NFA_STATUS_OK if the target tag selected.
+ */
+tNFA_STATUS TagNciAdapterRw::SwitchToTag(uint32_t discId, tNFA_INTF_TYPE rfInterface)
+{
+    InfoLog("TagNciAdapterRw::SwitchToTag: discId = %{public}d, rfInterface = %{public}d", discId, rfInterface);
+    if (!Reselect(rfInterface, false)) {
+        ErrorLog("TagNciAdapterRw::SwitchToTag: select tag failed");
+        return NFA_STATUS_FAILED;
+    }
+    TagNciAdapterCommon::GetInstance().SwitchTagSession(discId, rfInterface);
+    return NFA_STATUS_OK;
+}
+
 tNFA_STATUS TagNciAdapterRw::Connect(uint32_t idx)
 {
-    if (idx >= MAX_NUM_TECHNOLOGY) {
+    if (idx >= MAX_NUM_TECHNOLOGY || idx >= TagNciAdapterCommon::GetInstance().tagTechList_.size()) {
         ErrorLog("TagNciAdapterRw::Connect: tag %{public}X is out-of-range", idx);
         return NFA_STATUS_FAILED;
     }
@@ -348,6 +453,10 @@ tNFA_STATUS TagNciAdapterRw::Connect(uint32_t idx)
         return NFA_STATUS_OK;
     }
 #endif
+    // another tag of the field is selected, the target tag must be selected whatever its protocol is.
+    if (!TagNciAdapterCommon::GetInstance().IsActiveTagSession(discId)) {
+        return SwitchToTag(discId, GetConnectRfInterface());
+    }
     if (g_commonConnectedProtocol != NFC_PROTOCOL_ISO_DEP && g_commonConnectedProtocol != NFC_PROTOCOL_MIFARE) {
         InfoLog("TagNciAdapterRw::Connect: do nothing for non ISO_DEP");
         return NFA_STATUS_OK;
@@ -374,7 +483,7 @@ bool TagNciAdapterRw::Disconnect()
 {
     if (tagState_ != ACTIVE) {
         ErrorLog("TagNciAdapterRw::Disconnect : tag has been deactived.");
-        return NFA_STATUS_OK;
+        return true;
     }
     DebugLog("TagNciAdapterRw::Disconnect");
     rfDiscoveryMutex_.lock();
@@ -399,13 +508,10 @@ bool TagNciAdapterRw::Reconnect()
         return false;
     }
     // return for TARGET_TYPE_KOVIO_BARCODE
-    // this is only supported for type 2 or 4 (ISO_DEP) tags
-    if (g_commonConnectedProtocol == NFA_PROTOCOL_ISO_DEP) {
-        return Reselect(NFA_INTERFACE_ISO_DEP, false);
-    } else if (g_commonConnectedProtocol == NFA_PROTOCOL_T2T) {
-        return Reselect(NFA_INTERFACE_FRAME, false);
-    } else if (g_commonConnectedProtocol == NFC_PROTOCOL_MIFARE) {
-        return Reselect(NFA_INTERFACE_MIFARE, false);
+    // this is only supported for type 2 or 4 (ISO_DEP) tags and mifare classic
+    const TagTransceiveProfile::Profile& profile = TagTransceiveProfile::Get(g_commonConnectedProtocol);
+    if (profile.canReconnect) {
+        return Reselect(profile.rfInterface, false);
     }
     return true;
 }
@@ -427,6 +533,49 @@ bool TagNciAdapterRw::IsT2TNackRsp(const uint8_t* response, uint32_t responseLen
     return false;
 }
 
+template <>
+tNFA_STATUS TagNciAdapterRw::HandleTransceiveRsp<TagTransceiveProfile::RSP_RAW>(std::string& response)
+{
+    TagTransceiveProfile::EncodeHex(receivedData_.data(), receivedData_.size(), response);
+    return NFA_STATUS_OK;
+}
+
+template <>
+tNFA_STATUS TagNciAdapterRw::HandleTransceiveRsp<TagTransceiveProfile::RSP_T2T_NACK>(std::string& response)
+{
+    if (IsT2TNackRsp(receivedData_.data(), receivedData_.size())) {
+        // Do reconnect for mifareUL tag when it responses NACK and enters HALT state
+        InfoLog("TagNciAdapterRw::Transceive:try reconnect for T2T NACK");
+        Reconnect();
+        return NFA_STATUS_OK;
+    }
+    return HandleTransceiveRsp<TagTransceiveProfile::RSP_RAW>(response);
+}
+
+template <>
+tNFA_STATUS TagNciAdapterRw::HandleTransceiveRsp<TagTransceiveProfile::RSP_MFC>(std::string& response)
+{
+    if (g_commonIsLegacyMifareReader) {
+        return HandleMfcTransceiveData(response);
+    }
+    return HandleTransceiveRsp<TagTransceiveProfile::RSP_RAW>(response);
+}
+
+/**
+ * @brief Handle the response in receivedData_ by the handler of the protocol, for both the synchronous and
+ * the asynchronous transceive.
+ */
+tNFA_STATUS TagNciAdapterRw::HandleTransceiveRsp(TagTransceiveProfile::RspHandler handler, std::string& response)
+{
+    using RspHandlerFunc = tNFA_STATUS (TagNciAdapterRw::*)(std::string&);
+    static constexpr RspHandlerFunc RSP_HANDLERS[TagTransceiveProfile::RSP_HANDLER_COUNT] = {
+        &TagNciAdapterRw::HandleTransceiveRsp<TagTransceiveProfile::RSP_RAW>,
+        &TagNciAdapterRw::HandleTransceiveRsp<TagTransceiveProfile::RSP_T2T_NACK>,
+        &TagNciAdapterRw::HandleTransceiveRsp<TagTransceiveProfile::RSP_MFC>,
+    };
+    return (this->*RSP_HANDLERS[handler])(response);
+}
+
 int TagNciAdapterRw::Transceive(const std::string& request, std::string& response)
 {
     if (!IsTagActive() || (tagState_ != ACTIVE)) {
@@ -434,57 +583,374 @@ int TagNciAdapterRw::Transceive(const std::string& request, std::string& respons
             IsTagActive(), tagState_);
         return NFA_STATUS_BUSY;
     }
+    if (IsAsyncOpPending()) {
+        ErrorLog("Transceive, async operation pending");
+        return NFA_STATUS_BUSY;
+    }
+    const TagTransceiveProfile::Profile& profile = TagTransceiveProfile::Get(g_commonConnectedProtocol);
+    bool isLegacyMfc = (profile.rspHandler == TagTransceiveProfile::RSP_MFC) && g_commonIsLegacyMifareReader;
     tNFA_STATUS status = NFA_STATUS_FAILED;
     isInTransceive_ = true;
     isTransceiveTimeout_ = false;
     do {
         bool wait = true;
+        bool isOverdue = false;
+        uint32_t key = 0;
+        uint32_t fullTimeout = 0;
+        std::chrono::steady_clock::time_point sendTime;
         {
             NFC::SynchronizeGuard guard(transceiveEvent_);
-            uint16_t length = KITS::NfcSdkCommon::GetHexStrBytesLen(request);
-            std::vector<unsigned char> requestInCharVec;
-            KITS::NfcSdkCommon::HexStringToBytes(request, requestInCharVec);
-            InfoLog("TagNciAdapterRw::Transceive: requestLen = %{public}d", length);
+            if (!TagTransceiveProfile::DecodeHex(request, requestData_)) {
+                ErrorLog("TagNciAdapterRw::Transceive: request not in hex");
+                break;
+            }
+            uint16_t length = static_cast<uint16_t>(requestData_.size());
+            TransceiveTraceLog("TagNciAdapterRw::Transceive: requestLen = %{public}d", length);
             receivedData_.clear();
-            if (IsMifareConnected() && g_commonIsLegacyMifareReader) {
-                ErrorLog("TagNciAdapterRw::Transceive: is mifare");
-                status = Extns::GetInstance().EXTNS_MfcTransceive(
-                    static_cast<uint8_t *>(requestInCharVec.data()), length);
+            key = GetTransceiveKey(requestData_);
+            fullTimeout = GetFullTimeout();
+            uint32_t softTimeout = GetSoftTimeout(key, fullTimeout);
+            sendTime = std::chrono::steady_clock::now();
+            if (isLegacyMfc) {
+                status = Extns::GetInstance().EXTNS_MfcTransceive(requestData_.data(), length);
             } else {
-                status = NFA_SendRawFrame(static_cast<uint8_t *>(requestInCharVec.data()),
-                    length, NFA_DM_DEFAULT_PRESENCE_CHECK_START_DELAY);
+                status = NFA_SendRawFrame(requestData_.data(), length, NFA_DM_DEFAULT_PRESENCE_CHECK_START_DELAY);
             }
             if (status != NFA_STATUS_OK) {
                 ErrorLog("TagNciAdapterRw::Transceive: fail send; error=%{public}d", status);
                 break;
             }
-            wait = transceiveEvent_.Wait(GetTimeout(g_commonConnectedType));
+            wait = transceiveEvent_.Wait(softTimeout);
+            if (!wait && softTimeout < fullTimeout) {
+                // the tag is slower than learned, the command still runs until the full timeout.
+                isOverdue = true;
+                rttEstimator_.OnOverdue(key, softTimeout);
+                wait = transceiveEvent_.Wait(fullTimeout - softTimeout);
+            }
         }
+        uint32_t elapsedUs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - sendTime).count());
         if (!wait || isTransceiveTimeout_) {
             ErrorLog("TagNciAdapterRw::Transceive: wait response timeout transceiveTimeout: %{public}d,"
-                "wait: %{public}d, isTimeout: %{public}d", GetTimeout(g_commonConnectedType),
-                wait, isTransceiveTimeout_);
+                "wait: %{public}d, isTimeout: %{public}d", fullTimeout, wait, isTransceiveTimeout_);
+            rttEstimator_.OnTimeout(key);
             status = NFA_STATUS_TIMEOUT;
             break;
         }
+        rttEstimator_.OnResponse(key, elapsedUs, isOverdue);
         if (receivedData_.size() > 0) {
-            if (g_commonConnectedProtocol == NFA_PROTOCOL_T2T &&
-                IsT2TNackRsp(receivedData_.data(), receivedData_.size())) {
-                // Do reconnect for mifareUL tag when it responses NACK and enters HALT state
-                InfoLog("TagNciAdapterRw::Transceive:try reconnect for T2T NACK");
-                Reconnect();
-            } else if (IsMifareConnected() && g_commonIsLegacyMifareReader) {
-                status = HandleMfcTransceiveData(response);
-            } else {
-                response = KITS::NfcSdkCommon::BytesVecToHexString(receivedData_.data(), receivedData_.size());
-            }
+            status = HandleTransceiveRsp(profile.rspHandler, response);
         }
     } while (0);
     isInTransceive_ = false;
-    InfoLog("TagNciAdapterRw::Transceive: exit rsp len = %{public}d", KITS::NfcSdkCommon::GetHexStrBytesLen(response));
+    TransceiveTraceLog("TagNciAdapterRw::Transceive: exit rsp len = %{public}zu",
+        response.size() / KITS::HEX_BYTE_LEN);
     return status;
 }
 
+/**
+ * @brief Order the tags of a transceive batch, the selected tag goes first and the others follow the order
+ * they first appear in the batch, so that each tag is selected once at most.
+ */
+std::vector<uint32_t> TagNciAdapterRw::GetBatchTagOrder(
+    const std::vector<INciTagInterface::TagTransceiveItem>& items) const
+{
+    std::vector<uint32_t> tagOrder;
+    for (const INciTagInterface::TagTransceiveItem& item : items) {
+        if (std::find(tagOrder.begin(), tagOrder.end(), item.rfDiscId) != tagOrder.end()) {
+            continue;
+        }
+        if (TagNciAdapterCommon::GetInstance().IsActiveTagSession(item.rfDiscId)) {
+            tagOrder.insert(tagOrder.begin(), item.rfDiscId);
+        } else {
+            tagOrder.push_back(item.rfDiscId);
+        }
+    }
+    return tagOrder;
+}
+
+int TagNciAdapterRw::TransceiveBatch(std::vector<INciTagInterface::TagTransceiveItem>& items)
+{
+    int count = 0;
+    const std::vector<uint32_t>& discIdList = TagNciAdapterCommon::GetInstance().tagRfDiscIdList_;
+    for (uint32_t discId : GetBatchTagOrder(items)) {
+        tNFA_STATUS status = NFA_STATUS_OK;
+        if (!TagNciAdapterCommon::GetInstance().IsActiveTagSession(discId)) {
+            auto iter = std::find(discIdList.begin(), discIdList.end(), discId);
+            status = (iter == discIdList.end()) ? NFA_STATUS_FAILED :
+                Connect(static_cast<uint32_t>(std::distance(discIdList.begin(), iter)));
+        }
+        for (INciTagInterface::TagTransceiveItem& item : items) {
+            if (item.rfDiscId != discId) {
+                continue;
+            }
+            if (status != NFA_STATUS_OK) {
+                ErrorLog("TagNciAdapterRw::TransceiveBatch: tag %{public}d not selected", discId);
+                item.status = status;
+                continue;
+            }
+            item.response.clear();
+            item.status = Transceive(item.command, item.response);
+            if (item.status == NFA_STATUS_OK) {
+                count++;
+            }
+        }
+    }
+    InfoLog("TagNciAdapterRw::TransceiveBatch: %{public}d of %{public}zu transceived", count, items.size());
+    return count;
+}
+
+bool TagNciAdapterRw::IsAsyncOpPending()
+{
+    NFC::SynchronizeGuard guard(asyncOpEvent_);
+    return asyncOp_.type != AsyncOpType::NONE;
+}
+
+uint32_t TagNciAdapterRw::NextRequestId()
+{
+    lastRequestId_++;
+    if (lastRequestId_ == INVALID_REQUEST_ID) {
+        lastRequestId_++;
+    }
+    return lastRequestId_;
+}
+
+/**
+ * @brief Send command to the tag without waiting the response, the response is delivered to the callback
+ * by the async worker, after the same response handling as Transceive.
+ * @param request The command in hex string.
+ * @param callback The callback to receive the status and the response.
+ * @return The request id, or INVALID_REQUEST_ID if failed to send.
+ */
+uint32_t TagNciAdapterRw::TransceiveAsync(const std::string& request, INciTagInterface::TagOpCallback callback)
+{
+    if (!IsTagActive() || (tagState_ != ACTIVE) || callback == nullptr) {
+        ErrorLog("TransceiveAsync, IsTagActive:%{public}d, tagState_::%{public}d", IsTagActive(), tagState_);
+        return INVALID_REQUEST_ID;
+    }
+    if (IsMifareConnected() && g_commonIsLegacyMifareReader) {
+        // response of legacy mifare reader is assembled by extns synchronously.
+        ErrorLog("TransceiveAsync, not supported for legacy mifare reader");
+        return INVALID_REQUEST_ID;
+    }
+    std::basic_string<uint8_t> requestInCharVec;
+    if (!TagTransceiveProfile::DecodeHex(request, requestInCharVec)) {
+        ErrorLog("TransceiveAsync, request not in hex");
+        return INVALID_REQUEST_ID;
+    }
+    uint32_t key = GetTransceiveKey(requestInCharVec);
+    uint32_t timeout = GetFullTimeout();
+    uint32_t softTimeout = GetSoftTimeout(key, timeout);
+    uint32_t requestId = INVALID_REQUEST_ID;
+    {
+        NFC::SynchronizeGuard guard(asyncOpEvent_);
+        if (isInTransceive_ || asyncOp_.type != AsyncOpType::NONE) {
+            ErrorLog("TransceiveAsync, busy");
+            return INVALID_REQUEST_ID;
+        }
+        requestId = NextRequestId();
+        auto now = std::chrono::steady_clock::now();
+        asyncOp_ = { requestId, AsyncOpType::TRANSCEIVE, callback, key, timeout, now,
+            now + std::chrono::milliseconds(timeout), softTimeout };
+        receivedData_.clear();
+        isInTransceive_ = true;
+        tNFA_STATUS status = NFA_SendRawFrame(requestInCharVec.data(),
+            requestInCharVec.size(), NFA_DM_DEFAULT_PRESENCE_CHECK_START_DELAY);
+        if (status != NFA_STATUS_OK) {
+            ErrorLog("TransceiveAsync: fail send; error=%{public}d", status);
+            asyncOp_ = AsyncOp();
+            isInTransceive_ = false;
+            return INVALID_REQUEST_ID;
+        }
+        StartAsyncWorker();
+        asyncOpEvent_.NotifyOne();
+    }
+    InfoLog("TagNciAdapterRw::TransceiveAsync: requestId = %{public}u, timeout = %{public}u", requestId, timeout);
+    return requestId;
+}
+
+void TagNciAdapterRw::HandleAsyncTranceiveData(uint8_t status, uint8_t* data, uint32_t dataLen)
+{
+    NFC::SynchronizeGuard guard(asyncOpEvent_);
+    if (asyncOp_.type != AsyncOpType::TRANSCEIVE || asyncOp_.isDone) {
+        return;
+    }
+    if (status == NFA_STATUS_OK || status == NFA_STATUS_CONTINUE) {
+        receivedData_.append(data, dataLen);
+    }
+    if (status != NFA_STATUS_OK) {
+        return;
+    }
+    uint32_t elapsedUs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - asyncOp_.sendTime).count());
+    rttEstimator_.OnResponse(asyncOp_.key, elapsedUs, asyncOp_.isOverdue);
+    // the response handler may reconnect the tag, which can not wait on the nci stack thread.
+    asyncOp_.isDone = true;
+    asyncOp_.status = NFA_STATUS_OK;
+    asyncOpEvent_.NotifyOne();
+}
+
+/**
+ * @brief Read the NDEF message without waiting, the message is delivered to the callback by the async worker
+ * once HandleAsyncReadComplete is called.
+ * @param callback The callback to receive the status and the NDEF message.
+ * @return The request id, or INVALID_REQUEST_ID if failed to read.
+ */
+uint32_t TagNciAdapterRw::ReadNdefAsync(INciTagInterface::TagOpCallback callback)
+{
+    if (!IsTagActive() || callback == nullptr) {
+        ErrorLog("ReadNdefAsync, IsTagActive failed");
+        return INVALID_REQUEST_ID;
+    }
+    uint32_t requestId = INVALID_REQUEST_ID;
+    {
+        NFC::SynchronizeGuard guard(asyncOpEvent_);
+        if (isInTransceive_ || asyncOp_.type != AsyncOpType::NONE) {
+            ErrorLog("ReadNdefAsync, busy");
+            return INVALID_REQUEST_ID;
+        }
+        requestId = NextRequestId();
+        if (lastCheckedNdefSize_ == 0) {
+            // nothing to read, same as the synchronous read.
+            asyncOp_ = AsyncOp();
+        } else {
+            g_commonReadNdefData = "";
+            g_commonIsNdefReading = true;
+            auto now = std::chrono::steady_clock::now();
+            asyncOp_ = { requestId, AsyncOpType::READ_NDEF, callback, 0, READ_NDEF_TIMEOUT, now,
+                now + std::chrono::milliseconds(READ_NDEF_TIMEOUT) };
+            tNFA_STATUS status = (IsMifareConnected() && g_commonIsLegacyMifareReader) ?
+                Extns::GetInstance().EXTNS_MfcReadNDef() : NFA_RwReadNDef();
+            if (status != NFA_STATUS_OK) {
+                ErrorLog("ReadNdefAsync: fail read; error=%{public}d", status);
+                g_commonIsNdefReading = false;
+                asyncOp_ = AsyncOp();
+                return INVALID_REQUEST_ID;
+            }
+            StartAsyncWorker();
+            asyncOpEvent_.NotifyOne();
+        }
+    }
+    if (lastCheckedNdefSize_ == 0) {
+        callback(NFA_STATUS_OK, "");
+    }
+    return requestId;
+}
+
+/**
+ * @brief Complete the pending asynchronous NDEF read, NFA_READ_CPLT_EVT calls this.
+ * @param status The status of the read.
+ * @return True if an asynchronous read was pending, otherwise the read is synchronous.
+ */
+bool TagNciAdapterRw::HandleAsyncReadComplete(uint8_t status)
+{
+    NFC::SynchronizeGuard guard(asyncOpEvent_);
+    if (asyncOp_.type != AsyncOpType::READ_NDEF) {
+        return false;
+    }
+    if (asyncOp_.isDone) {
+        return true;
+    }
+    if (status != NFA_STATUS_OK) {
+        ErrorLog("HandleAsyncReadComplete: read ndef fail");
+        g_commonIsNdefReadTimeOut = true;
+    } else {
+        asyncOp_.response = g_commonReadNdefData;
+    }
+    g_commonIsNdefReading = false;
+    asyncOp_.isDone = true;
+    asyncOp_.status = status;
+    asyncOpEvent_.NotifyOne();
+    return true;
+}
+
+/**
+ * @brief Start the thread completing the asynchronous operations, one for all of them. Called with
+ * asyncOpEvent_ locked.
+ */
+void TagNciAdapterRw::StartAsyncWorker()
+{
+    if (!asyncWorker_.joinable()) {
+        asyncWorker_ = std::thread(&TagNciAdapterRw::AsyncOpWorker, this);
+    }
+}
+
+void TagNciAdapterRw::AsyncOpWorker()
+{
+    while (true) {
+        AsyncOp op;
+        {
+            NFC::SynchronizeGuard guard(asyncOpEvent_);
+            if (!WaitAsyncOpDone()) {
+                return;
+            }
+            op = asyncOp_;
+        }
+        CompleteAsyncOp(op);
+    }
+}
+
+/**
+ * @brief Wait the pending operation done or timeout, called with asyncOpEvent_ locked.
+ * @return False if the worker exits.
+ */
+bool TagNciAdapterRw::WaitAsyncOpDone()
+{
+    while (!isAsyncWorkerExit_) {
+        if (asyncOp_.type == AsyncOpType::NONE) {
+            asyncOpEvent_.Wait();
+            continue;
+        }
+        if (asyncOp_.isDone) {
+            return true;
+        }
+        auto now = std::chrono::steady_clock::now();
+        auto softDeadline = asyncOp_.sendTime + std::chrono::milliseconds(asyncOp_.softTimeout);
+        if (!asyncOp_.isOverdue && asyncOp_.softTimeout > 0 && now >= softDeadline) {
+            // the tag is slower than learned, the op still runs until the full timeout.
+            asyncOp_.isOverdue = true;
+            rttEstimator_.OnOverdue(asyncOp_.key, asyncOp_.softTimeout);
+        }
+        auto wakeTime = (asyncOp_.isOverdue || asyncOp_.softTimeout == 0) ? asyncOp_.deadline : softDeadline;
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(wakeTime - now).count();
+        if (remaining > 0) {
+            asyncOpEvent_.Wait(static_cast<long>(remaining));
+            continue;
+        }
+        ErrorLog("TagNciAdapterRw::WaitAsyncOpDone: requestId = %{public}u timeout, type = %{public}d",
+            asyncOp_.requestId, static_cast<int>(asyncOp_.type));
+        asyncOp_.isDone = true;
+        asyncOp_.status = NFA_STATUS_TIMEOUT;
+        if (asyncOp_.type == AsyncOpType::TRANSCEIVE) {
+            rttEstimator_.OnTimeout(asyncOp_.key);
+        } else {
+            g_commonIsNdefReading = false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void TagNciAdapterRw::CompleteAsyncOp(AsyncOp& op)
+{
+    std::string response = op.response;
+    tNFA_STATUS status = op.status;
+    if (op.type == AsyncOpType::TRANSCEIVE && status == NFA_STATUS_OK && receivedData_.size() > 0) {
+        // the operation stays pending while handled, so no other command touches receivedData_.
+        status = HandleTransceiveRsp(TagTransceiveProfile::Get(g_commonConnectedProtocol).rspHandler, response);
+    }
+    {
+        NFC::SynchronizeGuard guard(asyncOpEvent_);
+        if (op.type == AsyncOpType::TRANSCEIVE) {
+            isInTransceive_ = false;
+        }
+        asyncOp_ = AsyncOp();
+    }
+    DebugLog("TagNciAdapterRw::CompleteAsyncOp: requestId = %{public}u, status = %{public}d, rsp len = %{public}zu",
+        op.requestId, status, response.size());
+    op.callback(status, response);
+}
+
 void TagNciAdapterRw::HandleFieldCheckResult(uint8_t status)
 {
     NFC::SynchronizeGuard guard(fieldCheckEvent_);
@@ -501,7 +967,7 @@ void TagNciAdapterRw::ResetTagFieldOnFlag()
 void TagNciAdapterRw::HandleTranceiveData(uint8_t status, uint8_t* data, uint32_t dataLen)
 {
     if (IsMifareConnected() && g_commonIsLegacyMifareReader) {
-        InfoLog("TagNciAdapterRw::HandleTranceiveData: is mifare");
+        TransceiveTraceLog("TagNciAdapterRw::HandleTranceiveData: is mifare");
         isMfcTransRspErr_ = (dataLen == 2 && data[0] == MIFARE_RESPONSE_LEN && data[1] != T2T_ACK_RESPONSE);
         if (!Extns::GetInstance().EXTNS_GetCallBackFlag()) {
             ErrorLog("TagNciAdapterRw::HandleTranceiveData: ExtnsGetCallBackFlag is false");
@@ -513,6 +979,10 @@ void TagNciAdapterRw::HandleTranceiveData(uint8_t status, uint8_t* data, uint32_
         ErrorLog("TagNciAdapterRw::HandleTranceiveData: not in transceive");
         return;
     }
+    if (IsAsyncOpPending()) {
+        HandleAsyncTranceiveData(status, data, dataLen);
+        return;
+    }
     NFC::SynchronizeGuard guard(transceiveEvent_);
     if (status == NFA_STATUS_OK || status == NFA_STATUS_CONTINUE) {
         receivedData_.append(data, dataLen);
@@ -520,7 +990,7 @@ void TagNciAdapterRw::HandleTranceiveData(uint8_t status, uint8_t* data, uint32_
     if (status == NFA_STATUS_OK) {
         transceiveEvent_.NotifyOne();
     }
-    DebugLog("TagNciAdapterRw::HandleTranceiveData: status = %{public}d", status);
+    TransceiveTraceLog("TagNciAdapterRw::HandleTranceiveData: status = %{public}d", status);
 }
 
 bool TagNciAdapterRw::IsTagFieldOn()
@@ -531,6 +1001,10 @@ bool TagNciAdapterRw::IsTagFieldOn()
     if (isInTransceive_ && IsMifareConnected()) {
         return true;
     }
+    if (IsAsyncOpPending()) {
+        // presence check can not be sent while waiting response, the tag is present until the op times out.
+        return true;
+    }
     tNFA_STATUS status = NFA_STATUS_FAILED;
 #if (NXP_EXTNS == TRUE)
     if (TagNciAdapterCommon::GetInstance().tagRfProtocols_[0] == NFA_PROTOCOL_T3BT) {
@@ -589,6 +1063,20 @@ void TagNciAdapterRw::SetTimeout(const uint32_t timeout, const uint32_t technolo
     }
 }
 
+void TagNciAdapterRw::SetUserTimeout(const uint32_t timeout, const uint32_t technology)
+{
+    SetTimeout(timeout, technology);
+    if (technology > 0 && technology < MAX_NUM_TECHNOLOGY) {
+        // the timeout set by app is respected, not bounded by the learned response time.
+        TagNciAdapterCommon::GetInstance().isTimeoutOverridden_[technology] = true;
+    }
+}
+
+void TagNciAdapterRw::Dump(int fd) const
+{
+    rttEstimator_.Dump(fd);
+}
+
 bool TagNciAdapterRw::SetReadOnly() const
 {
     DebugLog("TagNciAdapterRw::SetReadOnly");
@@ -1044,6 +1532,7 @@ void TagNciAdapterRw::HandleDeactivatedResult(tNFA_DEACTIVATE_TYPE deactType)
     }
 #endif
     TagNciAdapterCommon::GetInstance().ResetTag();
+    rttEstimator_.Reset();
 }
 }  // namespace NCI
 }  // namespace NFC
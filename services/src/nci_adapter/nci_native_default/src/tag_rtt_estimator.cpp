@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tag_rtt_estimator.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include "loghelper.h"
+
+namespace OHOS {
+namespace NFC {
+namespace NCI {
+static const uint32_t MIN_SAMPLES = 3;             // samples needed before the soft deadline takes effect
+static const uint32_t MIN_SOFT_TIMEOUT = 50;       // ms, the soft deadline is never shorter
+static const uint32_t CLOCK_GRANULARITY_US = 1000; // us, lower bound of the variation term
+static const uint32_t MAX_BACKOFF = 3;             // the soft deadline doubles at most 3 times after overdues
+static const uint32_t US_PER_MS = 1000;
+static const uint32_t RTT_VAR_FACTOR = 4;
+static const uint32_t SRTT_SHIFT = 3;              // srtt = 7/8 srtt + 1/8 rtt
+static const uint32_t RTT_VAR_SHIFT = 2;           // rttvar = 3/4 rttvar + 1/4 |srtt - rtt|
+static const uint32_t DISC_ID_SHIFT = 16;
+static const uint32_t TECH_SHIFT = 8;
+
+uint32_t TagRttEstimator::BuildKey(uint32_t discId, uint32_t technology, uint8_t cmdClass)
+{
+    return (discId << DISC_ID_SHIFT) | ((technology & 0xFF) << TECH_SHIFT) | cmdClass;
+}
+
+uint32_t TagRttEstimator::GetSoftTimeout(uint32_t key, uint32_t fullTimeout, uint32_t minTimeout)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = stats_.find(key);
+    if (iter == stats_.end() || iter->second.samples < MIN_SAMPLES) {
+        return fullTimeout;
+    }
+    RttStats& stats = iter->second;
+    uint32_t rtoUs = stats.srttUs + std::max(CLOCK_GRANULARITY_US, RTT_VAR_FACTOR * stats.rttVarUs);
+    uint32_t timeout = std::max({(rtoUs + US_PER_MS - 1) / US_PER_MS, minTimeout, MIN_SOFT_TIMEOUT});
+    timeout = std::min(timeout << stats.backoff, fullTimeout);
+    if (timeout < fullTimeout) {
+        softWaits_++;
+    }
+    stats.lastSoftTimeoutMs = timeout;
+    return timeout;
+}
+
+void TagRttEstimator::OnResponse(uint32_t key, uint32_t rttUs, bool isOverdue)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    RttStats& stats = stats_[key];
+    if (stats.samples == 0) {
+        stats.srttUs = rttUs;
+        stats.rttVarUs = rttUs / 2; // 2 for half of the first sample, see RFC 6298
+    } else {
+        uint32_t delta = (stats.srttUs > rttUs) ? (stats.srttUs - rttUs) : (rttUs - stats.srttUs);
+        stats.rttVarUs = stats.rttVarUs - (stats.rttVarUs >> RTT_VAR_SHIFT) + (delta >> RTT_VAR_SHIFT);
+        stats.srttUs = stats.srttUs - (stats.srttUs >> SRTT_SHIFT) + (rttUs >> SRTT_SHIFT);
+    }
+    stats.maxRttUs = std::max(stats.maxRttUs, rttUs);
+    stats.samples++;
+    stats.backoff = 0;
+    totalSamples_++;
+    if (isOverdue) {
+        lateResponses_++;
+    }
+}
+
+void TagRttEstimator::OnOverdue(uint32_t key, uint32_t softTimeout)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    RttStats& stats = stats_[key];
+    stats.overdues++;
+    stats.backoff = std::min(stats.backoff + 1, MAX_BACKOFF);
+    overdueCmds_++;
+    InfoLog("TagRttEstimator::OnOverdue: key = 0x%{public}X, soft timeout = %{public}u, backoff = %{public}u",
+        key, softTimeout, stats.backoff);
+}
+
+void TagRttEstimator::OnTimeout(uint32_t key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_[key].timeouts++;
+    timeouts_++;
+}
+
+void TagRttEstimator::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.clear();
+}
+
+void TagRttEstimator::Dump(int fd) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    dprintf(fd, "Tag transceive timeouts:\n");
+    dprintf(fd, "  samples: %" PRIu64 ", soft waits: %" PRIu64 ", overdue: %" PRIu64 ", late responses: %" PRIu64
+        ", timeouts: %" PRIu64 "\n", totalSamples_, softWaits_, overdueCmds_, lateResponses_, timeouts_);
+    for (const auto& [key, stats] : stats_) {
+        dprintf(fd, "  key 0x%08X: srtt %u us, rttvar %u us, max %u us, samples %u, overdues %u, timeouts %u, "
+            "backoff %u, last soft timeout %u ms\n", key, stats.srttUs, stats.rttVarUs, stats.maxRttUs,
+            stats.samples, stats.overdues, stats.timeouts, stats.backoff, stats.lastSoftTimeoutMs);
+    }
+}
+}  // namespace NCI
+}  // namespace NFC
+}  // namespace OHOS
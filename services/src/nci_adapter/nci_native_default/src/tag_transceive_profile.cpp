@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tag_transceive_profile.h"
+
+namespace OHOS {
+namespace NFC {
+namespace NCI {
+static const uint32_t HEX_CHARS_PER_BYTE = 2;
+static const uint32_t HALF_BYTE_SHIFT = 4;
+static const uint8_t HALF_BYTE_MASK = 0x0F;
+static const int INVALID_NIBBLE = -1;
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+static int HexCharToNibble(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10; // 10 for 'A'
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10; // 10 for 'a'
+    }
+    return INVALID_NIBBLE;
+}
+
+bool TagTransceiveProfile::DecodeHex(const std::string& hex, std::basic_string<uint8_t>& bytes)
+{
+    size_t len = hex.size() / HEX_CHARS_PER_BYTE;
+    bytes.resize(len);
+    for (size_t i = 0; i < len; i++) {
+        int high = HexCharToNibble(hex[i * HEX_CHARS_PER_BYTE]);
+        int low = HexCharToNibble(hex[i * HEX_CHARS_PER_BYTE + 1]);
+        if (high == INVALID_NIBBLE || low == INVALID_NIBBLE) {
+            bytes.clear();
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>((high << HALF_BYTE_SHIFT) | low);
+    }
+    return true;
+}
+
+void TagTransceiveProfile::EncodeHex(const uint8_t* data, size_t len, std::string& hex)
+{
+    hex.resize(len * HEX_CHARS_PER_BYTE);
+    for (size_t i = 0; i < len; i++) {
+        hex[i * HEX_CHARS_PER_BYTE] = HEX_DIGITS[data[i] >> HALF_BYTE_SHIFT];
+        hex[i * HEX_CHARS_PER_BYTE + 1] = HEX_DIGITS[data[i] & HALF_BYTE_MASK];
+    }
+}
+}  // namespace NCI
+}  // namespace NFC
+}  // namespace OHOS
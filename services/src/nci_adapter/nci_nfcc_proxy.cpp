@@ -142,6 +142,13 @@ void NciNfccProxy::UpdateWantExtInfoByVendor(AAFwk::Want& want, const std::strin
         return nfccInterface_->UpdateWantExtInfoByVendor(want, uri);
     }
 }
+
+void NciNfccProxy::Dump(int fd)
+{
+    if (nfccInterface_) {
+        return nfccInterface_->Dump(fd);
+    }
+}
 }  // namespace NCI
 }  // namespace NFC
 }  // namespace OHOS
\ No newline at end of file
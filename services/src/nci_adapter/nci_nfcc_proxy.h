@@ -86,6 +86,12 @@ public:
      * @brief Send want to vendor update
     */
     void UpdateWantExtInfoByVendor(AAFwk::Want& want, const std::string& uri) override;
+
+    /**
+     * @brief Dump the debug info of the nfc controller, such as the trace of the nci events
+     * @param fd File descriptor to write the debug info
+    */
+    void Dump(int fd) override;
 private:
     std::shared_ptr<INciNfccInterface> nfccInterface_;
 };
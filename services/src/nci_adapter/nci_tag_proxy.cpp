@@ -74,6 +74,19 @@ std::vector<AppExecFwk::PacMap> NciTagProxy::GetTechExtrasData(uint32_t tagDiscI
     return std::vector<AppExecFwk::PacMap>();
 }
 
+/**
+ * @brief Get the extra data of all discovered technologies in fixed fields.
+ * @param tagDiscId The tag discovered id given from nci stack.
+ * @return The extra data of all discovered technologies.
+ */
+std::vector<KITS::TagTechExtras> NciTagProxy::GetTechExtras(uint32_t tagDiscId)
+{
+    if (nciTagInterface_) {
+        return nciTagInterface_->GetTechExtras(tagDiscId);
+    }
+    return std::vector<KITS::TagTechExtras>();
+}
+
 /**
  * @brief Get the uid of discovered tag.
  * @param tagDiscId The tag discovered id given from nci stack.
@@ -142,6 +155,20 @@ int NciTagProxy::Transceive(uint32_t tagDiscId, const std::string& command, std:
     return 0;
 }
 
+/**
+ * @brief Send commands to the tags in the field, each tag is selected once at most.
+ * @param tagDiscId The tag discovered id given from nci stack.
+ * @param items The commands to send, the responses and status codes are filled in.
+ * @return The count of commands transceived successfully.
+ */
+int NciTagProxy::TransceiveBatch(uint32_t tagDiscId, std::vector<TagTransceiveItem>& items)
+{
+    if (nciTagInterface_) {
+        return nciTagInterface_->TransceiveBatch(tagDiscId, items);
+    }
+    return 0;
+}
+
 /**
  * @brief Read the NDEF tag.
  * @param tagDiscId The tag discovered id given from nci stack.
@@ -155,6 +182,35 @@ std::string NciTagProxy::ReadNdef(uint32_t tagDiscId)
     return {};
 }
 
+/**
+ * @brief Send command to tag without waiting the response.
+ * @param tagDiscId The tag discovered id given from nci stack.
+ * @param command The command to send.
+ * @param callback The callback to receive the status code and the response.
+ * @return True if the command is sent, otherwise the callback is not called.
+ */
+bool NciTagProxy::TransceiveAsync(uint32_t tagDiscId, const std::string& command, TagOpCallback callback)
+{
+    if (nciTagInterface_) {
+        return nciTagInterface_->TransceiveAsync(tagDiscId, command, callback);
+    }
+    return false;
+}
+
+/**
+ * @brief Read the NDEF tag without waiting the data.
+ * @param tagDiscId The tag discovered id given from nci stack.
+ * @param callback The callback to receive the status code and the data read from NDEF tag.
+ * @return True if the read is started, otherwise the callback is not called.
+ */
+bool NciTagProxy::ReadNdefAsync(uint32_t tagDiscId, TagOpCallback callback)
+{
+    if (nciTagInterface_) {
+        return nciTagInterface_->ReadNdefAsync(tagDiscId, callback);
+    }
+    return false;
+}
+
 /**
  * @brief Find the NDEF tag technology from the NDEF tag data.
  * @param tagDiscId The tag discovered id given from nci stack.
@@ -321,6 +377,18 @@ uint32_t NciTagProxy::GetIsoDepMaxTransceiveLength()
     return 0;
 }
 
+/**
+ * @brief Get the uid and technologies of all tags discovered in the field in one pass.
+ * @return The inventory of the discovered tags.
+ */
+std::vector<INciTagInterface::TagInventoryItem> NciTagProxy::GetTagInventory()
+{
+    if (nciTagInterface_) {
+        return nciTagInterface_->GetTagInventory();
+    }
+    return {};
+}
+
 /**
  * @brief Check if the nfc controller support extended APDU or not.
  * @return True if the nfc controller support extended APDU, otherwise false.
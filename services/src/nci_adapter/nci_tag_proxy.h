@@ -50,6 +50,13 @@ public:
      */
     std::vector<AppExecFwk::PacMap> GetTechExtrasData(uint32_t tagDiscId) override;
 
+    /**
+     * @brief Get the extra data of all discovered technologies in fixed fields.
+     * @param tagDiscId The tag discovered id given from nci stack.
+     * @return The extra data of all discovered technologies.
+     */
+    std::vector<KITS::TagTechExtras> GetTechExtras(uint32_t tagDiscId) override;
+
     /**
      * @brief Get the uid of discovered tag.
      * @param tagDiscId The tag discovered id given from nci stack.
@@ -88,6 +95,14 @@ public:
      */
     int Transceive(uint32_t tagDiscId, const std::string& command, std::string& response) override;
 
+    /**
+     * @brief Send commands to the tags in the field, each tag is selected once at most.
+     * @param tagDiscId The tag discovered id given from nci stack.
+     * @param items The commands to send, the responses and status codes are filled in.
+     * @return The count of commands transceived successfully.
+     */
+    int TransceiveBatch(uint32_t tagDiscId, std::vector<TagTransceiveItem>& items) override;
+
     /**
      * @brief Read the NDEF tag.
      * @param tagDiscId The tag discovered id given from nci stack.
@@ -95,6 +110,23 @@ public:
      */
     std::string ReadNdef(uint32_t tagDiscId) override;
 
+    /**
+     * @brief Send command to tag without waiting the response.
+     * @param tagDiscId The tag discovered id given from nci stack.
+     * @param command The command to send.
+     * @param callback The callback to receive the status code and the response.
+     * @return True if the command is sent, otherwise the callback is not called.
+     */
+    bool TransceiveAsync(uint32_t tagDiscId, const std::string& command, TagOpCallback callback) override;
+
+    /**
+     * @brief Read the NDEF tag without waiting the data.
+     * @param tagDiscId The tag discovered id given from nci stack.
+     * @param callback The callback to receive the status code and the data read from NDEF tag.
+     * @return True if the read is started, otherwise the callback is not called.
+     */
+    bool ReadNdefAsync(uint32_t tagDiscId, TagOpCallback callback) override;
+
     /**
      * @brief Find the NDEF tag technology from the NDEF tag data.
      * @param tagDiscId The tag discovered id given from nci stack.
@@ -187,6 +219,12 @@ public:
      */
     uint32_t GetIsoDepMaxTransceiveLength() override;
 
+    /**
+     * @brief Get the uid and technologies of all tags discovered in the field in one pass.
+     * @return The inventory of the discovered tags.
+     */
+    std::vector<TagInventoryItem> GetTagInventory() override;
+
     /**
      * @brief Check if the nfc controller support extended APDU or not.
      * @return True if the nfc controller support extended APDU, otherwise false.
@@ -14,6 +14,10 @@
  */
 #include "nfc_event_handler.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
 #include "ce_service.h"
 #include "common_event_support.h"
 #include "loghelper.h"
@@ -38,6 +42,36 @@
 namespace OHOS {
 namespace NFC {
 constexpr const char* EVENT_DATA_SHARE_READY = "usual.event.DATA_SHARE_READY";
+constexpr const char* CE_LANE_RUNNER_NAME = "nfcservice::CeRunner";
+constexpr const char* DISPATCH_LANE_RUNNER_NAME = "nfcservice::DispatchRunner";
+
+class NfcEventHandler::LaneHandler : public AppExecFwk::EventHandler {
+public:
+    LaneHandler(const std::shared_ptr<AppExecFwk::EventRunner>& runner, std::weak_ptr<NfcService> nfcService,
+        EventLane lane)
+        : EventHandler(runner), nfcService_(nfcService), lane_(lane)
+    {
+    }
+    ~LaneHandler()
+    {
+    }
+    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event) override
+    {
+        auto nfcServicePtr = nfcService_.lock();
+        if (nfcServicePtr == nullptr || nfcServicePtr->eventHandler_ == nullptr) {
+            ErrorLog("LaneHandler, nfcService or eventHandler is nullptr");
+            return;
+        }
+        // holds the owner until the event is handled.
+        std::shared_ptr<NfcEventHandler> eventHandler = nfcServicePtr->eventHandler_;
+        eventHandler->OnLaneEventHandled(lane_, event);
+        eventHandler->HandleEvent(event);
+    }
+
+private:
+    std::weak_ptr<NfcService> nfcService_ {};
+    EventLane lane_ = LANE_DISPATCH;
+};
 
 class NfcEventHandler::ScreenChangedReceiver : public EventFwk::CommonEventSubscriber {
 public:
@@ -279,6 +313,12 @@ NfcEventHandler::NfcEventHandler(const std::shared_ptr<AppExecFwk::EventRunner>
                                  std::weak_ptr<NfcService> service)
     : EventHandler(runner), nfcService_(service)
 {
+    if (runner != nullptr) {
+        ceLane_ = std::make_shared<LaneHandler>(AppExecFwk::EventRunner::Create(CE_LANE_RUNNER_NAME), service,
+            LANE_CE);
+        dispatchLane_ = std::make_shared<LaneHandler>(
+            AppExecFwk::EventRunner::Create(DISPATCH_LANE_RUNNER_NAME), service, LANE_DISPATCH);
+    }
 }
 
 NfcEventHandler::~NfcEventHandler()
@@ -287,6 +327,12 @@ NfcEventHandler::~NfcEventHandler()
     EventFwk::CommonEventManager::UnSubscribeCommonEvent(pkgSubscriber_);
     EventFwk::CommonEventManager::UnSubscribeCommonEvent(shutdownSubscriber_);
     EventFwk::CommonEventManager::UnSubscribeCommonEvent(dataShareSubscriber_);
+    if (ceLane_ != nullptr) {
+        ceLane_->RemoveAllEvents();
+    }
+    if (dispatchLane_ != nullptr) {
+        dispatchLane_->RemoveAllEvents();
+    }
 }
 
 void NfcEventHandler::Intialize(std::weak_ptr<TAG::TagDispatcher> tagDispatcher,
@@ -396,7 +442,193 @@ void NfcEventHandler::SubscribeDataShareChangedEvent()
     }
 }
 
+NfcEventHandler::EventLane NfcEventHandler::GetEventLane(uint32_t innerEventId)
+{
+    switch (static_cast<NfcCommonEvent>(innerEventId)) {
+        case NfcCommonEvent::MSG_FIELD_ACTIVATED:
+        case NfcCommonEvent::MSG_FIELD_DEACTIVATED:
+        case NfcCommonEvent::MSG_NOTIFY_FIELD_ON:
+        case NfcCommonEvent::MSG_NOTIFY_FIELD_OFF:
+        case NfcCommonEvent::MSG_NOTIFY_FIELD_OFF_TIMEOUT:
+        case NfcCommonEvent::MSG_COMMIT_ROUTING:
+        case NfcCommonEvent::MSG_COMPUTE_ROUTING_PARAMS:
+        case NfcCommonEvent::MSG_PACKAGE_UPDATED:
+        case NfcCommonEvent::MSG_DATA_SHARE_READY:
+        case NfcCommonEvent::MSG_VENDOR_EVENT:
+            return LANE_CE;
+#ifdef NDEF_WIFI_ENABLED
+        case NfcCommonEvent::MSG_WIFI_ENABLE_TIMEOUT:
+        case NfcCommonEvent::MSG_WIFI_CONNECT_TIMEOUT:
+        case NfcCommonEvent::MSG_WIFI_ENABLED:
+        case NfcCommonEvent::MSG_WIFI_CONNECTED:
+        case NfcCommonEvent::MSG_WIFI_NTF_CLICKED:
+#endif
+#ifdef NDEF_BT_ENABLED
+        case NfcCommonEvent::MSG_BT_ENABLE_TIMEOUT:
+        case NfcCommonEvent::MSG_BT_PAIR_TIMEOUT:
+        case NfcCommonEvent::MSG_BT_CONNECT_TIMEOUT:
+        case NfcCommonEvent::MSG_BT_ENABLED:
+        case NfcCommonEvent::MSG_BT_PAIR_STATUS_CHANGED:
+        case NfcCommonEvent::MSG_BT_CONNECT_STATUS_CHANGED:
+        case NfcCommonEvent::MSG_BT_NTF_CLICKED:
+#endif
+            return LANE_DISPATCH;
+        default:
+            // tag, screen and power events, the tag dispatcher is only run on this lane.
+            return LANE_RF;
+    }
+}
+
+std::shared_ptr<AppExecFwk::EventHandler> NfcEventHandler::GetLaneHandler(EventLane lane) const
+{
+    switch (lane) {
+        case LANE_CE:
+            return ceLane_;
+        case LANE_DISPATCH:
+            return dispatchLane_;
+        default:
+            return nullptr;
+    }
+}
+
+bool NfcEventHandler::SendEvent(uint32_t innerEventId, int64_t delayTime, Priority priority)
+{
+    auto event = AppExecFwk::InnerEvent::Get(innerEventId, static_cast<int64_t>(0));
+    return SendLaneEvent(event, delayTime, priority);
+}
+
+bool NfcEventHandler::SendEvent(uint32_t innerEventId, int64_t param, int64_t delayTime)
+{
+    auto event = AppExecFwk::InnerEvent::Get(innerEventId, param);
+    return SendLaneEvent(event, delayTime, Priority::LOW);
+}
+
+bool NfcEventHandler::SendLaneEvent(AppExecFwk::InnerEvent::Pointer& event, int64_t delayTime, Priority priority)
+{
+    if (event == nullptr) {
+        return false;
+    }
+    uint32_t innerEventId = event->GetInnerEventId();
+    int64_t param = event->GetParam();
+    EventLane lane = GetEventLane(innerEventId);
+    std::shared_ptr<AppExecFwk::EventHandler> laneHandler = GetLaneHandler(lane);
+    if (laneHandler != nullptr) {
+        if (!laneHandler->SendEvent(event, delayTime, priority)) {
+            return false;
+        }
+    } else {
+        lane = LANE_RF;
+        if (!AppExecFwk::EventHandler::SendEvent(event, delayTime, priority)) {
+            return false;
+        }
+    }
+    OnLaneEventSent(lane, innerEventId, param);
+    return true;
+}
+
+bool NfcEventHandler::PostDispatchTask(const std::function<void()>& task)
+{
+    if (dispatchLane_ == nullptr) {
+        return false;
+    }
+    return dispatchLane_->PostTask(task);
+}
+
+void NfcEventHandler::RemoveEvent(uint32_t innerEventId)
+{
+    EventLane lane = GetEventLane(innerEventId);
+    std::shared_ptr<AppExecFwk::EventHandler> laneHandler = GetLaneHandler(lane);
+    if (laneHandler != nullptr) {
+        laneHandler->RemoveEvent(innerEventId);
+    } else {
+        lane = LANE_RF;
+        AppExecFwk::EventHandler::RemoveEvent(innerEventId);
+    }
+    LaneStats& stats = laneStats_[lane];
+    std::lock_guard<std::mutex> lock(stats.mutex);
+    auto iter = stats.pendingEvents.lower_bound(std::make_pair(innerEventId, INT64_MIN));
+    while (iter != stats.pendingEvents.end() && iter->first.first == innerEventId) {
+        stats.depth -= std::min(stats.depth, iter->second);
+        iter = stats.pendingEvents.erase(iter);
+    }
+}
+
+void NfcEventHandler::RemoveEvent(uint32_t innerEventId, int64_t param)
+{
+    EventLane lane = GetEventLane(innerEventId);
+    std::shared_ptr<AppExecFwk::EventHandler> laneHandler = GetLaneHandler(lane);
+    if (laneHandler != nullptr) {
+        laneHandler->RemoveEvent(innerEventId, param);
+    } else {
+        lane = LANE_RF;
+        AppExecFwk::EventHandler::RemoveEvent(innerEventId, param);
+    }
+    LaneStats& stats = laneStats_[lane];
+    std::lock_guard<std::mutex> lock(stats.mutex);
+    auto iter = stats.pendingEvents.find(std::make_pair(innerEventId, param));
+    if (iter != stats.pendingEvents.end()) {
+        stats.depth -= std::min(stats.depth, iter->second);
+        stats.pendingEvents.erase(iter);
+    }
+}
+
+void NfcEventHandler::OnLaneEventSent(EventLane lane, uint32_t innerEventId, int64_t param)
+{
+    LaneStats& stats = laneStats_[lane];
+    std::lock_guard<std::mutex> lock(stats.mutex);
+    stats.pendingEvents[std::make_pair(innerEventId, param)]++;
+    stats.depth++;
+    stats.maxDepth = std::max(stats.maxDepth, stats.depth);
+}
+
+void NfcEventHandler::OnLaneEventHandled(EventLane lane, const AppExecFwk::InnerEvent::Pointer& event)
+{
+    if (event == nullptr) {
+        return;
+    }
+    // the wait counts from the time the event is due, the delay of a delayed event is not a wait.
+    uint64_t waitUs = 0;
+    if (event->GetHandleTime() != AppExecFwk::InnerEvent::TimePoint()) {
+        auto waitTime = AppExecFwk::InnerEvent::Clock::now() - event->GetHandleTime();
+        waitUs = static_cast<uint64_t>(
+            std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(waitTime).count()));
+    }
+    LaneStats& stats = laneStats_[lane];
+    std::lock_guard<std::mutex> lock(stats.mutex);
+    auto iter = stats.pendingEvents.find(std::make_pair(event->GetInnerEventId(), event->GetParam()));
+    if (iter != stats.pendingEvents.end()) {
+        // the events sent by pointer are not counted in the depth.
+        stats.depth -= std::min<uint32_t>(stats.depth, 1);
+        if (--iter->second == 0) {
+            stats.pendingEvents.erase(iter);
+        }
+    }
+    stats.handledCount++;
+    stats.totalWaitUs += waitUs;
+    stats.maxWaitUs = std::max(stats.maxWaitUs, waitUs);
+}
+
+void NfcEventHandler::Dump(int fd)
+{
+    static const char* const LANE_NAMES[LANE_COUNT] = {"rf", "ce", "dispatch"};
+    dprintf(fd, "NfcEventHandler lanes:\n");
+    for (int lane = LANE_RF; lane < LANE_COUNT; lane++) {
+        LaneStats& stats = laneStats_[lane];
+        std::lock_guard<std::mutex> lock(stats.mutex);
+        uint64_t avgWaitUs = (stats.handledCount == 0) ? 0 : (stats.totalWaitUs / stats.handledCount);
+        dprintf(fd, "  %s: depth %u, max depth %u, handled %" PRIu64 ", avg wait %" PRIu64 " us, "
+            "max wait %" PRIu64 " us\n", LANE_NAMES[lane], stats.depth, stats.maxDepth, stats.handledCount,
+            avgWaitUs, stats.maxWaitUs);
+    }
+}
+
 void NfcEventHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event)
+{
+    OnLaneEventHandled(LANE_RF, event);
+    HandleEvent(event);
+}
+
+void NfcEventHandler::HandleEvent(const AppExecFwk::InnerEvent::Pointer& event)
 {
     if (event == nullptr) {
         ErrorLog("event is nullptr");
@@ -516,6 +748,9 @@ void NfcEventHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event)
         case NfcCommonEvent::MSG_VENDOR_EVENT: {
             int eventType = event->GetParam();
             auto ceServicePtr = ceService_.lock();
+            if (eventType == KITS::VENDOR_APP_INIT_DONE || eventType == KITS::VENDOR_APP_CHANGE) {
+                ExternalDepsProxy::GetInstance().InvalidatePaymentCatalog();
+            }
             if ((eventType == KITS::VENDOR_APP_INIT_DONE || eventType == KITS::VENDOR_APP_CHANGE)
                 && (ceServicePtr != nullptr)) {
                 ceServicePtr->ConfigRoutingAndCommit();
@@ -15,6 +15,7 @@
 #include "nfc_service.h"
 #include <unistd.h>
 #include "app_data_parser.h"
+#include "ce_capture_ring.h"
 #include "infc_controller_callback.h"
 #include "iservice_registry.h"
 #include "loghelper.h"
@@ -172,12 +173,14 @@ void NfcService::OnTagLost(uint32_t tagDiscId)
 void NfcService::FieldActivated()
 {
     InfoLog("NfcService::FieldActivated");
+    CeCaptureRing::GetInstance().Record(CeCaptureRing::EVENT_FIELD_ON);
     eventHandler_->SendEvent(static_cast<uint32_t>(NfcCommonEvent::MSG_FIELD_ACTIVATED));
 }
 
 void NfcService::FieldDeactivated()
 {
     InfoLog("NfcService::FieldDeactivated");
+    CeCaptureRing::GetInstance().Record(CeCaptureRing::EVENT_FIELD_OFF);
     eventHandler_->SendEvent(static_cast<uint32_t>(NfcCommonEvent::MSG_FIELD_DEACTIVATED));
 }
 
@@ -232,6 +235,16 @@ void NfcService::OnCardEmulationDeactivated()
     ceService_->OnCardEmulationDeactivated();
 }
 
+void NfcService::OnEeInfoChanged()
+{
+    InfoLog("NfcService::OnEeInfoChanged");
+    if (nfcRoutingManager_ == nullptr) {
+        ErrorLog("NfcService::OnEeInfoChanged, nfcRoutingManager_ is nullptr");
+        return;
+    }
+    nfcRoutingManager_->CommitRouting();
+}
+
 int NfcService::ExecuteTask(KITS::NfcTask param)
 {
     if (nfcSwitchHandler_ == nullptr) {
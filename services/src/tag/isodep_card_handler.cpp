@@ -15,6 +15,8 @@
 
 #include "isodep_card_handler.h"
 
+#include <algorithm>
+#include <cctype>
 #include "cJSON.h"
 #include "file_ex.h"
 #include "loghelper.h"
@@ -32,7 +34,8 @@ constexpr const char* KEY_APDU_RSP_CONTAINS = "rspContains";
 
 constexpr const char* NFC_CARD_APDU_JSON_FILEPATH = "system/etc/nfc/resources/base/profile/nfc_card_apdu.json";
 constexpr const char* APDU_RSP_OK = "9000";
-constexpr const char* APDU_RSP_PREFIX = "9F0C";
+static const std::vector<uint8_t> APDU_RSP_OK_BYTES = {0x90, 0x00};
+static const std::vector<uint8_t> APDU_RSP_PREFIX_BYTES = {0x9F, 0x0C};
 
 IsodepCardHandler::IsodepCardHandler(std::weak_ptr<NCI::INciTagInterface> nciTagProxy)
     : nciTagProxy_(nciTagProxy)
@@ -53,6 +56,7 @@ void IsodepCardHandler::InitTransportCardInfo()
     }
     cardInfoVec_.clear();
     if (DoJsonRead()) {
+        BuildCheckTree();
         InfoLog("transport card info initialized.");
         isInitialized_ = true;
     }
@@ -141,6 +145,10 @@ static bool GetEachCardInfoFromJson(cJSON *json, cJSON *cardInfo,
         cJSON *rspContains = cJSON_GetObjectItemCaseSensitive(cardInfoEach, KEY_APDU_RSP_CONTAINS);
         if (rspContains == nullptr || !cJSON_IsString(rspContains)) {
             WarnLog("json param not string, or has no fild \"rspContain\", index = %{public}d", index);
+        } else if (!IsodepCardHandler::IsValidRspContain(rspContains->valuestring)) {
+            // the response is matched in bytes, an odd hex string can not be matched.
+            ErrorLog("json param \"rspContain\" not hex bytes, index = %{public}d", index);
+            return false;
         } else {
             cardInfoList[index].rspContain = rspContains->valuestring;
         }
@@ -191,20 +199,149 @@ bool IsodepCardHandler::IsSupportedTransportCard(uint32_t rfDiscId, uint8_t &car
         return false;
     }
     nciTagProxyPtr->Connect(rfDiscId, static_cast<int>(KITS::TagTechnology::NFC_ISODEP_TECH));
-    for (uint8_t index = 0; index < cardInfoVec_.size(); ++index) {
+    // the identical leading check apdus of the cards are sent once. the cards whose shared state is left by
+    // the apdus of another card replay their own check apdus from the start afterwards.
+    uint8_t matchedIndex = INVALID_CARD_INDEX;
+    std::vector<uint8_t> replayCards;
+    for (const CardCheckNode &node : checkTree_) {
+        if (node.minCardIndex >= matchedIndex) {
+            break;
+        }
+        if (!MatchCheckNode(rfDiscId, node, matchedIndex, replayCards)) {
+            WarnLog("rspApdu is empty, not continue match.");
+            return false;
+        }
+    }
+    std::sort(replayCards.begin(), replayCards.end());
+    for (uint8_t index : replayCards) {
+        if (index >= matchedIndex) {
+            break;
+        }
         std::string rspApdu = "";
         if (MatchCity(rfDiscId, index, rspApdu)) {
-            InfoLog("card match \"%{public}s\"", cardInfoVec_[index].name.c_str());
-            cardIndex = index;
-            return true;
+            matchedIndex = index;
+            break;
         }
         if (rspApdu.empty()) {
             WarnLog("rspApdu is empty, not continue match.");
             return false;
         }
     }
-    InfoLog("no matching city, ignore.");
-    return false;
+    if (matchedIndex == INVALID_CARD_INDEX) {
+        InfoLog("no matching city, ignore.");
+        return false;
+    }
+    InfoLog("card match \"%{public}s\"", cardInfoVec_[matchedIndex].name.c_str());
+    cardIndex = matchedIndex;
+    return true;
+}
+
+void IsodepCardHandler::BuildCheckTree()
+{
+    checkTree_.clear();
+    for (uint8_t index = 0; index < cardInfoVec_.size(); ++index) {
+        std::vector<uint8_t> rspContain;
+        KITS::NfcSdkCommon::HexStringToBytes(cardInfoVec_[index].rspContain, rspContain);
+        std::vector<CardCheckNode> *nodes = &checkTree_;
+        CardCheckBranch *branch = nullptr;
+        for (const std::string &checkApdu : cardInfoVec_[index].checkApdus) {
+            std::string cmdApdu = checkApdu;
+            std::transform(cmdApdu.begin(), cmdApdu.end(), cmdApdu.begin(), ::toupper);
+            auto node = std::find_if(nodes->begin(), nodes->end(),
+                [&cmdApdu](const CardCheckNode &each) { return each.cmdApdu == cmdApdu; });
+            if (node == nodes->end()) {
+                node = nodes->insert(nodes->end(), CardCheckNode {cmdApdu, index, {}});
+            }
+            auto found = std::find_if(node->branches.begin(), node->branches.end(),
+                [&rspContain](const CardCheckBranch &each) { return each.rspContain == rspContain; });
+            if (found == node->branches.end()) {
+                found = node->branches.insert(node->branches.end(),
+                    CardCheckBranch {rspContain, INVALID_CARD_INDEX, index, {}});
+            }
+            branch = &(*found);
+            nodes = &branch->children;
+        }
+        // a later card with the same check apdus and rspContains can never be matched first.
+        if (branch != nullptr && branch->cardIndex == INVALID_CARD_INDEX) {
+            branch->cardIndex = index;
+        }
+    }
+    InfoLog("check tree built, %{public}zu leading apdus for %{public}zu cards", checkTree_.size(),
+        cardInfoVec_.size());
+}
+
+bool IsodepCardHandler::MatchCheckNode(uint32_t rfDiscId, const CardCheckNode &node, uint8_t &cardIndex,
+    std::vector<uint8_t> &replayCards)
+{
+    auto nciTagProxyPtr = nciTagProxy_.lock();
+    if (nciTagProxyPtr == nullptr) {
+        WarnLog("nciTagProxy_ is nullptr.");
+        return false;
+    }
+    std::string rspApdu = "";
+    nciTagProxyPtr->Transceive(rfDiscId, node.cmdApdu, rspApdu);
+    InfoLog("rspApdu = %{public}s", rspApdu.c_str());
+    if (rspApdu.empty()) {
+        return false;
+    }
+    std::vector<unsigned char> responseBytes;
+    KITS::NfcSdkCommon::HexStringToBytes(rspApdu, responseBytes);
+    // the cards of a branch not matching the response fail on this command. the rspContains of the branches
+    // are not exclusive, once the apdus of a matching branch are sent the tag is no longer in the state after
+    // this command, so the cards of the other matching branches are replayed.
+    bool isStateLeft = false;
+    for (const CardCheckBranch &branch : node.branches) {
+        if (branch.minCardIndex >= cardIndex || !CheckApduResponse(responseBytes, branch.rspContain)) {
+            continue;
+        }
+        if (isStateLeft) {
+            CollectCards(branch, replayCards);
+            continue;
+        }
+        if (!MatchCheckBranch(rfDiscId, branch, cardIndex, replayCards, isStateLeft)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IsodepCardHandler::MatchCheckBranch(uint32_t rfDiscId, const CardCheckBranch &branch, uint8_t &cardIndex,
+    std::vector<uint8_t> &replayCards, bool &isStateLeft)
+{
+    if (branch.cardIndex < cardIndex) {
+        cardIndex = branch.cardIndex;
+    }
+    for (const CardCheckNode &child : branch.children) {
+        if (child.minCardIndex >= cardIndex) {
+            break;
+        }
+        if (isStateLeft) {
+            CollectCards(child, replayCards);
+            continue;
+        }
+        isStateLeft = true;
+        if (!MatchCheckNode(rfDiscId, child, cardIndex, replayCards)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void IsodepCardHandler::CollectCards(const CardCheckNode &node, std::vector<uint8_t> &cards)
+{
+    for (const CardCheckBranch &branch : node.branches) {
+        CollectCards(branch, cards);
+    }
+}
+
+void IsodepCardHandler::CollectCards(const CardCheckBranch &branch, std::vector<uint8_t> &cards)
+{
+    if (branch.cardIndex != INVALID_CARD_INDEX) {
+        cards.push_back(branch.cardIndex);
+    }
+    for (const CardCheckNode &child : branch.children) {
+        CollectCards(child, cards);
+    }
 }
 
 bool IsodepCardHandler::MatchCity(uint32_t rfDiscId, uint8_t cardIndex, std::string &rspApdu)
@@ -244,14 +381,36 @@ bool IsodepCardHandler::CheckApduResponse(const std::string &response, uint8_t c
         ErrorLog("invalid response length");
         return false;
     }
-    if (cardInfoVec_[cardIndex].rspContain == "") {
-        return CheckApduResponse(response);
+    std::vector<unsigned char> responseBytes;
+    std::vector<uint8_t> rspContain;
+    KITS::NfcSdkCommon::HexStringToBytes(response, responseBytes);
+    KITS::NfcSdkCommon::HexStringToBytes(cardInfoVec_[cardIndex].rspContain, rspContain);
+    return CheckApduResponse(responseBytes, rspContain);
+}
+
+bool IsodepCardHandler::CheckApduResponse(const std::vector<unsigned char> &response,
+    const std::vector<uint8_t> &rspContain)
+{
+    if (response.size() < APDU_RSP_OK_BYTES.size()) {
+        return false;
     }
-    if (response.find(APDU_RSP_PREFIX) != std::string::npos &&
-        response.find(cardInfoVec_[cardIndex].rspContain) != std::string::npos) {
-        return true;
+    if (rspContain.empty()) {
+        return std::equal(APDU_RSP_OK_BYTES.begin(), APDU_RSP_OK_BYTES.end(),
+            response.end() - APDU_RSP_OK_BYTES.size());
     }
-    return false;
+    // the bytes are matched on byte boundaries, not on any offset of the hex string.
+    return std::search(response.begin(), response.end(), APDU_RSP_PREFIX_BYTES.begin(),
+        APDU_RSP_PREFIX_BYTES.end()) != response.end() &&
+        std::search(response.begin(), response.end(), rspContain.begin(), rspContain.end()) != response.end();
+}
+
+bool IsodepCardHandler::IsValidRspContain(const std::string &rspContain)
+{
+    if (rspContain.length() % KITS::HEX_BYTE_LEN != 0) {
+        return false;
+    }
+    return std::all_of(rspContain.begin(), rspContain.end(),
+        [](unsigned char c) { return std::isxdigit(c) != 0; });
 }
 
 bool IsodepCardHandler::CheckApduResponse(const std::string &response)
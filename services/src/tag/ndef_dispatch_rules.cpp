@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ndef_dispatch_rules.h"
+
+#include <algorithm>
+#include <cctype>
+#include "loghelper.h"
+#include "nfc_bundle_mgr_client.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TAG {
+static const int32_t USER_ID = 100;
+static const int32_t GET_BUNDLE_RULES_FLAGS =
+    static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_HAP_MODULE) |
+    static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_ABILITY) |
+    static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_EXTENSION_ABILITY) |
+    static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_SKILL);
+constexpr const char* ANY_MIME_TYPE = "*/*";
+constexpr const char* ANY_TYPE = "*";
+static const std::string WILDCARD_SUBTYPE = "/*";
+static const char MIME_SEPARATOR = '/';
+
+static std::string ToLower(const std::string &str)
+{
+    std::string result = str;
+    std::transform(result.begin(), result.end(), result.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return result;
+}
+
+NdefDispatchRules &NdefDispatchRules::GetInstance()
+{
+    static NdefDispatchRules instance;
+    return instance;
+}
+
+void NdefDispatchRules::AddSkillRules(const std::vector<AppExecFwk::Skill> &skills, BundleRules &rules)
+{
+    for (const AppExecFwk::Skill &skill : skills) {
+        for (const AppExecFwk::SkillUri &skillUri : skill.uris) {
+            if (!skillUri.scheme.empty()) {
+                rules.schemes.push_back(ToLower(skillUri.scheme));
+            }
+            if (!skillUri.utd.empty()) {
+                // uniform type descriptors cover several MIME types, they match any type here.
+                rules.mimeTypes.push_back(ANY_MIME_TYPE);
+            } else if (!skillUri.type.empty()) {
+                rules.mimeTypes.push_back(ToLower(skillUri.type));
+            }
+        }
+    }
+}
+
+NdefDispatchRules::BundleRules NdefDispatchRules::BuildBundleRules(const AppExecFwk::BundleInfo &bundleInfo)
+{
+    BundleRules rules;
+    for (const AppExecFwk::HapModuleInfo &hapModuleInfo : bundleInfo.hapModuleInfos) {
+        for (const AppExecFwk::AbilityInfo &abilityInfo : hapModuleInfo.abilityInfos) {
+            AddSkillRules(abilityInfo.skills, rules);
+        }
+        // the tag dispatch also starts extension abilities, their skills match the same way.
+        for (const AppExecFwk::ExtensionAbilityInfo &extensionInfo : hapModuleInfo.extensionInfos) {
+            AddSkillRules(extensionInfo.skills, rules);
+        }
+    }
+    return rules;
+}
+
+void NdefDispatchRules::Compile()
+{
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = NfcBundleMgrClient::GetInstance().GetBundleMgrProxy();
+    if (bundleMgrProxy == nullptr) {
+        ErrorLog("NdefDispatchRules::Compile, bundleMgrProxy is nullptr");
+        return;
+    }
+    std::vector<AppExecFwk::BundleInfo> bundleInfos;
+    ErrCode errCode = bundleMgrProxy->GetBundleInfosV9(GET_BUNDLE_RULES_FLAGS, bundleInfos, USER_ID);
+    if (errCode != ERR_OK) {
+        ErrorLog("NdefDispatchRules::Compile, GetBundleInfosV9 fail, ret = %{public}d", errCode);
+        return;
+    }
+    Compile(bundleInfos);
+}
+
+void NdefDispatchRules::Compile(const std::vector<AppExecFwk::BundleInfo> &bundleInfos)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    bundleRules_.clear();
+    for (const AppExecFwk::BundleInfo &bundleInfo : bundleInfos) {
+        bundleRules_[bundleInfo.name] = BuildBundleRules(bundleInfo);
+    }
+    PublishRuleTables();
+    InfoLog("NdefDispatchRules::Compile, bundles %{public}zu", bundleRules_.size());
+}
+
+void NdefDispatchRules::UpdateBundle(const std::string &bundleName)
+{
+    if (bundleName.empty() || GetRuleTables() == nullptr) {
+        // the rules of all applications are compiled later, with the bundle in.
+        return;
+    }
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = NfcBundleMgrClient::GetInstance().GetBundleMgrProxy();
+    if (bundleMgrProxy == nullptr) {
+        ErrorLog("NdefDispatchRules::UpdateBundle, bundleMgrProxy is nullptr");
+        return;
+    }
+    AppExecFwk::BundleInfo bundleInfo;
+    ErrCode errCode = bundleMgrProxy->GetBundleInfoV9(bundleName, GET_BUNDLE_RULES_FLAGS, bundleInfo, USER_ID);
+    if (errCode != ERR_OK) {
+        WarnLog("NdefDispatchRules::UpdateBundle, %{public}s not found, ret = %{public}d", bundleName.c_str(),
+            errCode);
+        RemoveBundle(bundleName);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    bundleRules_[bundleName] = BuildBundleRules(bundleInfo);
+    PublishRuleTables();
+}
+
+void NdefDispatchRules::RemoveBundle(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (bundleRules_.erase(bundleName) > 0) {
+        PublishRuleTables();
+    }
+}
+
+void NdefDispatchRules::PublishRuleTables()
+{
+    // called with mutex_ held, the dispatching tags keep using the previous tables until they reload them.
+    auto tables = std::make_shared<RuleTables>();
+    for (const auto &[bundleName, rules] : bundleRules_) {
+        tables->bundles.insert(bundleName);
+        tables->schemes.insert(rules.schemes.begin(), rules.schemes.end());
+        for (const std::string &mimeType : rules.mimeTypes) {
+            if (mimeType == ANY_MIME_TYPE || mimeType == ANY_TYPE) {
+                tables->anyMimeType = true;
+            } else if (mimeType.size() > WILDCARD_SUBTYPE.size() &&
+                mimeType.compare(mimeType.size() - WILDCARD_SUBTYPE.size(), WILDCARD_SUBTYPE.size(),
+                    WILDCARD_SUBTYPE) == 0) {
+                tables->mimeWildcards.insert(mimeType.substr(0, mimeType.size() - WILDCARD_SUBTYPE.size()));
+            } else {
+                tables->mimeTypes.insert(mimeType);
+            }
+        }
+    }
+    std::shared_ptr<const RuleTables> newTables = tables;
+    std::atomic_store_explicit(&ruleTables_, newTables, std::memory_order_release);
+}
+
+std::shared_ptr<const NdefDispatchRules::RuleTables> NdefDispatchRules::GetRuleTables() const
+{
+    return std::atomic_load_explicit(&ruleTables_, std::memory_order_acquire);
+}
+
+NdefDispatchRules::MatchResult NdefDispatchRules::MatchBundle(const std::string &bundleName) const
+{
+    std::shared_ptr<const RuleTables> tables = GetRuleTables();
+    if (tables == nullptr) {
+        return RULES_NOT_COMPILED;
+    }
+    return (tables->bundles.count(bundleName) > 0) ? RULES_MATCHED : RULES_NOT_MATCHED;
+}
+
+NdefDispatchRules::MatchResult NdefDispatchRules::MatchMimeType(const std::string &mimeType) const
+{
+    std::shared_ptr<const RuleTables> tables = GetRuleTables();
+    if (tables == nullptr) {
+        return RULES_NOT_COMPILED;
+    }
+    std::string type = ToLower(mimeType);
+    if (tables->anyMimeType || tables->mimeTypes.count(type) > 0 || type.find('*') != std::string::npos) {
+        return RULES_MATCHED;
+    }
+    size_t pos = type.find(MIME_SEPARATOR);
+    if (pos != std::string::npos && tables->mimeWildcards.count(type.substr(0, pos)) > 0) {
+        return RULES_MATCHED;
+    }
+    return RULES_NOT_MATCHED;
+}
+
+NdefDispatchRules::MatchResult NdefDispatchRules::MatchUriScheme(const std::string &scheme) const
+{
+    std::shared_ptr<const RuleTables> tables = GetRuleTables();
+    if (tables == nullptr) {
+        return RULES_NOT_COMPILED;
+    }
+    return (tables->schemes.count(ToLower(scheme)) > 0) ? RULES_MATCHED : RULES_NOT_MATCHED;
+}
+} // namespace TAG
+} // namespace NFC
+} // namespace OHOS
@@ -14,6 +14,7 @@
  */
 #include "ndef_har_data_parser.h"
 
+#include "ndef_dispatch_rules.h"
 #include "ndef_har_dispatch.h"
 #include "nfc_sdk_common.h"
 #include "ndef_record_parser.h"
@@ -102,14 +103,17 @@ uint16_t NdefHarDataParser::TryNdef(const std::string& msg, const std::shared_pt
 uint16_t NdefHarDataParser::DispatchValidNdef(
     const std::vector<std::shared_ptr<NdefRecord>> &records, const std::shared_ptr<KITS::TagInfo> &tagInfo)
 {
-    ParseMimeTypeAndStr(records);
+    // walk the records once, the stages below only read the parsed properties and the compiled rules.
+    std::vector<std::string> harPackages;
+    ParseRecords(records, harPackages);
+    ParseRecordsProperty(records);
     // handle OpenHarmony Application bundle name
-    uint16_t dispatchRes = DispatchByHarBundleName(records, tagInfo);
+    uint16_t dispatchRes = DispatchByHarBundleName(harPackages, tagInfo);
     if (dispatchRes != DISPATCH_UNKNOWN) {
         InfoLog("DispatchByHarBundleName succ");
         return dispatchRes;
     }
-    ParseRecordsProperty(records);
+    recordUriInfo_ = uriAddress_;
     // handle uri start with HTTP or other type
     dispatchRes = DispatchByAppLinkMode(tagInfo);
     if (dispatchRes != DISPATCH_UNKNOWN) {
@@ -159,14 +163,14 @@ void NdefHarDataParser::ClearNdefDispatchParam()
     if (uriSchemeValue_.size() > 0) {
         uriSchemeValue_.clear();
     }
+    uriScheme_.clear();
     schemeType_ = {RecordsType::TYPE_RTP_UNKNOWN};
 }
 
 uint16_t NdefHarDataParser::DispatchByHarBundleName(
-    const std::vector<std::shared_ptr<NdefRecord>> &records, const std::shared_ptr<KITS::TagInfo> &tagInfo)
+    std::vector<std::string> &harPackages, const std::shared_ptr<KITS::TagInfo> &tagInfo)
 {
     InfoLog("enter");
-    std::vector<std::string> harPackages = NdefRecordParser::ExtractHarPackages(records);
     if (harPackages.size() > 0) {
         std::string mimeTypeStr = "";
         if (mimeTypeVec_.size() > 0) {
@@ -176,7 +180,7 @@ uint16_t NdefHarDataParser::DispatchByHarBundleName(
             ErrorLog("mimeType too long");
             mimeTypeStr = "";
         }
-        std::string uri = NdefRecordParser::GetUriPayload(records[0]);
+        std::string uri = uriAddress_;
         if (uri.size() > URI_MAX_LENGTH) {
             ErrorLog("uri too long");
             uri = "";
@@ -249,10 +253,10 @@ void NdefHarDataParser::ParseRecordsProperty(const std::vector<std::shared_ptr<N
         return;
     }
     uriAddress_ = NdefRecordParser::GetUriPayload(records[0]);
-    recordUriInfo_ = uriAddress_;
     InfoLog("uri %{public}s", NfcSdkCommon::CodeMiddlePart(uriAddress_).c_str());
     Uri ndefUri(uriAddress_);
     std::string scheme = ndefUri.GetScheme();
+    uriScheme_ = scheme;
     if (scheme.empty()) {
         schemeType_ = TYPE_RTP_UNKNOWN;
     } else if (scheme == TEL_PREFIX) {
@@ -274,6 +278,11 @@ void NdefHarDataParser::ParseRecordsProperty(const std::vector<std::shared_ptr<N
 uint16_t NdefHarDataParser::DispatchByAppLinkMode(const std::shared_ptr<KITS::TagInfo> &tagInfo)
 {
     InfoLog("enter");
+    if (schemeType_ == TYPE_RTP_SCHEME_OTHER &&
+        NdefDispatchRules::GetInstance().MatchUriScheme(uriScheme_) == NdefDispatchRules::RULES_NOT_MATCHED) {
+        InfoLog("no application declares the uri scheme");
+        return DISPATCH_UNKNOWN;
+    }
     if (schemeType_ == TYPE_RTP_SCHEME_HTTP_WEB_URL || schemeType_ == TYPE_RTP_SCHEME_OTHER) {
         auto nfcServicePtr = nfcService_.lock();
         if (nfcServicePtr == nullptr) {
@@ -322,7 +331,11 @@ uint16_t NdefHarDataParser::DispatchText(const std::shared_ptr<KITS::TagInfo> &t
         auto tagProxy = nciTagProxy_.lock();
         if (tagProxy && mimeType == TYPE_RTP_MIME_TEXT_PLAIN) {
             std::string notePadBundleName = tagProxy->GetVendorInfo(VendorInfoType::HAP_NAME_NOTEPAD);
-            if (ExternalDepsProxy::GetInstance().IsBundleInstalled(notePadBundleName)) {
+            NdefDispatchRules::MatchResult match = NdefDispatchRules::GetInstance().MatchBundle(notePadBundleName);
+            bool isInstalled = (match == NdefDispatchRules::RULES_NOT_COMPILED) ?
+                ExternalDepsProxy::GetInstance().IsBundleInstalled(notePadBundleName) :
+                (match == NdefDispatchRules::RULES_MATCHED);
+            if (isInstalled) {
                 ExternalDepsProxy::GetInstance().PublishNfcNotification(NFC_TEXT_NOTIFICATION_ID, "", 0);
             } else {
                 ExternalDepsProxy::GetInstance().PublishNfcNotification(NFC_NO_HAP_SUPPORTED_NOTIFICATION_ID, "", 0);
@@ -357,8 +370,9 @@ uint16_t NdefHarDataParser::DispatchMimeToBundleAbility(const std::shared_ptr<KI
     return DISPATCH_UNKNOWN;
 }
 
-/* get mimetype and mime string */
-void NdefHarDataParser::ParseMimeTypeAndStr(const std::vector<std::shared_ptr<NdefRecord>> &records)
+/* get mimetype, mime string and OpenHarmony Application bundle name of every record */
+void NdefHarDataParser::ParseRecords(
+    const std::vector<std::shared_ptr<NdefRecord>> &records, std::vector<std::string> &harPackages)
 {
     InfoLog("enter");
     if (records.size() == 0 || records[0] == nullptr) {
@@ -372,6 +386,10 @@ void NdefHarDataParser::ParseMimeTypeAndStr(const std::vector<std::shared_ptr<Nd
             mimeTypeVec_.push_back(std::make_pair(TYPE_RTP_UNKNOWN, ""));
             continue;
         }
+        std::string harPackage = NdefRecordParser::CheckForHar(records[i]);
+        if (!harPackage.empty()) {
+            harPackages.push_back(harPackage);
+        }
         RecordsType mimeType;
         std::string mimeTypeStr;
         InfoLog("record.tnf_: %{public}d", records[i]->tnf_);
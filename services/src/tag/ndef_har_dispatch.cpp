@@ -15,13 +15,12 @@
 #include "ndef_har_dispatch.h"
 
 #include "external_deps_proxy.h"
-#include "iservice_registry.h"
+#include "ndef_dispatch_rules.h"
 #include "ndef_har_data_parser.h"
+#include "nfc_bundle_mgr_client.h"
 #include "tag_ability_dispatcher.h"
 #include "ability_manager_client.h"
 #include "loghelper.h"
-#include "bundle_mgr_interface.h"
-#include "if_system_ability_manager.h"
 #ifdef NFC_HANDLE_SCREEN_LOCK
 #include "external_deps_proxy.h"
 #include "screenlock_common.h"
@@ -32,7 +31,6 @@ namespace OHOS {
 namespace NFC {
 namespace TAG {
 const int USER_ID = 100;
-const int BUNDLE_MGR_SERVICE_SYS_ABILITY_ID = 401;
 using namespace OHOS::NFC::KITS;
 #ifdef NFC_HANDLE_SCREEN_LOCK
 AAFwk::Want g_carrierWant;
@@ -61,18 +59,7 @@ NdefHarDispatch::NdefHarDispatch(std::weak_ptr<NCI::INciNfccInterface> nciNfccPr
 
 sptr<AppExecFwk::IBundleMgr> NdefHarDispatch::GetBundleMgrProxy()
 {
-    sptr<ISystemAbilityManager> systemAbilityManager =
-        SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (!systemAbilityManager) {
-        ErrorLog("GetBundleMgrProxy, systemAbilityManager is null");
-        return nullptr;
-    }
-    sptr<IRemoteObject> remoteObject = systemAbilityManager->GetSystemAbility(BUNDLE_MGR_SERVICE_SYS_ABILITY_ID);
-    if (!remoteObject) {
-        ErrorLog("GetBundleMgrProxy, remoteObject is null");
-        return nullptr;
-    }
-    return iface_cast<AppExecFwk::IBundleMgr>(remoteObject);
+    return NfcBundleMgrClient::GetInstance().GetBundleMgrProxy();
 }
 
 /* Implicit matching, using mimetype to pull up app */
@@ -82,22 +69,16 @@ uint16_t NdefHarDispatch::DispatchMimeType(const std::string &type, const std::s
         ErrorLog("NdefHarDispatch::DispatchMimeType type is empty");
         return DISPATCH_UNKNOWN;
     }
+    NdefDispatchRules::MatchResult match = NdefDispatchRules::GetInstance().MatchMimeType(type);
+    if (match == NdefDispatchRules::RULES_NOT_MATCHED) {
+        InfoLog("NdefHarDispatch::DispatchMimeType no application declares the type");
+        return DISPATCH_UNKNOWN;
+    }
     AAFwk::Want want;
     want.SetType(type);
     ExternalDepsProxy::GetInstance().SetWantExtraParam(tagInfo, want);
-    if (GetBundleMgrProxy() == nullptr) {
-        ErrorLog("NdefHarDispatch::DispatchMimeType GetBundleMgrProxy is nullptr");
-        return DISPATCH_UNKNOWN;
-    }
-    bool withDefault = false;
-    auto abilityInfoFlag = AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_DEFAULT
-        | AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_SKILL_URI
-        | AppExecFwk::AbilityInfoFlag::GET_ABILITY_INFO_WITH_METADATA;
-    std::vector<AbilityInfo> abilityInfos;
-    std::vector<ExtensionAbilityInfo> extensionInfos;
-    bool findDefaultApp = false;
-    if (!GetBundleMgrProxy()->ImplicitQueryInfos(
-        want, abilityInfoFlag, USER_ID, withDefault, abilityInfos, extensionInfos, findDefaultApp)) {
+    if (match == NdefDispatchRules::RULES_NOT_COMPILED &&
+        !NfcBundleMgrClient::GetInstance().ImplicitQueryInfos(want, USER_ID)) {
         ErrorLog("NdefHarDispatch::DispatchMimeType ImplicitQueryInfos false");
         return DISPATCH_UNKNOWN;
     }
@@ -153,12 +134,13 @@ bool NdefHarDispatch::DispatchBundleAbility(const std::string &harPackage,
         return false;
     }
     std::string harPackageString = NfcSdkCommon::HexStringToAsciiString(harPackage);
-    AAFwk::Want want;
-    if (GetBundleMgrProxy() == nullptr) {
-        ErrorLog("GetBundleMgrProxy is nullptr");
+    std::string bundleName = harPackageString.substr(0, harPackageString.find('/'));
+    if (NdefDispatchRules::GetInstance().MatchBundle(bundleName) == NdefDispatchRules::RULES_NOT_MATCHED) {
+        InfoLog("harPackage = %{public}s is not installed", harPackageString.c_str());
         return false;
     }
-    int32_t errCode = GetBundleMgrProxy()->GetLaunchWantForBundle(harPackageString, want, USER_ID);
+    AAFwk::Want want;
+    int32_t errCode = NfcBundleMgrClient::GetInstance().GetLaunchWantForBundle(harPackageString, USER_ID, want);
     if (errCode) {
         InfoLog("GetLaunchWantForBundle fail. ret = %{public}d, harPackage = %{public}s, try ExtensionAbility instead",
             errCode, harPackageString.c_str());
@@ -249,11 +231,12 @@ bool NdefHarDispatch::DispatchUriToBundleAbility(const std::string &uri)
         return false;
     }
     bool canOpen = false;
-    if (GetBundleMgrProxy() == nullptr) {
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = GetBundleMgrProxy();
+    if (bundleMgrProxy == nullptr) {
         ErrorLog("NdefHarDispatch::DispatchUriToBundleAbility GetBundleMgrProxy is nullptr");
         return false;
     }
-    int32_t errCode = GetBundleMgrProxy()->CanOpenLink(uri, canOpen);
+    int32_t errCode = bundleMgrProxy->CanOpenLink(uri, canOpen);
     if (!errCode && canOpen) {
         InfoLog("NdefHarDispatch::DispatchUriToBundleAbility CanOpenLink");
     }
@@ -14,6 +14,7 @@
  */
 #include "tag_dispatcher.h"
 
+#include <algorithm>
 #include <functional>
 
 #include "app_data_parser.h"
@@ -166,35 +167,130 @@ void TagDispatcher::HandleTagFound(uint32_t tagDiscId)
         ErrorLog("nciTagProxy_ is nullptr");
         return;
     }
-    long tagFoundTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
+    TagFoundStages stages;
+    stages.startTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
     ndefCbRes_ = false;
     isIsoDep_ = false;
     if (static_cast<int>(nciTagProxyPtr->GetConnectedTech(tagDiscId)) ==
         static_cast<int>(TagTechnology::NFC_ISODEP_TECH)) {
         isIsoDep_ = true;
     }
+    stages.techFinishTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
+    if (IsLowLatencyReaderMode()) {
+        HandleLowLatencyTagFound(tagDiscId, stages);
+        return;
+    }
+    // the apps by tech do not depend on the ndef message, resolve them on the dispatch lane during the rf read.
+    PrefetchTagApps(nciTagProxyPtr->GetTechList(tagDiscId));
     std::string ndefMsg = nciTagProxyPtr->FindNdefTech(tagDiscId);
-    long readFinishTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
+    stages.readFinishTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
     std::shared_ptr<KITS::NdefMessage> ndefMessage = KITS::NdefMessage::GetNdefMessage(ndefMsg);
-    KITS::TagInfoParcelable* tagInfo = nullptr;
     bool isNtfPublished = false;
-    uint16_t dispatchResult = HandleTagDispatch(ndefMsg, ndefMessage, tagInfo, tagDiscId, isNtfPublished);
-    if (tagInfo != nullptr) {
-        delete tagInfo;
-        tagInfo = nullptr;
-    }
-    long dispatchFinishTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
-    SendTagInfoToVendor(tagFoundTime, readFinishTime, dispatchFinishTime, ndefMessage, dispatchResult);
+    uint16_t dispatchResult = HandleTagDispatch(ndefMsg, ndefMessage, tagDiscId, isNtfPublished, stages);
+    stages.dispatchFinishTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
+    SendTagInfoToVendor(stages, ndefMessage, dispatchResult);
     NdefHarDataParser::GetInstance().ClearRecord0Uri();
+    tagAppsPrefetch_ = nullptr;
 
+    bool isVibratorAllowed = false;
 #ifndef NFC_VIBRATOR_DISABLED
-    if (IsAllowedVibrator(dispatchResult)) {
-        StartVibratorOnce(isNtfPublished);
-    }
+    isVibratorAllowed = IsAllowedVibrator(dispatchResult) && !ndefCbRes_;
 #endif
     // Record types of read tags.
     std::vector<int> techList = nciTagProxyPtr->GetTechList(tagDiscId);
-    ExternalDepsProxy::GetInstance().WriteTagFoundHiSysEvent(techList);
+    RunTagFoundTail(isVibratorAllowed, isNtfPublished, std::move(techList));
+}
+
+void TagDispatcher::HandleLowLatencyTagFound(uint32_t tagDiscId, TagFoundStages &stages)
+{
+    // no ndef detection, read or system dispatch, the reader app gets the tag as soon as it is activated.
+    lastNdefMsg_ = "";
+    stages.readFinishTime = stages.techFinishTime;
+    StartFieldOnChecking(tagDiscId);
+    std::unique_ptr<KITS::TagInfoParcelable> tagInfo(GetTagInfoParcelableFromTag(tagDiscId));
+    stages.tagInfoFinishTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
+    auto pollingMgr = nfcService_->GetNfcPollingManager().lock();
+    if (pollingMgr != nullptr && tagInfo != nullptr) {
+        pollingMgr->SendTagToReaderApp(tagInfo.get());
+    }
+    stages.dispatchFinishTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
+    SendTagInfoToVendor(stages, nullptr, DISPATCH_READERMODE);
+
+    bool isVibratorAllowed = false;
+#ifndef NFC_VIBRATOR_DISABLED
+    isVibratorAllowed = IsAllowedVibrator(DISPATCH_READERMODE);
+#endif
+    auto nciTagProxyPtr = nciTagProxy_.lock();
+    std::vector<int> techList;
+    if (nciTagProxyPtr != nullptr) {
+        techList = nciTagProxyPtr->GetTechList(tagDiscId);
+    }
+    RunTagFoundTail(isVibratorAllowed, false, std::move(techList));
+}
+
+bool TagDispatcher::RunTagFoundTail(bool isVibratorAllowed, bool isNtfPublished, std::vector<int> techList)
+{
+    // the vibrator and hisysevent ipc do not change the dispatch result, they are posted to the dispatch lane
+    // of the event handler, which runs them in the order of the tags.
+    auto tail = [isVibratorAllowed, isNtfPublished, techList]() {
+        if (isVibratorAllowed) {
+            ExternalDepsProxy::GetInstance().StartVibratorOnce(isNtfPublished);
+        }
+        ExternalDepsProxy::GetInstance().WriteTagFoundHiSysEvent(techList);
+    };
+    if (nfcService_ != nullptr && nfcService_->eventHandler_ != nullptr &&
+        nfcService_->eventHandler_->PostDispatchTask(tail)) {
+        return true;
+    }
+    tail();
+    return false;
+}
+
+bool TagDispatcher::PrefetchTagApps(const std::vector<int> &techList)
+{
+    tagAppsPrefetch_ = nullptr;
+    if (nfcService_ == nullptr || nfcService_->eventHandler_ == nullptr) {
+        // no lane to overlap with, the apps are resolved after the read.
+        return false;
+    }
+    auto prefetch = std::make_shared<TagAppsPrefetch>();
+    prefetch->techList = techList;
+    auto lookup = [prefetch]() {
+        prefetch->apps = ExternalDepsProxy::GetInstance().GetDispatchTagAppsByTech(prefetch->techList);
+        prefetch->isDone.store(true, std::memory_order_release);
+    };
+    if (!nfcService_->eventHandler_->PostDispatchTask(lookup)) {
+        return false;
+    }
+    tagAppsPrefetch_ = prefetch;
+    return true;
+}
+
+std::vector<ElementName> TagDispatcher::GetTagApps(const std::vector<int> &techList, bool &isPrefetched)
+{
+    // the ndef read only appends techs, the apps of the appended techs come after the prefetched apps, as they
+    // do in a lookup by the whole list. the prefetch still queued behind a tail is not waited for.
+    std::shared_ptr<TagAppsPrefetch> prefetch = tagAppsPrefetch_;
+    isPrefetched = prefetch != nullptr && prefetch->isDone.load(std::memory_order_acquire) &&
+        prefetch->techList.size() <= techList.size() &&
+        std::equal(prefetch->techList.begin(), prefetch->techList.end(), techList.begin());
+    if (!isPrefetched) {
+        return ExternalDepsProxy::GetInstance().GetDispatchTagAppsByTech(techList);
+    }
+    std::vector<ElementName> apps = prefetch->apps;
+    std::vector<int> appendedTechs(techList.begin() + prefetch->techList.size(), techList.end());
+    if (appendedTechs.empty()) {
+        return apps;
+    }
+    for (const ElementName &app : ExternalDepsProxy::GetInstance().GetDispatchTagAppsByTech(appendedTechs)) {
+        bool isExisted = std::any_of(apps.begin(), apps.end(), [&app](const ElementName &item) {
+            return item.GetBundleName() == app.GetBundleName();
+        });
+        if (!isExisted) {
+            apps.push_back(app);
+        }
+    }
+    return apps;
 }
 
 bool TagDispatcher::IsAllowedVibrator(uint16_t dispatchResult)
@@ -209,7 +305,7 @@ bool TagDispatcher::IsAllowedVibrator(uint16_t dispatchResult)
 }
 
 uint16_t TagDispatcher::HandleTagDispatch(std::string &ndefMsg, std::shared_ptr<KITS::NdefMessage> ndefMessage,
-    KITS::TagInfoParcelable* tagInfo, uint32_t tagDiscId, bool &isNtfPublished)
+    uint32_t tagDiscId, bool &isNtfPublished, TagFoundStages &stages)
 {
     auto nciTagProxyPtr = nciTagProxy_.lock();
     if (nfcService_ == nullptr || nciTagProxyPtr == nullptr) {
@@ -226,20 +322,19 @@ uint16_t TagDispatcher::HandleTagDispatch(std::string &ndefMsg, std::shared_ptr<
         }
     }
     lastNdefMsg_ = ndefMsg;
-    int fieldOnCheckInterval = GetFieldOnCheckInterval();
-    InfoLog("fieldOnCheckInterval = %{public}d", fieldOnCheckInterval);
-    nciTagProxyPtr->StartFieldOnChecking(tagDiscId, fieldOnCheckInterval);
-    tagInfo = GetTagInfoParcelableFromTag(tagDiscId);
+    StartFieldOnChecking(tagDiscId);
+    std::unique_ptr<KITS::TagInfoParcelable> tagInfo(GetTagInfoParcelableFromTag(tagDiscId));
     if (tagInfo == nullptr) {
         ErrorLog("GetTagInfoParcelableFromTag tagInfo is nullptr");
     }
+    stages.tagInfoFinishTime = static_cast<long>(KITS::NfcSdkCommon::GetCurrentTime());
     auto pollingMgr = nfcService_->GetNfcPollingManager().lock();
     if (pollingMgr != nullptr && pollingMgr->IsReaderModeEnabled()) {
-        pollingMgr->SendTagToReaderApp(tagInfo);
+        pollingMgr->SendTagToReaderApp(tagInfo.get());
         return DISPATCH_READERMODE;
     }
     if (pollingMgr != nullptr && pollingMgr->IsForegroundEnabled()) {
-        pollingMgr->SendTagToForeground(tagInfo);
+        pollingMgr->SendTagToForeground(tagInfo.get());
         return DISPATCH_FOREGROUND;
     }
     ExternalDepsProxy::GetInstance().RegNotificationCallback(nfcService_);
@@ -248,24 +343,65 @@ uint16_t TagDispatcher::HandleTagDispatch(std::string &ndefMsg, std::shared_ptr<
         return dispatchResult;
     }
     isNtfPublished = true;
-    return PublishTagNotification(tagDiscId, isIsoDep_);
+    uint16_t notificationResult = PublishTagNotification(tagDiscId, isIsoDep_);
+    tagApps_.clear();
+    if (tagInfo_ != nullptr) {
+        tagApps_ = GetTagApps(tagInfo_->GetTagTechList(), stages.isAppsPrefetched);
+    }
+    return notificationResult;
 }
 
-bool TagDispatcher::IsSkipNdefCheck()
+uint16_t TagDispatcher::GetReaderModeTechMask()
 {
     if (nfcService_ == nullptr) {
         ErrorLog("nfcService_ is nullptr");
-        return false;
+        return 0;
     }
     auto pollingMgr = nfcService_->GetNfcPollingManager().lock();
     if (pollingMgr != nullptr) {
         std::shared_ptr<NfcPollingParams> newParams = pollingMgr->GetPollingParameters();
-        if (newParams != nullptr) {
-            InfoLog("IsSkipNdefCheck techmask = %{public}d", newParams->GetTechMask());
-            return (newParams->GetTechMask() & SKIP_NDEF_CHECK_TECH_MASK) != 0;
+        if (newParams != nullptr && newParams->ShouldEnableReaderMode()) {
+            InfoLog("reader mode techmask = %{public}d", newParams->GetTechMask());
+            return newParams->GetTechMask();
         }
     }
-    return false;
+    return 0;
+}
+
+bool TagDispatcher::IsSkipNdefCheck()
+{
+    return (GetReaderModeTechMask() & SKIP_NDEF_CHECK_TECH_MASK) != 0;
+}
+
+bool TagDispatcher::IsReaderModeFlagSet(uint16_t flagMask)
+{
+    // the flags only apply while the tag goes to the reader app, not to the system dispatch.
+    if ((GetReaderModeTechMask() & flagMask) == 0) {
+        return false;
+    }
+    auto pollingMgr = nfcService_->GetNfcPollingManager().lock();
+    return pollingMgr != nullptr && pollingMgr->IsReaderModeEnabled();
+}
+
+bool TagDispatcher::IsLowLatencyReaderMode()
+{
+    return IsReaderModeFlagSet(LOW_LATENCY_READER_TECH_MASK);
+}
+
+void TagDispatcher::StartFieldOnChecking(uint32_t tagDiscId)
+{
+    auto nciTagProxyPtr = nciTagProxy_.lock();
+    if (nciTagProxyPtr == nullptr) {
+        ErrorLog("nciTagProxy_ is nullptr");
+        return;
+    }
+    if (IsReaderModeFlagSet(SKIP_PRESENCE_CHECK_TECH_MASK)) {
+        InfoLog("presence check skipped by the reader app");
+        return;
+    }
+    int fieldOnCheckInterval = GetFieldOnCheckInterval();
+    InfoLog("fieldOnCheckInterval = %{public}d", fieldOnCheckInterval);
+    nciTagProxyPtr->StartFieldOnChecking(tagDiscId, fieldOnCheckInterval);
 }
 
 int TagDispatcher::GetFieldOnCheckInterval()
@@ -307,8 +443,13 @@ std::string TagDispatcher::ParseNdefInfo(std::shared_ptr<KITS::NdefMessage> ndef
     return ndefInfo;
 }
 
-void TagDispatcher::SendTagInfoToVendor(long tagFoundStartTime, long readFinishTime, long dispatchFinishTime,
-    std::shared_ptr<KITS::NdefMessage> ndefMessage, uint16_t dispatchResult)
+static long GetStageCost(long stageStartTime, long stageFinishTime)
+{
+    return (stageFinishTime >= stageStartTime && stageStartTime > 0) ? (stageFinishTime - stageStartTime) : 0;
+}
+
+void TagDispatcher::SendTagInfoToVendor(const TagFoundStages &stages, std::shared_ptr<KITS::NdefMessage> ndefMessage,
+    uint16_t dispatchResult)
 {
     std::string ndefInfo = ParseNdefInfo(ndefMessage);
     if (nfcService_ == nullptr) {
@@ -316,9 +457,17 @@ void TagDispatcher::SendTagInfoToVendor(long tagFoundStartTime, long readFinishT
         return;
     }
     nfcService_->NotifyMessageToVendor(KITS::NOTIFY_NDEF_INFO_EVENT, ndefInfo);
-    std::string readTagInfo = "startTime:" + std::to_string(tagFoundStartTime) + "|readFinishTime:" +
-        std::to_string(readFinishTime) + "|dispatchTime:" + std::to_string(dispatchFinishTime) + "|dispatchResult:" +
-        std::to_string(dispatchResult);
+    std::string readTagInfo = "startTime:" + std::to_string(stages.startTime) + "|readFinishTime:" +
+        std::to_string(stages.readFinishTime) + "|dispatchTime:" + std::to_string(stages.dispatchFinishTime) +
+        "|dispatchResult:" + std::to_string(dispatchResult);
+    // cost of each stage in ms, the tag info stage is 0 when the dispatch stops before it.
+    long tagInfoCost = GetStageCost(stages.readFinishTime, stages.tagInfoFinishTime);
+    long dispatchStartTime = (stages.tagInfoFinishTime > 0) ? stages.tagInfoFinishTime : stages.readFinishTime;
+    readTagInfo = readTagInfo + "|techCost:" + std::to_string(GetStageCost(stages.startTime, stages.techFinishTime)) +
+        "|ndefReadCost:" + std::to_string(GetStageCost(stages.techFinishTime, stages.readFinishTime)) +
+        "|tagInfoCost:" + std::to_string(tagInfoCost) +
+        "|dispatchCost:" + std::to_string(GetStageCost(dispatchStartTime, stages.dispatchFinishTime)) +
+        "|appsPrefetched:" + std::to_string(stages.isAppsPrefetched ? 1 : 0);
     auto pollingMgr = nfcService_->GetNfcPollingManager().lock();
     if (dispatchResult == DISPATCH_FOREGROUND && pollingMgr) {
         std::shared_ptr<NfcPollingManager::ForegroundRegistryData> foregroundData = pollingMgr->GetForegroundData();
@@ -337,12 +486,6 @@ void TagDispatcher::SendTagInfoToVendor(long tagFoundStartTime, long readFinishT
     nfcService_->NotifyMessageToVendor(KITS::NOTIFY_READ_TAG_EVENT, readTagInfo);
 }
 
-void TagDispatcher::StartVibratorOnce(bool isNtfPublished)
-{
-    if (!ndefCbRes_) {
-        ExternalDepsProxy::GetInstance().StartVibratorOnce(isNtfPublished);
-    }
-}
 void TagDispatcher::HandleTagLost(uint32_t tagDiscId)
 {
     InfoLog("HandleTagLost, tagDiscId: %{public}d", tagDiscId);
@@ -357,7 +500,7 @@ std::shared_ptr<KITS::TagInfo> TagDispatcher::GetTagInfoFromTag(uint32_t tagDisc
     }
     std::vector<int> techList = nciTagProxyPtr->GetTechList(tagDiscId);
     std::string tagUid = nciTagProxyPtr->GetTagUid(tagDiscId);
-    std::vector<AppExecFwk::PacMap> tagTechExtras = nciTagProxyPtr->GetTechExtrasData(tagDiscId);
+    std::vector<KITS::TagTechExtras> tagTechExtras = nciTagProxyPtr->GetTechExtras(tagDiscId);
     DebugLog("GetTagInfoFromTag: tag uid = %{public}s, techListLen = %{public}zu, extrasLen = %{public}zu,"
         "rfID = %{public}d", KITS::NfcSdkCommon::CodeMiddlePart(tagUid).c_str(),
         techList.size(), tagTechExtras.size(), tagDiscId);
@@ -374,7 +517,7 @@ KITS::TagInfoParcelable* TagDispatcher::GetTagInfoParcelableFromTag(uint32_t tag
     }
     std::vector<int> techList = nciTagProxyPtr->GetTechList(tagDiscId);
     std::string tagUid = nciTagProxyPtr->GetTagUid(tagDiscId);
-    std::vector<AppExecFwk::PacMap> tagTechExtras = nciTagProxyPtr->GetTechExtrasData(tagDiscId);
+    std::vector<KITS::TagTechExtras> tagTechExtras = nciTagProxyPtr->GetTechExtras(tagDiscId);
     DebugLog("GetTagInfoParcelableFromTag: tag uid = %{public}s, techListLen = %{public}zu, extrasLen = %{public}zu,"
         "rfID = %{public}d", KITS::NfcSdkCommon::CodeMiddlePart(tagUid).c_str(),
         techList.size(), tagTechExtras.size(), tagDiscId);
@@ -397,7 +540,8 @@ void TagDispatcher::OnNotificationButtonClicked(int notificationId)
         case NFC_TRANSPORT_CARD_NOTIFICATION_ID: {
             // start application ability for tag found.
             if (nfcService_) {
-                ExternalDepsProxy::GetInstance().DispatchTagAbility(tagInfo_, nfcService_->GetTagServiceIface());
+                ExternalDepsProxy::GetInstance().DispatchTagAbility(tagInfo_, nfcService_->GetTagServiceIface(),
+                    tagApps_);
                 nfcService_->NotifyMessageToVendor(KITS::TAG_DISPATCH_KEY, "");
             }
             break;
@@ -421,7 +565,8 @@ void TagDispatcher::OnNotificationButtonClicked(int notificationId)
         case NFC_TAG_DEFAULT_NOTIFICATION_ID:
             // start application ability for tag found.
             if (nfcService_) {
-                ExternalDepsProxy::GetInstance().DispatchTagAbility(tagInfo_, nfcService_->GetTagServiceIface());
+                ExternalDepsProxy::GetInstance().DispatchTagAbility(tagInfo_, nfcService_->GetTagServiceIface(),
+                    tagApps_);
                 nfcService_->NotifyMessageToVendor(KITS::TAG_DISPATCH_KEY, "");
             }
             break;
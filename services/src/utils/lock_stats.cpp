@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "lock_stats.h"
+
+#include <cstdio>
+
+namespace OHOS {
+namespace NFC {
+LockStats::LockStats(const char* name) : name_(name)
+{
+}
+
+size_t LockStats::GetBucket(uint64_t timeUs)
+{
+    for (size_t i = 0; i < BUCKET_LIMITS_US.size(); i++) {
+        if (timeUs < BUCKET_LIMITS_US[i]) {
+            return i;
+        }
+    }
+    return BUCKET_COUNT - 1;
+}
+
+void LockStats::UpdateMax(std::atomic<uint64_t>& max, uint64_t value)
+{
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void LockStats::Record(bool isContended, uint64_t waitUs, uint64_t holdUs)
+{
+    acquireCount_.fetch_add(1, std::memory_order_relaxed);
+    if (isContended) {
+        contendedCount_.fetch_add(1, std::memory_order_relaxed);
+        waitBuckets_[GetBucket(waitUs)].fetch_add(1, std::memory_order_relaxed);
+        UpdateMax(maxWaitUs_, waitUs);
+    }
+    holdBuckets_[GetBucket(holdUs)].fetch_add(1, std::memory_order_relaxed);
+    UpdateMax(maxHoldUs_, holdUs);
+}
+
+uint64_t LockStats::GetAcquireCount() const
+{
+    return acquireCount_.load(std::memory_order_relaxed);
+}
+
+uint64_t LockStats::GetContendedCount() const
+{
+    return contendedCount_.load(std::memory_order_relaxed);
+}
+
+void LockStats::Dump(int fd) const
+{
+    dprintf(fd, "  %s: acquired %llu, contended %llu, max wait %llu us, max hold %llu us\n", name_,
+        static_cast<unsigned long long>(GetAcquireCount()), static_cast<unsigned long long>(GetContendedCount()),
+        static_cast<unsigned long long>(maxWaitUs_.load(std::memory_order_relaxed)),
+        static_cast<unsigned long long>(maxHoldUs_.load(std::memory_order_relaxed)));
+    dprintf(fd, "    bucket(us)  <10  <100  <1000  <10000  <100000  more\n");
+    dprintf(fd, "    wait");
+    for (const auto& count : waitBuckets_) {
+        dprintf(fd, " %llu", static_cast<unsigned long long>(count.load(std::memory_order_relaxed)));
+    }
+    dprintf(fd, "\n    hold");
+    for (const auto& count : holdBuckets_) {
+        dprintf(fd, " %llu", static_cast<unsigned long long>(count.load(std::memory_order_relaxed)));
+    }
+    dprintf(fd, "\n");
+}
+
+TimedLockGuard::TimedLockGuard(std::mutex& mutex, LockStats& stats) : mutex_(mutex), stats_(stats)
+{
+    if (mutex_.try_lock()) {
+        lockedTime_ = std::chrono::steady_clock::now();
+        return;
+    }
+    isContended_ = true;
+    auto waitStart = std::chrono::steady_clock::now();
+    mutex_.lock();
+    lockedTime_ = std::chrono::steady_clock::now();
+    waitUs_ = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(lockedTime_ - waitStart).count());
+}
+
+TimedLockGuard::~TimedLockGuard()
+{
+    uint64_t holdUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - lockedTime_).count());
+    mutex_.unlock();
+    stats_.Record(isContended_, waitUs_, holdUs);
+}
+}  // namespace NFC
+}  // namespace OHOS
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOCK_STATS_H
+#define LOCK_STATS_H
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace OHOS {
+namespace NFC {
+/**
+ * @brief Counts the acquisitions of a mutex, how many found it held, and the histograms of the wait and hold
+ * times, so a critical section that starts to block on IPC shows up in the dump.
+ */
+class LockStats final {
+public:
+    // upper bounds of the buckets in us, the last bucket takes the rest
+    static constexpr size_t BUCKET_COUNT = 6;
+    static constexpr std::array<uint64_t, BUCKET_COUNT - 1> BUCKET_LIMITS_US = {10, 100, 1000, 10000, 100000};
+
+    explicit LockStats(const char* name);
+    void Record(bool isContended, uint64_t waitUs, uint64_t holdUs);
+    void Dump(int fd) const;
+    uint64_t GetAcquireCount() const;
+    uint64_t GetContendedCount() const;
+    static size_t GetBucket(uint64_t timeUs);
+
+private:
+    static void UpdateMax(std::atomic<uint64_t>& max, uint64_t value);
+
+    const char* name_;
+    std::atomic<uint64_t> acquireCount_ {0};
+    std::atomic<uint64_t> contendedCount_ {0};
+    std::atomic<uint64_t> maxWaitUs_ {0};
+    std::atomic<uint64_t> maxHoldUs_ {0};
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> waitBuckets_ {};
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> holdBuckets_ {};
+};
+
+/**
+ * @brief Locks the mutex for the scope like std::lock_guard, and records the wait and hold times in the stats.
+ */
+class TimedLockGuard final {
+public:
+    TimedLockGuard(std::mutex& mutex, LockStats& stats);
+    ~TimedLockGuard();
+    TimedLockGuard(const TimedLockGuard&) = delete;
+    TimedLockGuard& operator=(const TimedLockGuard&) = delete;
+
+private:
+    std::mutex& mutex_;
+    LockStats& stats_;
+    bool isContended_ = false;
+    uint64_t waitUs_ = 0;
+    std::chrono::steady_clock::time_point lockedTime_ {};
+};
+}  // namespace NFC
+}  // namespace OHOS
+#endif  // LOCK_STATS_H
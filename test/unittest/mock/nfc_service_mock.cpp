@@ -82,6 +82,10 @@ void NfcService::OnCardEmulationDeactivated()
 {
 }
 
+void NfcService::OnEeInfoChanged()
+{
+}
+
 OHOS::sptr<IRemoteObject> NfcService::GetTagServiceIface()
 {
     return nullptr;
@@ -35,6 +35,7 @@ public:
     void OnCardEmulationData(const std::vector<uint8_t>& data) override;
     void OnCardEmulationActivated() override;
     void OnCardEmulationDeactivated() override;
+    void OnEeInfoChanged() override;
     OHOS::sptr<IRemoteObject> GetTagServiceIface() override;
     OHOS::sptr<IRemoteObject> GetHceServiceIface() override;
 
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "aid_key.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+using namespace OHOS::NFC;
+
+class AidKeyTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: FromHexString001
+ * @tc.desc: Test AidKey FromHexString matches the key of the SELECT bytes, case insensitive.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AidKeyTest, FromHexString001, TestSize.Level1)
+{
+    const uint8_t select[] = {0x00, 0xA4, 0x04, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x00, 0x03, 0x10, 0x10};
+    const size_t aidOffset = 5;
+    const size_t aidLen = 7;
+    AidKey aid(select + aidOffset, aidLen);
+    ASSERT_TRUE(aid.IsValid());
+    EXPECT_EQ(aid.GetLength(), aidLen);
+    EXPECT_TRUE(aid == AidKey::FromHexString("A0000000031010"));
+    EXPECT_TRUE(aid == AidKey::FromHexString("a0000000031010"));
+    EXPECT_TRUE(aid != AidKey::FromHexString("A000000003"));
+    EXPECT_EQ(aid.ToHexString(), "A0000000031010");
+}
+
+/**
+ * @tc.name: FromHexString002
+ * @tc.desc: Test AidKey is invalid for a malformed or too long AID.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AidKeyTest, FromHexString002, TestSize.Level1)
+{
+    EXPECT_FALSE(AidKey::FromHexString("").IsValid());
+    EXPECT_FALSE(AidKey::FromHexString("A00").IsValid());
+    EXPECT_FALSE(AidKey::FromHexString("A0000000G3").IsValid());
+    EXPECT_FALSE(AidKey::FromHexString(std::string((AidKey::MAX_AID_LEN + 1) * 2, '0')).IsValid());
+    EXPECT_TRUE(AidKey::FromHexString(std::string(AidKey::MAX_AID_LEN * 2, '0')).IsValid());
+    const uint8_t aid[AidKey::MAX_AID_LEN + 1] = {0};
+    EXPECT_FALSE(AidKey(aid, 0).IsValid());
+    EXPECT_FALSE(AidKey(aid, sizeof(aid)).IsValid());
+    EXPECT_FALSE(AidKey().IsValid());
+    EXPECT_EQ(AidKey().ToHexString(), "");
+}
+
+/**
+ * @tc.name: Compare001
+ * @tc.desc: Test AidKey orders the AIDs by bytes, a prefix first.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AidKeyTest, Compare001, TestSize.Level1)
+{
+    AidKey prefix = AidKey::FromHexString("A000000003");
+    AidKey longer = AidKey::FromHexString("A00000000301");
+    AidKey greater = AidKey::FromHexString("A000000004");
+    EXPECT_TRUE(prefix < longer);
+    EXPECT_TRUE(longer < greater);
+    EXPECT_FALSE(greater < prefix);
+    EXPECT_FALSE(prefix < prefix);
+}
+}
+}
+}
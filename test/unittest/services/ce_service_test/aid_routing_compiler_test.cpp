@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "aid_routing_compiler.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+using namespace OHOS::NFC;
+using AidEntry = AidRoutingCompiler::AidEntry;
+
+static const int ROUTE_HOST = 0x00;
+static const int ROUTE_ESE = 0x01;
+static const int POWER_HOST = 0x11;
+
+static void AddEntry(std::map<std::string, AidEntry> &entries, const std::string &aid, int route, int priority)
+{
+    AidEntry entry;
+    entry.aid = aid;
+    entry.route = route;
+    entry.aidInfo = AidRoutingCompiler::AID_INFO_EXACT;
+    entry.power = POWER_HOST;
+    entry.priority = priority;
+    entries[aid] = entry;
+}
+
+class AidRoutingCompilerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: Compile001
+ * @tc.desc: Test AidRoutingCompiler Compile keeps the exact entries when there is no limit.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AidRoutingCompilerTest, Compile001, TestSize.Level1)
+{
+    std::map<std::string, AidEntry> requested;
+    AddEntry(requested, "a000000003", ROUTE_HOST, AidRoutingCompiler::PRIORITY_OTHER);
+    AddEntry(requested, "A00000000301", ROUTE_HOST, AidRoutingCompiler::PRIORITY_OTHER);
+    std::map<std::string, AidEntry> compiled;
+    AidRoutingCompiler::RoutingTableStats stats = AidRoutingCompiler::Compile(requested, 0, ROUTE_HOST, compiled);
+    ASSERT_EQ(compiled.size(), 2);
+    EXPECT_EQ(compiled.count("A000000003"), 1);
+    EXPECT_EQ(compiled["A000000003"].aidInfo, AidRoutingCompiler::AID_INFO_EXACT);
+    EXPECT_EQ(stats.requestedCount, 2);
+    EXPECT_EQ(stats.prefixCount, 0);
+    EXPECT_EQ(stats.droppedCount, 0);
+    EXPECT_EQ(stats.usedSize, 19); // 4 + 5 and 4 + 6 bytes
+}
+
+/**
+ * @tc.name: Compile002
+ * @tc.desc: Test AidRoutingCompiler Compile folds the AIDs of the same route into a prefix entry on overflow.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AidRoutingCompilerTest, Compile002, TestSize.Level1)
+{
+    std::map<std::string, AidEntry> requested;
+    AddEntry(requested, "A000000003", ROUTE_HOST, AidRoutingCompiler::PRIORITY_OTHER);
+    AddEntry(requested, "A00000000301", ROUTE_HOST, AidRoutingCompiler::PRIORITY_OTHER);
+    AddEntry(requested, "A00000000302", ROUTE_HOST, AidRoutingCompiler::PRIORITY_PAYMENT);
+    std::map<std::string, AidEntry> compiled;
+    AidRoutingCompiler::RoutingTableStats stats = AidRoutingCompiler::Compile(requested, 16, ROUTE_HOST, compiled);
+    ASSERT_EQ(compiled.size(), 1);
+    EXPECT_EQ(compiled["A000000003"].aidInfo & AidRoutingCompiler::AID_INFO_PREFIX,
+        AidRoutingCompiler::AID_INFO_PREFIX);
+    EXPECT_EQ(compiled["A000000003"].priority, AidRoutingCompiler::PRIORITY_PAYMENT);
+    EXPECT_EQ(stats.prefixCount, 1);
+    EXPECT_EQ(stats.foldedCount, 2);
+    EXPECT_EQ(stats.droppedCount, 0);
+    EXPECT_LE(stats.usedSize, stats.tableSize);
+}
+
+/**
+ * @tc.name: Compile003
+ * @tc.desc: Test AidRoutingCompiler Compile doesn't fold the AIDs routed elsewhere.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AidRoutingCompilerTest, Compile003, TestSize.Level1)
+{
+    std::map<std::string, AidEntry> requested;
+    AddEntry(requested, "A000000003", ROUTE_HOST, AidRoutingCompiler::PRIORITY_OTHER);
+    AddEntry(requested, "A00000000301", ROUTE_ESE, AidRoutingCompiler::PRIORITY_OTHER);
+    std::map<std::string, AidEntry> compiled;
+    AidRoutingCompiler::RoutingTableStats stats = AidRoutingCompiler::Compile(requested, 10, ROUTE_HOST, compiled);
+    EXPECT_EQ(stats.prefixCount, 0);
+    EXPECT_EQ(stats.droppedCount, 1);
+    ASSERT_EQ(compiled.size(), 1);
+    EXPECT_EQ(compiled.count("A000000003"), 1);
+}
+
+/**
+ * @tc.name: Compile004
+ * @tc.desc: Test AidRoutingCompiler Compile drops the AIDs of the lowest priority first.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AidRoutingCompilerTest, Compile004, TestSize.Level1)
+{
+    std::map<std::string, AidEntry> requested;
+    AddEntry(requested, "A0000000041010", ROUTE_HOST, AidRoutingCompiler::PRIORITY_PAYMENT);
+    AddEntry(requested, "F001020304", ROUTE_HOST, AidRoutingCompiler::PRIORITY_OTHER);
+    AddEntry(requested, "F0AABBCC", ROUTE_ESE, AidRoutingCompiler::PRIORITY_FOREGROUND);
+    std::map<std::string, AidEntry> compiled;
+    AidRoutingCompiler::RoutingTableStats stats = AidRoutingCompiler::Compile(requested, 19, ROUTE_HOST, compiled);
+    EXPECT_EQ(stats.droppedCount, 1);
+    EXPECT_EQ(compiled.count("F001020304"), 0);
+    EXPECT_EQ(compiled.count("A0000000041010"), 1);
+    EXPECT_EQ(compiled.count("F0AABBCC"), 1);
+    EXPECT_EQ(stats.usedSize, 19);
+}
+
+/**
+ * @tc.name: Compile005
+ * @tc.desc: Test AidRoutingCompiler Compile doesn't fold the host AIDs when the default AID route is off-host.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AidRoutingCompilerTest, Compile005, TestSize.Level1)
+{
+    std::map<std::string, AidEntry> requested;
+    AddEntry(requested, "A000000003", ROUTE_HOST, AidRoutingCompiler::PRIORITY_OTHER);
+    AddEntry(requested, "A00000000301", ROUTE_HOST, AidRoutingCompiler::PRIORITY_OTHER);
+    AddEntry(requested, "A00000000302", ROUTE_HOST, AidRoutingCompiler::PRIORITY_PAYMENT);
+    std::map<std::string, AidEntry> compiled;
+    AidRoutingCompiler::RoutingTableStats stats = AidRoutingCompiler::Compile(requested, 16, ROUTE_ESE, compiled);
+    EXPECT_EQ(stats.prefixCount, 0);
+    EXPECT_EQ(stats.droppedCount, 2);
+    ASSERT_EQ(compiled.size(), 1);
+    EXPECT_EQ(compiled["A00000000302"].aidInfo, AidRoutingCompiler::AID_INFO_EXACT);
+    EXPECT_LE(stats.usedSize, stats.tableSize);
+}
+}
+}
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include "ce_capture_ring.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+
+class CeCaptureRingTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp();
+    void TearDown();
+};
+
+void CeCaptureRingTest::SetUp()
+{
+    CeCaptureRing::GetInstance().Clear();
+}
+
+void CeCaptureRingTest::TearDown()
+{
+    CeCaptureRing::GetInstance().Clear();
+}
+
+/**
+ * @tc.name: RecordApdu001
+ * @tc.desc: Test the capture keeps the AID of a SELECT, the header of the other APDUs and the status word
+ * @tc.type: FUNC
+ */
+HWTEST_F(CeCaptureRingTest, RecordApdu001, TestSize.Level1)
+{
+    CeCaptureRing& ring = CeCaptureRing::GetInstance();
+    ring.Record(CeCaptureRing::EVENT_ACTIVATED);
+    ring.RecordApdu({0x00, 0xA4, 0x04, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x00, 0x03, 0x10, 0x10, 0x00});
+    ring.RecordApdu({0x80, 0xA8, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00});
+    ring.RecordResponse("6F0A840700009000");
+    std::vector<CeCaptureRing::CaptureRecord> records = ring.GetRecords(0, CeCaptureRing::CAPTURE_CAPACITY);
+    ASSERT_EQ(records.size(), 4);
+    EXPECT_EQ(records[0].type, CeCaptureRing::EVENT_ACTIVATED);
+    EXPECT_EQ(records[1].frameLen, 13);
+    EXPECT_EQ(records[1].dataLen, 12);
+    EXPECT_EQ(records[2].frameLen, 8);
+    EXPECT_EQ(records[2].dataLen, CeCaptureRing::APDU_HEADER_LEN);
+    EXPECT_EQ(records[3].frameLen, 8);
+    ASSERT_EQ(records[3].dataLen, 2);
+    EXPECT_EQ(records[3].data[0], 0x90);
+    EXPECT_EQ(records[3].data[1], 0x00);
+    EXPECT_LE(records[0].timeUs, records[3].timeUs);
+}
+
+/**
+ * @tc.name: GetRecords001
+ * @tc.desc: Test GetRecords continues from a sequence and keeps only the newest records once the ring wraps
+ * @tc.type: FUNC
+ */
+HWTEST_F(CeCaptureRingTest, GetRecords001, TestSize.Level1)
+{
+    CeCaptureRing& ring = CeCaptureRing::GetInstance();
+    for (size_t i = 0; i <= CeCaptureRing::CAPTURE_CAPACITY; i++) {
+        ring.Record(CeCaptureRing::EVENT_FIELD_ON);
+    }
+    std::vector<CeCaptureRing::CaptureRecord> records = ring.GetRecords(0, CeCaptureRing::CAPTURE_CAPACITY);
+    ASSERT_EQ(records.size(), CeCaptureRing::CAPTURE_CAPACITY);
+    uint64_t lastSequence = records.back().sequence;
+    EXPECT_EQ(records.front().sequence + CeCaptureRing::CAPTURE_CAPACITY - 1, lastSequence);
+
+    records = ring.GetRecords(lastSequence - 2, 1);
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].sequence, lastSequence - 1);
+    EXPECT_TRUE(ring.GetRecords(lastSequence, CeCaptureRing::CAPTURE_CAPACITY).empty());
+
+    ring.Clear();
+    EXPECT_TRUE(ring.GetRecords(0, CeCaptureRing::CAPTURE_CAPACITY).empty());
+    ring.Record(CeCaptureRing::EVENT_FIELD_OFF);
+    records = ring.GetRecords(0, CeCaptureRing::CAPTURE_CAPACITY);
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].sequence, lastSequence + 1);
+}
+
+/**
+ * @tc.name: ParseRecord001
+ * @tc.desc: Test ParseRecord reads back the line of FormatRecord, and BuildFrame rebuilds the APDU length
+ * @tc.type: FUNC
+ */
+HWTEST_F(CeCaptureRingTest, ParseRecord001, TestSize.Level1)
+{
+    CeCaptureRing::CaptureRecord record;
+    record.sequence = 7;
+    record.timeUs = 123456;
+    record.type = CeCaptureRing::EVENT_APDU;
+    record.frameLen = 6;
+    record.dataLen = 4;
+    record.data[1] = 0xB2;
+    std::string line = CeCaptureRing::FormatRecord(record);
+    EXPECT_STREQ(line.c_str(), "7 123456 APDU 6 00B20000");
+
+    CeCaptureRing::CaptureRecord parsed;
+    ASSERT_TRUE(CeCaptureRing::ParseRecord("  " + line, parsed));
+    EXPECT_EQ(parsed.sequence, record.sequence);
+    EXPECT_EQ(parsed.timeUs, record.timeUs);
+    EXPECT_EQ(parsed.type, record.type);
+    EXPECT_EQ(parsed.dataLen, record.dataLen);
+    std::vector<uint8_t> apdu = CeCaptureRing::BuildFrame(parsed);
+    ASSERT_EQ(apdu.size(), 6);
+    EXPECT_EQ(apdu[1], 0xB2);
+    EXPECT_EQ(apdu[5], 0x00);
+
+    ASSERT_TRUE(CeCaptureRing::ParseRecord("8 123457 FIELD_OFF 0 -", parsed));
+    EXPECT_EQ(parsed.dataLen, 0);
+    EXPECT_FALSE(CeCaptureRing::ParseRecord("8 123457 FIELD 0 -", parsed));
+    EXPECT_FALSE(CeCaptureRing::ParseRecord("123457 CE 0x0A 0x01 -", parsed));
+    EXPECT_FALSE(CeCaptureRing::ParseRecord("8 123457 APDU 4 00B", parsed));
+}
+
+/**
+ * @tc.name: MaskAid001
+ * @tc.desc: Test MaskAid leaves the AID of a SELECT out, keeping its header, and keeps the other records
+ * @tc.type: FUNC
+ */
+HWTEST_F(CeCaptureRingTest, MaskAid001, TestSize.Level1)
+{
+    CeCaptureRing& ring = CeCaptureRing::GetInstance();
+    ring.RecordApdu({0x00, 0xA4, 0x04, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x00, 0x03, 0x10, 0x10, 0x00});
+    ring.RecordApdu({0x80, 0xA8, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00});
+    ring.RecordResponse("6A82");
+    std::vector<CeCaptureRing::CaptureRecord> records = ring.GetRecords(0, CeCaptureRing::CAPTURE_CAPACITY);
+    ASSERT_EQ(records.size(), 3);
+
+    CeCaptureRing::CaptureRecord masked = CeCaptureRing::MaskAid(records[0]);
+    EXPECT_EQ(masked.frameLen, 13);
+    EXPECT_EQ(masked.dataLen, CeCaptureRing::SELECT_HEADER_LEN);
+    EXPECT_EQ(CeCaptureRing::FormatRecord(masked).find("A000000003"), std::string::npos);
+    EXPECT_STREQ(CeCaptureRing::FormatRecord(CeCaptureRing::MaskAid(records[1])).c_str(),
+        CeCaptureRing::FormatRecord(records[1]).c_str());
+    EXPECT_EQ(CeCaptureRing::MaskAid(records[2]).data[0], 0x6A);
+}
+}
+}
+}
@@ -13,7 +13,9 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <fcntl.h>
 #include <thread>
+#include <unistd.h>
 
 #include "ndef_msg_callback_stub.h"
 #include "nfc_controller_callback_stub.h"
@@ -22,6 +24,7 @@
 #include "loghelper.h"
 #include "nfc_param_util.h"
 #include "external_deps_proxy.h"
+#include "nfc_bundle_mgr_client.h"
 
 namespace OHOS {
 namespace NFC {
@@ -443,6 +446,25 @@ HWTEST_F(NfcControllerImplTest, VendorRefreshRoutes, TestSize.Level1)
     ErrCode restart = nfcControllerImpl->VendorRefreshRoutes();
     ASSERT_TRUE(restart >= KITS::ERR_NONE);
 }
+
+/**
+ * @tc.name: Dump001
+ * @tc.desc: Test NfcControllerImpl Dump prints the bundle manager cache statistics.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NfcControllerImplTest, Dump001, TestSize.Level1)
+{
+    std::shared_ptr<NfcService> nfcService = std::make_shared<NfcService>();
+    std::shared_ptr<NfcControllerImpl> nfcControllerImpl = std::make_shared<NfcControllerImpl>(nfcService);
+    std::vector<std::u16string> args;
+    ASSERT_TRUE(nfcControllerImpl->Dump(-1, args) == KITS::ERR_NFC_PARAMETERS);
+
+    NfcBundleMgrClient::GetInstance().InvalidateBundle("com.example.test");
+    int fd = open("/dev/null", O_WRONLY);
+    ASSERT_TRUE(fd >= 0);
+    ASSERT_TRUE(nfcControllerImpl->Dump(fd, args) == KITS::ERR_NONE);
+    close(fd);
+}
 }
 }
 }
\ No newline at end of file
@@ -19,6 +19,8 @@
 #include <gtest/gtest.h>
 #include <thread>
 
+#include "ce_capture_ring.h"
+#include "external_deps_proxy.h"
 #include "hce_cmd_callback_stub.h"
 #include "hce_cmd_death_recipient.h"
 #include "hce_session.h"
@@ -368,6 +370,74 @@ HWTEST_F(HceSessionTest, GetPaymentServices001, TestSize.Level1)
     ASSERT_TRUE(errorCode == NFC::KITS::ErrorCode::ERR_NONE);
 }
 
+/**
+ * @tc.name: GetPaymentServicesIfChanged001
+ * @tc.desc: Test HceSessionTest GetPaymentServicesIfChanged returns unchanged for the known version.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HceSessionTest, GetPaymentServicesIfChanged001, TestSize.Level1)
+{
+    std::shared_ptr<HCE::HceSession> hceSession = std::make_shared<HCE::HceSession>(nullptr);
+    CePaymentServicesParcelable parcelable;
+    ErrCode errorCode = hceSession->GetPaymentServicesIfChanged(0, parcelable);
+    ASSERT_TRUE(errorCode == NFC::KITS::ErrorCode::ERR_NONE);
+    ASSERT_FALSE(parcelable.isUnchanged);
+
+    CePaymentServicesParcelable unchanged;
+    errorCode = hceSession->GetPaymentServicesIfChanged(parcelable.version, unchanged);
+    ASSERT_TRUE(errorCode == NFC::KITS::ErrorCode::ERR_NONE);
+    ASSERT_TRUE(unchanged.isUnchanged);
+    ASSERT_TRUE(unchanged.paymentAbilityInfos.empty());
+    ASSERT_EQ(unchanged.version, parcelable.version);
+}
+
+/**
+ * @tc.name: GetPaymentServicesIfChanged002
+ * @tc.desc: Test HceSessionTest the version of the payment services changes with the sim vendor bundle.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HceSessionTest, GetPaymentServicesIfChanged002, TestSize.Level1)
+{
+    std::shared_ptr<HCE::HceSession> hceSession = std::make_shared<HCE::HceSession>(nullptr);
+    CePaymentServicesParcelable parcelable;
+    ErrCode errorCode = hceSession->GetPaymentServicesIfChanged(0, parcelable);
+    ASSERT_TRUE(errorCode == NFC::KITS::ErrorCode::ERR_NONE);
+    // the versions start from a random epoch, not from 1.
+    ASSERT_NE(parcelable.version, 0);
+
+    ExternalDepsProxy::GetInstance().UpdatePaymentSimBundleName("com.example.simpay");
+    uint64_t simVersion = ExternalDepsProxy::GetInstance().GetPaymentCatalog()->version;
+    ASSERT_NE(simVersion, parcelable.version);
+    ExternalDepsProxy::GetInstance().UpdatePaymentSimBundleName("com.example.simpay");
+    ASSERT_EQ(ExternalDepsProxy::GetInstance().GetPaymentCatalog()->version, simVersion);
+    ExternalDepsProxy::GetInstance().UpdatePaymentSimBundleName("");
+}
+
+/**
+ * @tc.name: GetCeCapture001
+ * @tc.desc: Test HceSessionTest GetCeCapture returns the records after the sequence.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HceSessionTest, GetCeCapture001, TestSize.Level1)
+{
+    std::shared_ptr<HCE::HceSession> hceSession = std::make_shared<HCE::HceSession>(nullptr);
+    CeCaptureRing::GetInstance().Clear();
+    CeCaptureRing::GetInstance().Record(CeCaptureRing::EVENT_FIELD_ON);
+    CeCaptureRing::GetInstance().Record(CeCaptureRing::EVENT_ACTIVATED);
+    std::vector<std::string> records;
+    ErrCode errorCode = hceSession->GetCeCapture(0, records);
+    ASSERT_TRUE(errorCode == NFC::KITS::ErrorCode::ERR_NONE);
+    ASSERT_EQ(records.size(), 2);
+
+    CeCaptureRing::CaptureRecord first;
+    ASSERT_TRUE(CeCaptureRing::ParseRecord(records[0], first));
+    std::vector<std::string> newer;
+    errorCode = hceSession->GetCeCapture(first.sequence, newer);
+    ASSERT_TRUE(errorCode == NFC::KITS::ErrorCode::ERR_NONE);
+    ASSERT_EQ(newer.size(), 1);
+    ASSERT_EQ(newer[0], records[1]);
+}
+
 class HceCmdListenerEvent : public IHceCmdCallback {
 public:
     HceCmdListenerEvent() {}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include "hce_apdu_queue.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+
+class HceApduQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: Release001
+ * @tc.desc: Test Release gives the APDUs in the arrival order and empties the queue
+ * @tc.type: FUNC
+ */
+HWTEST_F(HceApduQueueTest, Release001, TestSize.Level1)
+{
+    HceApduQueue queue;
+    EXPECT_FALSE(queue.Push({}));
+    ASSERT_TRUE(queue.Push({0x00, 0xA4, 0x04, 0x00}));
+    ASSERT_TRUE(queue.Push({0x80, 0xCA}));
+    EXPECT_EQ(queue.GetCount(), 2);
+    EXPECT_EQ(queue.GetBytes(), 6);
+
+    std::vector<std::vector<uint8_t>> apdus = queue.Release();
+    ASSERT_EQ(apdus.size(), 2);
+    EXPECT_EQ(apdus[0][1], 0xA4);
+    EXPECT_EQ(apdus[1][1], 0xCA);
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(queue.GetBytes(), 0);
+    EXPECT_TRUE(queue.Release().empty());
+}
+
+/**
+ * @tc.name: Push001
+ * @tc.desc: Test Push drops the APDUs over the count and the bytes bounds, keeping the earlier ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(HceApduQueueTest, Push001, TestSize.Level1)
+{
+    HceApduQueue queue;
+    for (size_t i = 0; i < HceApduQueue::MAX_APDU_COUNT; i++) {
+        ASSERT_TRUE(queue.Push({static_cast<uint8_t>(i)}));
+    }
+    EXPECT_FALSE(queue.Push({0xFF}));
+    EXPECT_EQ(queue.Release()[0][0], 0x00);
+
+    EXPECT_TRUE(queue.Push(std::vector<uint8_t>(HceApduQueue::MAX_APDU_BYTES, 0x00)));
+    EXPECT_FALSE(queue.Push({0x01}));
+    EXPECT_EQ(queue.GetCount(), 1);
+    EXPECT_EQ(queue.GetStats().droppedCount, 2);
+}
+
+/**
+ * @tc.name: Release002
+ * @tc.desc: Test Release records the wait of the oldest APDU of each transaction
+ * @tc.type: FUNC
+ */
+HWTEST_F(HceApduQueueTest, Release002, TestSize.Level1)
+{
+    HceApduQueue queue;
+    HceApduQueue::Clock::time_point start = HceApduQueue::Clock::now();
+    queue.Push({0x01}, start);
+    queue.Push({0x02}, start + std::chrono::milliseconds(100));
+    queue.Release(start + std::chrono::milliseconds(300));
+    queue.Push({0x03}, start);
+    queue.Release(start + std::chrono::milliseconds(HceApduQueue::SLOW_WAIT_MS + 1));
+
+    const HceApduQueue::QueueStats& stats = queue.GetStats();
+    EXPECT_EQ(stats.queuedCount, 3);
+    EXPECT_EQ(stats.releaseCount, 2);
+    EXPECT_EQ(stats.releasedCount, 3);
+    EXPECT_EQ(stats.slowReleaseCount, 1);
+    EXPECT_EQ(stats.lastWaitMs, HceApduQueue::SLOW_WAIT_MS + 1);
+    EXPECT_EQ(stats.maxWaitMs, HceApduQueue::SLOW_WAIT_MS + 1);
+    EXPECT_EQ(stats.totalWaitMs, HceApduQueue::SLOW_WAIT_MS + 301);
+}
+}
+}
+}
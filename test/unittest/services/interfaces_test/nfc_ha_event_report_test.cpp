@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "nfc_ha_event_report.h"
+#include "nfc_sdk_common.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+using namespace OHOS::NFC::KITS;
+class NfcHaEventReportTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: ReportSdkEvent001
+ * @tc.desc: Test the calls counted by a thread are written when the thread exits.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NfcHaEventReportTest, ReportSdkEvent001, TestSize.Level1)
+{
+    const int callCount = 3; // less than the row threshold, so only the thread exit writes them
+    int64_t pendingBefore = NfcHaEventReport::GetPendingCalls();
+    int64_t pendingInThread = 0;
+    std::thread reporter([callCount, &pendingInThread]() {
+        for (int i = 0; i < callCount; i++) {
+            NfcHaEventReport report(SDK_NAME, "ReportSdkEvent001");
+            report.ReportSdkEvent(i == 0 ? RESULT_FAIL : RESULT_SUCCESS, ErrorCode::ERR_NONE);
+        }
+        pendingInThread = NfcHaEventReport::GetPendingCalls();
+    });
+    reporter.join();
+    EXPECT_EQ(pendingInThread, pendingBefore + callCount);
+    EXPECT_EQ(NfcHaEventReport::GetPendingCalls(), pendingBefore);
+}
+}
+}
+}
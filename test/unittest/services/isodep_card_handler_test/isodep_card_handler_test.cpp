@@ -15,7 +15,9 @@
 #define private public
 #define protected public
 
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <map>
 #include <thread>
 
 #include "isodep_card_handler.h"
@@ -27,6 +29,58 @@ namespace TEST {
 using namespace testing::ext;
 using namespace OHOS::NFC::TAG;
 using namespace OHOS::NFC::NCI;
+// answers the check apdus from a table in place of the tag, and records the apdus sent.
+class CheckApduTag : public INciTagInterface {
+public:
+    explicit CheckApduTag(const std::map<std::string, std::string> &responses) : responses_(responses) {}
+    int Transceive(uint32_t tagDiscId, const std::string &command, std::string &response) override
+    {
+        std::string cmdApdu = command;
+        std::transform(cmdApdu.begin(), cmdApdu.end(), cmdApdu.begin(), ::toupper);
+        sentApdus_.push_back(cmdApdu);
+        auto it = responses_.find(cmdApdu);
+        response = (it == responses_.end()) ? "6A82" : it->second;
+        return 0;
+    }
+    void SetTagListener(std::weak_ptr<ITagListener> listener) override {}
+    std::vector<int> GetTechList(uint32_t tagDiscId) override { return {}; }
+    uint32_t GetConnectedTech(uint32_t tagDiscId) override { return 0; }
+    std::vector<AppExecFwk::PacMap> GetTechExtrasData(uint32_t tagDiscId) override { return {}; }
+    std::string GetTagUid(uint32_t tagDiscId) override { return ""; }
+    bool Connect(uint32_t tagDiscId, uint32_t technology) override { return true; }
+    bool Disconnect(uint32_t tagDiscId) override { return true; }
+    bool Reconnect(uint32_t tagDiscId) override { return true; }
+    std::string ReadNdef(uint32_t tagDiscId) override { return ""; }
+    std::string FindNdefTech(uint32_t tagDiscId) override { return ""; }
+    bool WriteNdef(uint32_t tagDiscId, const std::string &command) override { return false; }
+    bool FormatNdef(uint32_t tagDiscId, const std::string &key) override { return false; }
+    bool CanMakeReadOnly(uint32_t ndefType) override { return false; }
+    bool SetNdefReadOnly(uint32_t tagDiscId) override { return false; }
+    bool DetectNdefInfo(uint32_t tagDiscId, std::vector<int> &ndefInfo) override { return false; }
+    bool IsTagFieldOn(uint32_t tagDiscId) override { return true; }
+    void StartFieldOnChecking(uint32_t tagDiscId, uint32_t delayedMs) override {}
+    void StopFieldChecking() override {}
+    void SetTimeout(uint32_t tagDiscId, uint32_t timeout, uint32_t technology) override {}
+    void GetTimeout(uint32_t tagDiscId, uint32_t &timeout, uint32_t technology) override {}
+    void ResetTimeout(uint32_t tagDiscId) override {}
+    uint32_t GetIsoDepMaxTransceiveLength() override { return 0; }
+    bool IsExtendedLengthApduSupported() override { return false; }
+    uint16_t GetTechMaskFromTechList(const std::vector<uint32_t> &discTech) override { return 0; }
+    bool VendorParseHarPackage(std::vector<std::string> &harPackages, const std::string &uri) override
+    {
+        return false;
+    }
+    std::string GetVendorInfo(uint16_t type) override { return ""; }
+#ifdef VENDOR_APPLICATIONS_ENABLED
+    bool IsVendorProcess(const std::string &appBundleName) override { return false; }
+#endif
+
+    std::vector<std::string> sentApdus_;
+
+private:
+    std::map<std::string, std::string> responses_;
+};
+
 class IsodepCardHandlerTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -173,6 +227,156 @@ HWTEST_F(IsodepCardHandlerTest, GetCardName, TestSize.Level1)
     ASSERT_TRUE(isodepCardHandler != nullptr);
 }
 
+/**
+ * @tc.name: IsSupportedTransportCard003
+ * @tc.desc: Test IsodepCardHandlerTest IsSupportedTransportCard matches nothing without the tag proxy.
+ * @tc.type: FUNC
+ */
+HWTEST_F(IsodepCardHandlerTest, IsSupportedTransportCard003, TestSize.Level1)
+{
+    std::weak_ptr<INciTagInterface> nciTagProxy;
+    std::shared_ptr<IsodepCardHandler> isodepCardHandler = std::make_shared<IsodepCardHandler>(nciTagProxy);
+    isodepCardHandler->cardInfoVec_.push_back({"card0", "", {"00A40400", "00B00000"}, {}, ""});
+    isodepCardHandler->cardInfoVec_.push_back({"card1", "", {"00A40400", "00B00001"}, {}, "AB"});
+    uint8_t cardIndex = INVALID_CARD_INDEX;
+    ASSERT_FALSE(isodepCardHandler->IsSupportedTransportCard(0, cardIndex));
+    ASSERT_EQ(cardIndex, INVALID_CARD_INDEX);
+    std::string rspApdu = "";
+    ASSERT_FALSE(isodepCardHandler->MatchCity(0, 1, rspApdu));
+    ASSERT_TRUE(rspApdu.empty());
+}
+
+/**
+ * @tc.name: BuildCheckTree001
+ * @tc.desc: Test IsodepCardHandlerTest BuildCheckTree shares the identical leading check apdus of the cards.
+ * @tc.type: FUNC
+ */
+HWTEST_F(IsodepCardHandlerTest, BuildCheckTree001, TestSize.Level1)
+{
+    std::weak_ptr<INciTagInterface> nciTagProxy;
+    std::shared_ptr<IsodepCardHandler> isodepCardHandler = std::make_shared<IsodepCardHandler>(nciTagProxy);
+    isodepCardHandler->cardInfoVec_.push_back({"card0", "", {"00A40400", "00B00000"}, {}, ""});
+    isodepCardHandler->cardInfoVec_.push_back({"card1", "", {"00a40400", "00B00001"}, {}, ""});
+    isodepCardHandler->cardInfoVec_.push_back({"card2", "", {"00A40400"}, {}, "CD"});
+    isodepCardHandler->cardInfoVec_.push_back({"card3", "", {"00A4040002"}, {}, ""});
+    isodepCardHandler->BuildCheckTree();
+
+    std::vector<CardCheckNode> &tree = isodepCardHandler->checkTree_;
+    ASSERT_EQ(tree.size(), 2U);
+    ASSERT_EQ(tree[0].cmdApdu, "00A40400");
+    ASSERT_EQ(tree[0].branches.size(), 2U);
+    ASSERT_EQ(tree[0].branches[0].cardIndex, INVALID_CARD_INDEX);
+    ASSERT_EQ(tree[0].branches[0].children.size(), 2U);
+    ASSERT_EQ(tree[0].branches[0].children[1].minCardIndex, 1);
+    ASSERT_EQ(tree[0].branches[1].cardIndex, 2);
+    ASSERT_EQ(tree[1].minCardIndex, 3);
+}
+
+/**
+ * @tc.name: IsSupportedTransportCard004
+ * @tc.desc: Test IsodepCardHandlerTest IsSupportedTransportCard sends fewer apdus than the replay of each card.
+ * @tc.type: FUNC
+ */
+HWTEST_F(IsodepCardHandlerTest, IsSupportedTransportCard004, TestSize.Level1)
+{
+    const std::string selectApdu = "00A4040008A000000632010105";
+    std::shared_ptr<CheckApduTag> tag = std::make_shared<CheckApduTag>(
+        std::map<std::string, std::string> {{selectApdu, "9F0CEF9000"}});
+    std::shared_ptr<IsodepCardHandler> isodepCardHandler = std::make_shared<IsodepCardHandler>(tag);
+    isodepCardHandler->cardInfoVec_.push_back({"card0", "", {selectApdu, "00B0950000"}, {}, "AB"});
+    isodepCardHandler->cardInfoVec_.push_back({"card1", "", {selectApdu}, {}, "CD"});
+    isodepCardHandler->cardInfoVec_.push_back({"card2", "", {"00a4040008a000000632010105"}, {}, "EF"});
+    isodepCardHandler->cardInfoVec_.push_back({"card3", "", {"00A4040008B000000000000001"}, {}, ""});
+    isodepCardHandler->BuildCheckTree();
+
+    uint8_t cardIndex = INVALID_CARD_INDEX;
+    ASSERT_TRUE(isodepCardHandler->IsSupportedTransportCard(0, cardIndex));
+    size_t treeExchanges = tag->sentApdus_.size();
+
+    // each card replaying its own check apdus from the start.
+    tag->sentApdus_.clear();
+    uint8_t replayIndex = INVALID_CARD_INDEX;
+    for (uint8_t index = 0; index < isodepCardHandler->cardInfoVec_.size(); ++index) {
+        std::string rspApdu = "";
+        if (isodepCardHandler->MatchCity(0, index, rspApdu)) {
+            replayIndex = index;
+            break;
+        }
+    }
+    ASSERT_EQ(cardIndex, 2);
+    ASSERT_EQ(replayIndex, cardIndex);
+    ASSERT_EQ(treeExchanges, 1U);
+    ASSERT_EQ(tag->sentApdus_.size(), 3U);
+}
+
+/**
+ * @tc.name: IsSupportedTransportCard005
+ * @tc.desc: Test IsodepCardHandlerTest IsSupportedTransportCard sends the shared apdu again before the apdus of a
+ *           card, once another card sharing it has sent its own apdus.
+ * @tc.type: FUNC
+ */
+HWTEST_F(IsodepCardHandlerTest, IsSupportedTransportCard005, TestSize.Level1)
+{
+    std::shared_ptr<CheckApduTag> tag = std::make_shared<CheckApduTag>(std::map<std::string, std::string> {
+        {"00A40400", "9F0CABCD9000"}, {"00B00001", "9F0CCD9000"}, {"00B00003", "9000"}});
+    std::shared_ptr<IsodepCardHandler> isodepCardHandler = std::make_shared<IsodepCardHandler>(tag);
+    // the response of the select matches the rspContains of both the first two cards.
+    isodepCardHandler->cardInfoVec_.push_back({"card0", "", {"00A40400", "00B00000"}, {}, "AB"});
+    isodepCardHandler->cardInfoVec_.push_back({"card1", "", {"00A40400", "00B00001"}, {}, "CD"});
+    // the same rspContains as card3, the select is shared by their branch.
+    isodepCardHandler->cardInfoVec_.push_back({"card2", "", {"00A40400", "00B00002"}, {}, ""});
+    isodepCardHandler->cardInfoVec_.push_back({"card3", "", {"00A40400", "00B00003"}, {}, ""});
+    isodepCardHandler->BuildCheckTree();
+
+    uint8_t cardIndex = INVALID_CARD_INDEX;
+    ASSERT_TRUE(isodepCardHandler->IsSupportedTransportCard(0, cardIndex));
+    ASSERT_EQ(cardIndex, 1);
+    std::vector<std::string> expected = {"00A40400", "00B00000", "00A40400", "00B00001"};
+    ASSERT_EQ(tag->sentApdus_, expected);
+
+    tag->sentApdus_.clear();
+    isodepCardHandler->cardInfoVec_.erase(isodepCardHandler->cardInfoVec_.begin(),
+        isodepCardHandler->cardInfoVec_.begin() + 2);
+    isodepCardHandler->BuildCheckTree();
+    ASSERT_TRUE(isodepCardHandler->IsSupportedTransportCard(0, cardIndex));
+    ASSERT_EQ(cardIndex, 1);
+    expected = {"00A40400", "00B00002", "00A40400", "00B00003"};
+    ASSERT_EQ(tag->sentApdus_, expected);
+}
+
+/**
+ * @tc.name: IsValidRspContain001
+ * @tc.desc: Test IsodepCardHandlerTest IsValidRspContain rejects the rspContains not in hex bytes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(IsodepCardHandlerTest, IsValidRspContain001, TestSize.Level1)
+{
+    ASSERT_TRUE(IsodepCardHandler::IsValidRspContain(""));
+    ASSERT_TRUE(IsodepCardHandler::IsValidRspContain("5A0a"));
+    ASSERT_FALSE(IsodepCardHandler::IsValidRspContain("5A0"));
+    ASSERT_FALSE(IsodepCardHandler::IsValidRspContain("5G"));
+}
+
+/**
+ * @tc.name: CheckApduResponse001
+ * @tc.desc: Test IsodepCardHandlerTest CheckApduResponse matches the response bytes on byte boundaries.
+ * @tc.type: FUNC
+ */
+HWTEST_F(IsodepCardHandlerTest, CheckApduResponse001, TestSize.Level1)
+{
+    std::vector<unsigned char> response = {0x9F, 0x0C, 0x12, 0x34, 0x90, 0x00};
+    std::vector<unsigned char> errorResponse = {0x6A, 0x82};
+    std::vector<unsigned char> shortResponse = {0x90};
+    std::vector<uint8_t> noContain;
+    std::vector<uint8_t> contain = {0x12, 0x34};
+    std::vector<uint8_t> unalignedContain = {0x23};
+    ASSERT_TRUE(IsodepCardHandler::CheckApduResponse(response, noContain));
+    ASSERT_TRUE(IsodepCardHandler::CheckApduResponse(response, contain));
+    ASSERT_FALSE(IsodepCardHandler::CheckApduResponse(response, unalignedContain));
+    ASSERT_FALSE(IsodepCardHandler::CheckApduResponse(errorResponse, noContain));
+    ASSERT_FALSE(IsodepCardHandler::CheckApduResponse(shortResponse, noContain));
+}
+
 } // namespace TEST
 } // namespace NFC
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include "nci_event_trace.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+using namespace OHOS::NFC::NCI;
+
+class NciEventTraceTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp();
+    void TearDown();
+};
+
+void NciEventTraceTest::SetUp()
+{
+    NciEventTrace::GetInstance().Clear();
+}
+
+void NciEventTraceTest::TearDown()
+{
+    NciEventTrace::GetInstance().Clear();
+}
+
+/**
+ * @tc.name: RecordTest001
+ * @tc.desc: Test Record keeps the events in order and truncates the payload
+ * @tc.type: FUNC
+ */
+HWTEST_F(NciEventTraceTest, RecordTest001, TestSize.Level1)
+{
+    NciEventTrace& trace = NciEventTrace::GetInstance();
+    uint8_t payload[NciEventTrace::MAX_PAYLOAD_LEN + 1] = {0x01, 0x04, 0x00, 0x00};
+    trace.Record(NciEventTrace::SOURCE_CONN, 0x05, 0x00, payload, sizeof(payload));
+    trace.Record(NciEventTrace::SOURCE_EE, 0x10, 0x03);
+    std::vector<NciEventTrace::EventRecord> records = trace.Snapshot();
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].source, NciEventTrace::SOURCE_CONN);
+    EXPECT_EQ(records[0].payloadLen, NciEventTrace::MAX_PAYLOAD_LEN);
+    EXPECT_EQ(records[1].event, 0x10);
+    EXPECT_LE(records[0].timeUs, records[1].timeUs);
+}
+
+/**
+ * @tc.name: RecordTest002
+ * @tc.desc: Test Snapshot keeps only the newest events once the ring wraps
+ * @tc.type: FUNC
+ */
+HWTEST_F(NciEventTraceTest, RecordTest002, TestSize.Level1)
+{
+    NciEventTrace& trace = NciEventTrace::GetInstance();
+    for (size_t i = 0; i <= NciEventTrace::TRACE_CAPACITY; i++) {
+        trace.Record(NciEventTrace::SOURCE_DM, static_cast<uint8_t>(i), 0x00);
+    }
+    std::vector<NciEventTrace::EventRecord> records = trace.Snapshot();
+    ASSERT_EQ(records.size(), NciEventTrace::TRACE_CAPACITY);
+    EXPECT_EQ(records[0].event, 0x01);
+    trace.Clear();
+    EXPECT_TRUE(trace.Snapshot().empty());
+}
+
+/**
+ * @tc.name: ParseRecordTest001
+ * @tc.desc: Test ParseRecord reads back the line of FormatRecord
+ * @tc.type: FUNC
+ */
+HWTEST_F(NciEventTraceTest, ParseRecordTest001, TestSize.Level1)
+{
+    NciEventTrace::EventRecord record;
+    record.timeUs = 123456;
+    record.source = NciEventTrace::SOURCE_CE;
+    record.event = 0x0A;
+    record.status = 0x01;
+    record.payloadLen = 2;
+    record.payload[0] = 0x00;
+    record.payload[1] = 0x0D;
+    std::string line = NciEventTrace::FormatRecord(record);
+    EXPECT_STREQ(line.c_str(), "123456 CE 0x0A 0x01 000D");
+
+    NciEventTrace::EventRecord parsed;
+    ASSERT_TRUE(NciEventTrace::ParseRecord(line, parsed));
+    EXPECT_EQ(parsed.timeUs, record.timeUs);
+    EXPECT_EQ(parsed.source, record.source);
+    EXPECT_EQ(parsed.payloadLen, record.payloadLen);
+    EXPECT_EQ(parsed.payload[1], record.payload[1]);
+    ASSERT_TRUE(NciEventTrace::ParseRecord("1 DM 0x02 0x00 -", parsed));
+    EXPECT_EQ(parsed.payloadLen, 0);
+    EXPECT_FALSE(NciEventTrace::ParseRecord("1 XX 0x02 0x00 -", parsed));
+    EXPECT_FALSE(NciEventTrace::ParseRecord("1 DM 0x02 0x00 ABC", parsed));
+}
+}
+}
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#define private public
+#define protected public
+#include <gtest/gtest.h>
+#include "nfcc_nci_adapter.h"
+#include "routing_manager.h"
+#undef private
+#undef protected
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+using namespace OHOS::NFC::NCI;
+
+class TestCeHostListener : public INciCeInterface::ICeHostListener {
+public:
+    void FieldActivated() override {}
+    void FieldDeactivated() override {}
+    void OnCardEmulationData(const std::vector<uint8_t> &data) override {}
+    void OnCardEmulationActivated() override {}
+    void OnCardEmulationDeactivated() override {}
+    void OnEeInfoChanged() override
+    {
+        eeInfoChangedCount_++;
+    }
+    int eeInfoChangedCount_ = 0;
+};
+
+static RoutingManager::RoutingState BuildTestRoutingState()
+{
+    RoutingManager::RoutingState state;
+    state.protoIsoDep.route = 0x01;
+    state.protoIsoDep.power = 0x3B;
+    state.techAB.route = 0x01;
+    state.techAB.power = 0x3B;
+    state.techF.route = 0x01;
+    state.techF.power = 0x3B;
+    state.defaultAid.route = 0x01;
+    state.defaultAid.power = 0x3B;
+    return state;
+}
+
+class RoutingManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp();
+    void TearDown();
+};
+
+void RoutingManagerTest::SetUp()
+{
+    RoutingManager& rm = RoutingManager::GetInstance();
+    rm.eeState_ = RoutingManager::EE_STATE_IDLE;
+    rm.isEeInfoReceived_ = false;
+    rm.isEeInfoChanged_ = false;
+    rm.isDeinitializing_ = false;
+    rm.routingState_ = RoutingManager::RoutingState();
+    rm.isDefaultAidRouted_ = false;
+}
+
+void RoutingManagerTest::TearDown()
+{
+    SetUp();
+    NfccNciAdapter::GetInstance().SetCeHostListener(std::weak_ptr<INciCeInterface::ICeHostListener>());
+}
+
+/**
+ * @tc.name: DoNfaEeDiscoverReqEvent001
+ * @tc.desc: Test the EE info coming while Initialize waits for it doesn't ask for a commit
+ * @tc.type: FUNC
+ */
+HWTEST_F(RoutingManagerTest, DoNfaEeDiscoverReqEvent001, TestSize.Level1)
+{
+    std::shared_ptr<TestCeHostListener> listener = std::make_shared<TestCeHostListener>();
+    NfccNciAdapter::GetInstance().SetCeHostListener(listener);
+    RoutingManager& rm = RoutingManager::GetInstance();
+    rm.eeState_ = RoutingManager::EE_STATE_WAITING_INFO;
+    tNFA_EE_CBACK_DATA eventData {};
+    eventData.discover_req.num_ee = 1;
+    rm.DoNfaEeDiscoverReqEvent(&eventData);
+    EXPECT_TRUE(rm.isEeInfoReceived_);
+    EXPECT_FALSE(rm.isEeInfoChanged_);
+    EXPECT_EQ(listener->eeInfoChangedCount_, 0);
+}
+
+/**
+ * @tc.name: DoNfaEeDiscoverReqEvent002
+ * @tc.desc: Test the EE info coming after Initialize timed out waiting for it asks for a commit
+ * @tc.type: FUNC
+ */
+HWTEST_F(RoutingManagerTest, DoNfaEeDiscoverReqEvent002, TestSize.Level1)
+{
+    std::shared_ptr<TestCeHostListener> listener = std::make_shared<TestCeHostListener>();
+    NfccNciAdapter::GetInstance().SetCeHostListener(listener);
+    RoutingManager& rm = RoutingManager::GetInstance();
+    rm.eeState_ = RoutingManager::EE_STATE_READY;
+    tNFA_EE_CBACK_DATA eventData {};
+    eventData.discover_req.num_ee = 1;
+    rm.DoNfaEeDiscoverReqEvent(&eventData);
+    EXPECT_TRUE(rm.isEeInfoReceived_);
+    EXPECT_TRUE(rm.isEeInfoChanged_);
+    EXPECT_EQ(listener->eeInfoChangedCount_, 1);
+
+    // no commit is asked for while NFC is turning off.
+    rm.isDeinitializing_ = true;
+    rm.DoNfaEeDiscoverReqEvent(&eventData);
+    EXPECT_EQ(listener->eeInfoChangedCount_, 1);
+}
+
+/**
+ * @tc.name: DiffRoutingState001
+ * @tc.desc: Test all the entries are set when nothing is set to the NFCC yet
+ * @tc.type: FUNC
+ */
+HWTEST_F(RoutingManagerTest, DiffRoutingState001, TestSize.Level1)
+{
+    RoutingManager::RoutingDiff diff = RoutingManager::DiffRoutingState(RoutingManager::RoutingState(),
+        BuildTestRoutingState(), false);
+    EXPECT_TRUE(diff.isProtoIsoDepChanged);
+    EXPECT_TRUE(diff.isTechChanged);
+    EXPECT_TRUE(diff.isDefaultAidChanged);
+    EXPECT_EQ(diff.skippedCount, 0);
+}
+
+/**
+ * @tc.name: DiffRoutingState002
+ * @tc.desc: Test only the entries differing from the ones set are set again
+ * @tc.type: FUNC
+ */
+HWTEST_F(RoutingManagerTest, DiffRoutingState002, TestSize.Level1)
+{
+    RoutingManager::RoutingState current = BuildTestRoutingState();
+    current.protoIsoDep.isSet = true;
+    current.techAB.isSet = true;
+    current.techF.isSet = true;
+    current.defaultAid.isSet = true;
+    RoutingManager::RoutingState desired = BuildTestRoutingState();
+    RoutingManager::RoutingDiff diff = RoutingManager::DiffRoutingState(current, desired, true);
+    EXPECT_FALSE(diff.isProtoIsoDepChanged);
+    EXPECT_FALSE(diff.isTechChanged);
+    EXPECT_FALSE(diff.isDefaultAidChanged);
+    EXPECT_EQ(diff.skippedCount, 3);
+
+    desired.techF.route = 0x02;
+    diff = RoutingManager::DiffRoutingState(current, desired, true);
+    EXPECT_FALSE(diff.isProtoIsoDepChanged);
+    EXPECT_TRUE(diff.isTechChanged);
+    EXPECT_FALSE(diff.isDefaultAidChanged);
+
+    // the zero length aid is removed with the aid table
+    diff = RoutingManager::DiffRoutingState(current, BuildTestRoutingState(), false);
+    EXPECT_TRUE(diff.isDefaultAidChanged);
+
+    desired = BuildTestRoutingState();
+    desired.isSecureNfcEnabled = true;
+    diff = RoutingManager::DiffRoutingState(current, desired, true);
+    EXPECT_EQ(diff.skippedCount, 0);
+}
+
+/**
+ * @tc.name: RecordRoutingState001
+ * @tc.desc: Test only the entries set successfully are recorded, the failed ones are set on the next compute
+ * @tc.type: FUNC
+ */
+HWTEST_F(RoutingManagerTest, RecordRoutingState001, TestSize.Level1)
+{
+    RoutingManager& rm = RoutingManager::GetInstance();
+    RoutingManager::RoutingState desired = BuildTestRoutingState();
+    RoutingManager::RoutingDiff diff = RoutingManager::DiffRoutingState(rm.routingState_, desired,
+        rm.isDefaultAidRouted_);
+    RoutingManager::RoutingDiff applied;
+    applied.isProtoIsoDepChanged = true;
+    rm.RecordRoutingState(desired, diff, applied);
+    EXPECT_TRUE(rm.routingState_.protoIsoDep.isSet);
+    EXPECT_FALSE(rm.routingState_.techAB.isSet);
+    EXPECT_FALSE(rm.routingState_.defaultAid.isSet);
+    EXPECT_FALSE(rm.isDefaultAidRouted_);
+    EXPECT_TRUE(rm.hasPendingChanges_);
+
+    diff = RoutingManager::DiffRoutingState(rm.routingState_, desired, rm.isDefaultAidRouted_);
+    EXPECT_FALSE(diff.isProtoIsoDepChanged);
+    EXPECT_TRUE(diff.isTechChanged);
+    EXPECT_TRUE(diff.isDefaultAidChanged);
+
+    applied.isTechChanged = true;
+    applied.isDefaultAidChanged = true;
+    rm.RecordRoutingState(desired, diff, applied);
+    EXPECT_TRUE(rm.isDefaultAidRouted_);
+    diff = RoutingManager::DiffRoutingState(rm.routingState_, desired, rm.isDefaultAidRouted_);
+    EXPECT_EQ(diff.skippedCount, 3);
+}
+}
+}
+}
@@ -16,6 +16,7 @@
 #include <thread>
 #include "nfc_service.h"
 #include "tag_host.h"
+#include "tag_native_impl.h"
 
 namespace OHOS {
 namespace NFC {
@@ -144,6 +145,99 @@ HWTEST_F(TagHostTest, ReadNdefTest001, TestSize.Level1)
     std::vector<int> ndefInfo;
     EXPECT_FALSE(tag_->DetectNdefInfo(ndefInfo));
 }
+
+/**
+ * @tc.name: DisconnectTest001
+ * @tc.desc: Test Disconnect releases the tag when the field checking is not started
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagHostTest, DisconnectTest001, TestSize.Level1)
+{
+    EXPECT_TRUE(tag_->IsTagFieldOn());
+    EXPECT_TRUE(tag_->Disconnect());
+    EXPECT_FALSE(tag_->IsTagFieldOn());
+    EXPECT_TRUE(tag_->Disconnect());
+}
+
+class TestTagListener : public INciTagInterface::ITagListener {
+public:
+    void OnTagDiscovered(uint32_t tagDiscId) override
+    {
+        discoveredCount_++;
+    }
+    void OnTagLost(uint32_t tagDiscId) override
+    {
+        lostCount_++;
+    }
+    int discoveredCount_ = 0;
+    int lostCount_ = 0;
+};
+
+/**
+ * @tc.name: TagRegistryTest001
+ * @tc.desc: Test the tag lost of a stale generation is ignored
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagHostTest, TagRegistryTest001, TestSize.Level1)
+{
+    const uint32_t tagDiscId = 1;
+    const uint32_t INVALID_TAG_DISC_ID = 0x100;
+    std::shared_ptr<TestTagListener> listener = std::make_shared<TestTagListener>();
+    TagNativeImpl& tagNativeImpl = TagNativeImpl::GetInstance();
+    tagNativeImpl.SetTagListener(listener);
+
+    std::shared_ptr<TagHost> first = std::make_shared<TagHost>(
+        tagTechList, tagRfDiscIdList, tagActivatedProtocols, tagUid, tagPollBytes, tagActivatedBytes,
+        g_connectedTechIndex);
+    tagNativeImpl.OnTagDiscovered(tagDiscId, first);
+    EXPECT_EQ(tagNativeImpl.GetTag(tagDiscId).lock(), first);
+    EXPECT_TRUE(tagNativeImpl.GetTag(INVALID_TAG_DISC_ID).expired());
+    uint32_t generation = first->GetGeneration();
+
+    std::shared_ptr<TagHost> second = std::make_shared<TagHost>(
+        tagTechList, tagRfDiscIdList, tagActivatedProtocols, "04A1B2C3", tagPollBytes, tagActivatedBytes,
+        g_connectedTechIndex);
+    EXPECT_NE(second, first);
+    tagNativeImpl.OnTagDiscovered(tagDiscId, second);
+    tagNativeImpl.OnTagLost(tagDiscId, generation);
+    EXPECT_EQ(listener->lostCount_, 0);
+    EXPECT_EQ(tagNativeImpl.GetTag(tagDiscId).lock(), second);
+
+    tagNativeImpl.OnTagLost(tagDiscId, second->GetGeneration());
+    EXPECT_EQ(listener->lostCount_, 1);
+    EXPECT_TRUE(tagNativeImpl.GetTag(tagDiscId).expired());
+    EXPECT_EQ(listener->discoveredCount_, 2);
+}
+
+/**
+ * @tc.name: TagRegistryTest002
+ * @tc.desc: Test the handle of a lost tag expires and never resolves to the next tag with the same id
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagHostTest, TagRegistryTest002, TestSize.Level1)
+{
+    const uint32_t tagDiscId = 2;
+    std::shared_ptr<TestTagListener> listener = std::make_shared<TestTagListener>();
+    TagNativeImpl& tagNativeImpl = TagNativeImpl::GetInstance();
+    tagNativeImpl.SetTagListener(listener);
+    std::shared_ptr<TagHost> lost = std::make_shared<TagHost>(
+        tagTechList, tagRfDiscIdList, tagActivatedProtocols, tagUid, tagPollBytes, tagActivatedBytes,
+        g_connectedTechIndex);
+    tagNativeImpl.OnTagDiscovered(tagDiscId, lost);
+    std::weak_ptr<TagHost> lostHandle = tagNativeImpl.GetTag(tagDiscId);
+    tagNativeImpl.OnTagLost(tagDiscId, lost->GetGeneration());
+    lost = nullptr;
+    EXPECT_TRUE(lostHandle.expired());
+
+    std::shared_ptr<TagHost> next = std::make_shared<TagHost>(
+        tagTechList, tagRfDiscIdList, tagActivatedProtocols, "04A1B2C3", tagPollBytes, tagActivatedBytes,
+        g_connectedTechIndex);
+    tagNativeImpl.OnTagDiscovered(tagDiscId, next);
+    EXPECT_TRUE(lostHandle.expired());
+    EXPECT_EQ(tagNativeImpl.GetTag(tagDiscId).lock(), next);
+    EXPECT_EQ(listener->lostCount_, 1);
+}
+}
 }
 }
 }
\ No newline at end of file
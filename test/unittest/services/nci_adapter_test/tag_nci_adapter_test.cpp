@@ -12,10 +12,23 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#define private public
+#define protected public
+
 #include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <iostream>
 #include <thread>
+#include "nfc_sdk_common.h"
 #include "nfc_service.h"
-#include "tag_nci_adapter.h"
+#include "tag_nci_adapter_common.h"
+#include "tag_nci_adapter_ntf.h"
+#include "tag_nci_adapter_rw.h"
+#include "tag_native_impl.h"
+#include "tag_rtt_estimator.h"
+#include "tag_tech_traits.h"
+#include "tag_transceive_profile.h"
 
 namespace OHOS {
 namespace NFC {
@@ -61,36 +74,26 @@ void TagNciAdapterTest::TearDown()
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest001, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
-    std::vector<uint16_t> systemCode = {0x88B4, 0, 0};
-    tNFA_ACTIVATED activated;
-    activated.params.t3t.num_system_codes = 1;
-    activated.params.t3t.p_system_codes = &systemCode[0];
-    activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_POLL_A;
-    activated.activate_ntf.rf_tech_param.param.pa.sel_rsp = SAK_MIFARE_UL_1;
-    activated.activate_ntf.rf_tech_param.param.pa.sens_res[0] = ATQA_MIFARE_UL_0;
-    activated.activate_ntf.rf_tech_param.param.pa.sens_res[1] = ATQA_MIFARE_UL_1;
-    activated.activate_ntf.rf_tech_param.param.pa.nfcid1[0] = MANUFACTURER_ID_NXP;
-
-    activated.activate_ntf.protocol = NFA_PROTOCOL_T2T;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(adapterObj->IsNdefFormattable());
-
-    activated.activate_ntf.protocol = NFA_PROTOCOL_T3T;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(adapterObj->IsNdefFormattable());
-
-    activated.activate_ntf.protocol = NFA_PROTOCOL_ISO_DEP;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(!adapterObj->IsNdefFormattable());
-
-    activated.activate_ntf.protocol = NFA_PROTOCOL_T1T;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(adapterObj->IsNdefFormattable());
-
-    activated.activate_ntf.protocol = NFA_PROTOCOL_INVALID;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(!adapterObj->IsNdefFormattable());
+    TagNciAdapterCommon& common = TagNciAdapterCommon::GetInstance();
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
+    common.ResetTag();
+    common.isMifareUltralight_ = true;
+    common.connectedProtocol_ = NFA_PROTOCOL_T2T;
+    EXPECT_TRUE(rw.IsNdefFormattable());
+
+    common.isFelicaLite_ = true;
+    common.connectedProtocol_ = NFA_PROTOCOL_T3T;
+    EXPECT_TRUE(rw.IsNdefFormattable());
+
+    common.connectedProtocol_ = NFA_PROTOCOL_ISO_DEP;
+    EXPECT_TRUE(!rw.IsNdefFormattable());
+
+    common.connectedProtocol_ = NFA_PROTOCOL_T1T;
+    EXPECT_TRUE(rw.IsNdefFormattable());
+
+    common.connectedProtocol_ = NFA_PROTOCOL_INVALID;
+    EXPECT_TRUE(!rw.IsNdefFormattable());
+    common.ResetTag();
 }
 
 /**
@@ -100,21 +103,22 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest001, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest002, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
+    TagNciAdapterCommon::GetInstance().ResetTag();
 
-    tNFA_STATUS statusConnect = adapterObj->Connect(0);
-    EXPECT_TRUE(statusConnect == NFA_STATUS_BUSY);
+    tNFA_STATUS statusConnect = rw.Connect(0);
+    EXPECT_TRUE(statusConnect == NFA_STATUS_FAILED);
 
-    bool statusDisconnect = adapterObj->Disconnect();
+    bool statusDisconnect = rw.Disconnect();
     EXPECT_FALSE(!statusDisconnect);
 
-    bool statusReconnect = adapterObj->Reconnect();
+    bool statusReconnect = rw.Reconnect();
     EXPECT_TRUE(!statusReconnect);
 
-    EXPECT_TRUE(!NCI::TagNciAdapter::GetInstance().IsReconnecting());
+    EXPECT_TRUE(!TagNciAdapterNtf::GetInstance().IsReconnecting());
 
-    adapterObj->ResetTag();
-    EXPECT_TRUE(!NCI::TagNciAdapter::GetInstance().IsReconnecting());
+    TagNciAdapterCommon::GetInstance().ResetTag();
+    EXPECT_TRUE(!TagNciAdapterNtf::GetInstance().IsReconnecting());
 }
 
 /**
@@ -124,24 +128,25 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest002, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest003, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
     std::string request = "00a40400";
     std::string response;
-    EXPECT_TRUE(adapterObj->Transceive(request, response) == NFA_STATUS_BUSY);
+    EXPECT_TRUE(rw.Transceive(request, response) == NFA_STATUS_BUSY);
+    EXPECT_TRUE(response.empty());
 
     unsigned char data[] = {0x00, 0xa4, 0x04, 0x00};
-    NCI::TagNciAdapter::GetInstance().HandleTranceiveData(NFA_STATUS_OK, data, 4);
-    NCI::TagNciAdapter::GetInstance().HandleTranceiveData(NFA_STATUS_CONTINUE, data, 4);
+    rw.HandleTranceiveData(NFA_STATUS_OK, data, 4);
+    rw.HandleTranceiveData(NFA_STATUS_CONTINUE, data, 4);
 
-    NCI::TagNciAdapter::GetInstance().HandleFieldCheckResult(NFA_STATUS_OK);
+    rw.HandleFieldCheckResult(NFA_STATUS_OK);
 
-    NCI::TagNciAdapter::GetInstance().HandleSelectResult(0);
-    NCI::TagNciAdapter::GetInstance().HandleDeactivatedResult(0);
-    adapterObj->ResetTagFieldOnFlag();
+    TagNciAdapterNtf::GetInstance().HandleSelectResult(0);
+    rw.HandleDeactivatedResult(0);
+    rw.ResetTagFieldOnFlag();
 
-    EXPECT_TRUE(adapterObj->GetTimeout((MAX_NUM_TECHNOLOGY + 1)) == DEFAULT_TIMEOUT);
-    adapterObj->ResetTimeout();
-    EXPECT_TRUE(adapterObj->GetTimeout(TagHost::TARGET_TYPE_ISO14443_3A) == ISO14443_3A_DEFAULT_TIMEOUT);
+    EXPECT_TRUE(rw.GetTimeout((MAX_NUM_TECHNOLOGY + 1)) == DEFAULT_TIMEOUT);
+    TagNciAdapterCommon::GetInstance().ResetTimeout();
+    EXPECT_TRUE(rw.GetTimeout(TagHost::TARGET_TYPE_ISO14443_3A) == ISO14443_3A_DEFAULT_TIMEOUT);
 }
 
 /**
@@ -151,32 +156,34 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest003, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest004, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
-    EXPECT_TRUE(!adapterObj->SetReadOnly());
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
+    TagNciAdapterCommon::GetInstance().ResetTag();
+    EXPECT_TRUE(!rw.SetReadOnly());
 
     std::string response;
-    adapterObj->ReadNdef(response);
+    rw.ReadNdef(response);
     EXPECT_TRUE(response.empty());
-    NCI::TagNciAdapter::GetInstance().HandleReadComplete(NFA_STATUS_BUSY);
+    ntf.HandleReadComplete(NFA_STATUS_BUSY);
 
     std::string command = "00a40400";
-    EXPECT_TRUE(!adapterObj->WriteNdef(command));
-    NCI::TagNciAdapter::GetInstance().HandleWriteComplete(NFA_STATUS_BUSY);
+    EXPECT_TRUE(!rw.WriteNdef(command));
+    ntf.HandleWriteComplete(NFA_STATUS_BUSY);
 
-    EXPECT_TRUE(!adapterObj->FormatNdef());
-    NCI::TagNciAdapter::GetInstance().HandleFormatComplete(NFA_STATUS_BUSY);
+    EXPECT_TRUE(!rw.FormatNdef());
+    ntf.HandleFormatComplete(NFA_STATUS_BUSY);
 
-    EXPECT_TRUE(!adapterObj->IsNdefFormatable());
+    EXPECT_TRUE(!rw.IsNdefFormatable());
 
-    adapterObj->HandleNdefCheckResult(NFA_STATUS_BUSY, 0, 0xFFFFFFFF, 0);
-    adapterObj->HandleNdefCheckResult(NFA_STATUS_OK, 0, 0xFFFFFFFF, 0);
-    adapterObj->HandleNdefCheckResult(NFA_STATUS_FAILED, 0, 0xFFFFFFFF, 0);
-    adapterObj->HandleNdefCheckResult(NFA_STATUS_BUSY, 0, 0xFFFFFF00, 0);
-    adapterObj->HandleNdefCheckResult(NFA_STATUS_FAILED, 0, 0xFFFFFF04, 0);
-    adapterObj->HandleNdefCheckResult(NFA_STATUS_REJECTED, 0, 0xFFFFFFFF, 0);
+    rw.HandleNdefCheckResult(NFA_STATUS_BUSY, 0, 0xFFFFFFFF, 0);
+    rw.HandleNdefCheckResult(NFA_STATUS_OK, 0, 0xFFFFFFFF, 0);
+    rw.HandleNdefCheckResult(NFA_STATUS_FAILED, 0, 0xFFFFFFFF, 0);
+    rw.HandleNdefCheckResult(NFA_STATUS_BUSY, 0, 0xFFFFFF00, 0);
+    rw.HandleNdefCheckResult(NFA_STATUS_FAILED, 0, 0xFFFFFF04, 0);
+    rw.HandleNdefCheckResult(NFA_STATUS_REJECTED, 0, 0xFFFFFFFF, 0);
 
     std::vector<int> ndefInfo{};
-    EXPECT_TRUE(!adapterObj->DetectNdefInfo(ndefInfo));
+    EXPECT_TRUE(!rw.DetectNdefInfo(ndefInfo));
 }
 
 /**
@@ -186,28 +193,29 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest004, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest005, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
-    EXPECT_TRUE(!adapterObj->SetReadOnly());
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
+    EXPECT_TRUE(!rw.SetReadOnly());
 
-    adapterObj->OnRfDiscLock();
-    adapterObj->OffRfDiscLock();
+    rw.OnRfDiscLock();
+    rw.OffRfDiscLock();
 
-    NCI::TagNciAdapter::GetInstance().AbortWait();
+    rw.AbortWait();
 
-    tNFA_DISC_RESULT discoveryData;
-    adapterObj->GetMultiTagTechsFromData(discoveryData);
+    tNFA_DISC_RESULT discoveryData{};
+    ntf.GetMultiTagTechsFromData(discoveryData);
 
     tNFA_ACTIVATED activated{};
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
-    adapterObj->SelectTheFirstTag();
-    adapterObj->SelectTheNextTag();
+    ntf.SelectTheFirstTag();
+    ntf.SelectTheNextTag();
 
-    adapterObj->SetIsMultiTag(true);
-    EXPECT_FALSE(adapterObj->GetIsMultiTag());
+    ntf.SetIsMultiTag(true);
+    EXPECT_FALSE(ntf.GetIsMultiTag());
 
-    adapterObj->SetDiscRstEvtNum(TagHost::TARGET_TYPE_ISO14443_3A);
-    EXPECT_TRUE(adapterObj->GetDiscRstEvtNum() == TagHost::TARGET_TYPE_ISO14443_3A);
+    ntf.SetDiscRstEvtNum(TagHost::TARGET_TYPE_ISO14443_3A);
+    EXPECT_TRUE(ntf.GetDiscRstEvtNum() == TagHost::TARGET_TYPE_ISO14443_3A);
 }
 
 /**
@@ -217,8 +225,8 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest005, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest006, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
-    adapterObj->HandleDiscResult(nullptr);
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
+    ntf.HandleDiscResult(nullptr);
 
     // test with valid event data.
     tNFA_CONN_EVT_DATA eventData;
@@ -226,18 +234,18 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest006, TestSize.Level1)
     discoveryNtf.more = NCI_DISCOVER_NTF_MORE;
     discoveryNtf.protocol = NFA_PROTOCOL_NFC_DEP;
     eventData.disc_result.discovery_ntf = discoveryNtf;
-    adapterObj->HandleDiscResult(&eventData);
+    ntf.HandleDiscResult(&eventData);
 
     discoveryNtf.more = NCI_DISCOVER_NTF_LAST;
     discoveryNtf.protocol = NFA_PROTOCOL_ISO_DEP;
     eventData.disc_result.discovery_ntf = discoveryNtf;
-    adapterObj->HandleDiscResult(&eventData);
+    ntf.HandleDiscResult(&eventData);
 
     discoveryNtf.more = NCI_DISCOVER_NTF_LAST;
     discoveryNtf.protocol = NFC_PROTOCOL_MIFARE;
     eventData.disc_result.discovery_ntf = discoveryNtf;
-    adapterObj->HandleDiscResult(&eventData);
-    EXPECT_TRUE(adapterObj != nullptr);
+    ntf.HandleDiscResult(&eventData);
+    EXPECT_LT(ntf.GetDiscRstEvtNum(), MAX_NUM_TECHNOLOGY);
 }
 
 /**
@@ -247,7 +255,7 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest006, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest007, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
     std::vector<uint16_t> systemCode = {0x88B4, 0, 0};
     tNFA_ACTIVATED activated;
     activated.activate_ntf.protocol = NCI_PROTOCOL_T1T;
@@ -258,21 +266,21 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest007, TestSize.Level1)
     activated.activate_ntf.rf_tech_param.param.pa.sens_res[0] = ATQA_MIFARE_UL_0;
     activated.activate_ntf.rf_tech_param.param.pa.sens_res[1] = ATQA_MIFARE_UL_1;
     activated.activate_ntf.rf_tech_param.param.pa.nfcid1[0] = MANUFACTURER_ID_NXP;
-    adapterObj->SetDiscRstEvtNum(1);
-    adapterObj->BuildTagInfo(activated);
+    ntf.SetDiscRstEvtNum(1);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.protocol = NCI_PROTOCOL_T2T;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.protocol = NCI_PROTOCOL_T3BT;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.protocol = NCI_PROTOCOL_T3T;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.protocol = NCI_PROTOCOL_15693;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(adapterObj != nullptr);
+    ntf.BuildTagInfo(activated);
+    EXPECT_LT(ntf.GetDiscRstEvtNum(), MAX_NUM_TECHNOLOGY);
 }
 
 /**
@@ -282,7 +290,7 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest007, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest008, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
     std::vector<uint16_t> systemCode = {0x88B4, 0, 0};
     tNFA_ACTIVATED activated;
     activated.activate_ntf.protocol = NCI_PROTOCOL_ISO_DEP;
@@ -293,22 +301,22 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest008, TestSize.Level1)
     activated.activate_ntf.rf_tech_param.param.pa.sens_res[0] = ATQA_MIFARE_UL_0;
     activated.activate_ntf.rf_tech_param.param.pa.sens_res[1] = ATQA_MIFARE_UL_1;
     activated.activate_ntf.rf_tech_param.param.pa.nfcid1[0] = MANUFACTURER_ID_NXP;
-    adapterObj->SetDiscRstEvtNum(1);
+    ntf.SetDiscRstEvtNum(1);
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_POLL_B;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_POLL_F;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = 0x0F;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NFC_DISCOVERY_TYPE_LISTEN_A_ACTIVE;
     activated.activate_ntf.rf_tech_param.param.pa.sens_res[0] = ATQA_MIFARE_DESFIRE_0;
     activated.activate_ntf.rf_tech_param.param.pa.sens_res[1] = ATQA_MIFARE_DESFIRE_1;
     activated.activate_ntf.rf_tech_param.param.pa.sel_rsp = SAK_MIFARE_DESFIRE;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(adapterObj != nullptr);
+    ntf.BuildTagInfo(activated);
+    EXPECT_LT(ntf.GetDiscRstEvtNum(), MAX_NUM_TECHNOLOGY);
 }
 
 /**
@@ -318,9 +326,9 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest008, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest009, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
-    adapterObj->ResetTag();
-    adapterObj->SetDiscRstEvtNum(1);
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
+    TagNciAdapterCommon::GetInstance().ResetTag();
+    ntf.SetDiscRstEvtNum(1);
     std::vector<uint16_t> systemCode = {0x88B4, 0, 0};
     tNFA_ACTIVATED activated;
     activated.params.t3t.p_system_codes = &systemCode[0];
@@ -330,15 +338,15 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest009, TestSize.Level1)
     activated.activate_ntf.intf_param.type = NFC_INTERFACE_ISO_DEP;
     activated.activate_ntf.intf_param.intf_param.pa_iso.his_byte[0] = 0;
     activated.activate_ntf.intf_param.intf_param.pa_iso.his_byte_len = 1;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.intf_param.intf_param.pa_iso.his_byte[0] = 0;
     activated.activate_ntf.intf_param.intf_param.pa_iso.his_byte_len = 0;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.intf_param.type = NFC_INTERFACE_FRAME;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(adapterObj != nullptr);
+    ntf.BuildTagInfo(activated);
+    EXPECT_LT(ntf.GetDiscRstEvtNum(), MAX_NUM_TECHNOLOGY);
 }
 
 /**
@@ -348,9 +356,9 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest009, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0010, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
-    adapterObj->ResetTag();
-    adapterObj->SetDiscRstEvtNum(1);
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
+    TagNciAdapterCommon::GetInstance().ResetTag();
+    ntf.SetDiscRstEvtNum(1);
     std::vector<uint16_t> systemCode = {0x88B4, 0, 0};
     std::vector<uint8_t> hisByte = {0};
     tNFA_ACTIVATED activated;
@@ -362,24 +370,24 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0010, TestSize.Level1)
     activated.activate_ntf.intf_param.type = NFC_INTERFACE_ISO_DEP;
     activated.activate_ntf.intf_param.intf_param.pa_iso.his_byte[0] = 0;
     activated.activate_ntf.intf_param.intf_param.pa_iso.his_byte_len = 1;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
     activated.activate_ntf.rf_tech_param.param.pb.sensb_res_len = NFC_NFCID0_MAX_LEN + 1;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
     activated.activate_ntf.intf_param.type = NFC_INTERFACE_NFC_DEP;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.protocol = NCI_PROTOCOL_ISO_DEP;
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_POLL_F;
     activated.params.t3t.num_system_codes = 1;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
     activated.params.t3t.num_system_codes = 0;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.protocol = NCI_PROTOCOL_T3BT;
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_POLL_B;
     activated.activate_ntf.intf_param.intf_param.pa_iso.his_byte_len = 0;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(adapterObj != nullptr);
+    ntf.BuildTagInfo(activated);
+    EXPECT_LT(ntf.GetDiscRstEvtNum(), MAX_NUM_TECHNOLOGY);
 }
 
 /**
@@ -389,7 +397,7 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0010, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0011, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
     std::vector<uint16_t> systemCode = {0x88B4, 0, 0};
     tNFA_ACTIVATED activated;
     activated.activate_ntf.protocol = NCI_PROTOCOL_T1T;
@@ -401,38 +409,38 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0011, TestSize.Level1)
     activated.activate_ntf.rf_tech_param.param.pa.nfcid1[0] = MANUFACTURER_ID_NXP;
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_POLL_A_ACTIVE;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_LISTEN_A;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_LISTEN_A_ACTIVE;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NFC_DISCOVERY_TYPE_POLL_B_PRIME;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_LISTEN_B;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NFC_DISCOVERY_TYPE_LISTEN_B_PRIME;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_POLL_F_ACTIVE;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_LISTEN_F;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_LISTEN_F_ACTIVE;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_POLL_V;
-    adapterObj->BuildTagInfo(activated);
+    ntf.BuildTagInfo(activated);
 
     activated.activate_ntf.rf_tech_param.mode = NCI_DISCOVERY_TYPE_LISTEN_ISO15693;
-    adapterObj->BuildTagInfo(activated);
-    EXPECT_TRUE(adapterObj != nullptr);
+    ntf.BuildTagInfo(activated);
+    EXPECT_LT(ntf.GetDiscRstEvtNum(), MAX_NUM_TECHNOLOGY);
 }
 
 /**
@@ -442,21 +450,357 @@ HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0011, TestSize.Level1)
  */
 HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0012, TestSize.Level1)
 {
-    std::shared_ptr<NCI::TagNciAdapter> adapterObj = std::make_shared<NCI::TagNciAdapter>();
-    adapterObj->SetDiscRstEvtNum(1);
+    TagNciAdapterNtf& ntf = TagNciAdapterNtf::GetInstance();
+    ntf.SetDiscRstEvtNum(1);
     tNFA_DISC_RESULT discoveryData;
     discoveryData.discovery_ntf.rf_disc_id = NFA_PROTOCOL_NFC_DEP;
     discoveryData.discovery_ntf.protocol = NFA_PROTOCOL_NFC_DEP;
-    adapterObj->GetMultiTagTechsFromData(discoveryData);
-    adapterObj->SelectTheFirstTag();
+    ntf.GetMultiTagTechsFromData(discoveryData);
+    ntf.SelectTheFirstTag();
 
-    adapterObj->SetDiscRstEvtNum(2);
+    ntf.SetDiscRstEvtNum(2);
     discoveryData.discovery_ntf.rf_disc_id = NFA_PROTOCOL_ISO_DEP;
     discoveryData.discovery_ntf.protocol = NFA_PROTOCOL_ISO_DEP;
-    adapterObj->GetMultiTagTechsFromData(discoveryData);
-    adapterObj->SelectTheFirstTag();
-    adapterObj->SelectTheNextTag();
-    EXPECT_TRUE(adapterObj != nullptr);
+    ntf.GetMultiTagTechsFromData(discoveryData);
+    ntf.SelectTheFirstTag();
+    ntf.SelectTheNextTag();
+    EXPECT_LT(ntf.GetDiscRstEvtNum(), MAX_NUM_TECHNOLOGY);
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0013
+ * @tc.desc: Test tag sessions and inventory of multiple tags
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0013, TestSize.Level1)
+{
+    TagNciAdapterCommon& common = TagNciAdapterCommon::GetInstance();
+    common.ResetTag();
+    common.AddTagSession(1, NFA_PROTOCOL_ISO_DEP, NFA_INTERFACE_ISO_DEP, "5B7FCFA9",
+        {TagNciAdapterCommon::TARGET_TYPE_ISO14443_4, TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A});
+    EXPECT_TRUE(common.IsActiveTagSession(2));
+    common.AddTagSession(2, NFA_PROTOCOL_T2T, NFA_INTERFACE_FRAME, "04A1B2C3D4E5F6",
+        {TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A});
+    EXPECT_TRUE(common.IsActiveTagSession(2));
+    EXPECT_FALSE(common.IsActiveTagSession(1));
+
+    common.technologyTimeoutsTable_[TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A] = DEFAULT_TIMEOUT;
+    common.SwitchTagSession(1, NFA_INTERFACE_ISO_DEP);
+    EXPECT_TRUE(common.IsActiveTagSession(1));
+    EXPECT_EQ(common.technologyTimeoutsTable_[TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A],
+        ISO14443_3A_DEFAULT_TIMEOUT);
+    common.SwitchTagSession(2, NFA_INTERFACE_FRAME);
+    EXPECT_EQ(common.technologyTimeoutsTable_[TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A], DEFAULT_TIMEOUT);
+    EXPECT_EQ(common.connectedRfIface_, NFA_INTERFACE_FRAME);
+
+    // an unknown tag keeps the selected one and its timeouts.
+    common.SwitchTagSession(3, NFA_INTERFACE_ISO_DEP);
+    EXPECT_TRUE(common.IsActiveTagSession(2));
+    EXPECT_EQ(common.technologyTimeoutsTable_[TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A], DEFAULT_TIMEOUT);
+
+    std::vector<INciTagInterface::TagInventoryItem> inventory = TagNativeImpl::GetInstance().GetTagInventory();
+    ASSERT_EQ(inventory.size(), 2);
+    EXPECT_EQ(inventory[0].rfDiscId, 1);
+    EXPECT_EQ(inventory[0].uid, "5B7FCFA9");
+    EXPECT_EQ(inventory[0].techList.size(), 2);
+    EXPECT_EQ(inventory[1].uid, "04A1B2C3D4E5F6");
+
+    // the sessions are gone with the tags, a single tag is always active.
+    common.ResetTag();
+    EXPECT_TRUE(TagNativeImpl::GetInstance().GetTagInventory().empty());
+    EXPECT_TRUE(common.IsActiveTagSession(1));
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0014
+ * @tc.desc: Test the soft deadline learned from response times
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0014, TestSize.Level1)
+{
+    const uint32_t rttUs = 5000;
+    const uint32_t isoDepFwt = 77;
+    TagRttEstimator estimator;
+    uint32_t key = TagRttEstimator::BuildKey(1, TagNciAdapterCommon::TARGET_TYPE_ISO14443_4, 0xA4);
+    // the full timeout is used until enough response times observed
+    EXPECT_EQ(estimator.GetSoftTimeout(key, DEFAULT_TIMEOUT, 0), DEFAULT_TIMEOUT);
+    for (int i = 0; i < 3; i++) { // 3 samples
+        estimator.OnResponse(key, rttUs, false);
+    }
+    uint32_t softTimeout = estimator.GetSoftTimeout(key, DEFAULT_TIMEOUT, 0);
+    EXPECT_LT(softTimeout, DEFAULT_TIMEOUT);
+    EXPECT_GT(softTimeout * 1000, rttUs); // 1000 us per ms
+    EXPECT_EQ(estimator.GetSoftTimeout(key, DEFAULT_TIMEOUT, isoDepFwt), isoDepFwt);
+
+    // the soft deadline backs off after a command is overdue, but never exceeds the full timeout
+    estimator.OnOverdue(key, softTimeout);
+    EXPECT_GT(estimator.GetSoftTimeout(key, DEFAULT_TIMEOUT, 0), softTimeout);
+    EXPECT_LE(estimator.GetSoftTimeout(key, DEFAULT_TIMEOUT, 0), DEFAULT_TIMEOUT);
+    // the late response of the overdue command is still a sample
+    estimator.OnResponse(key, softTimeout * 1000 * 2, true); // 1000 us per ms, 2 times the soft deadline
+    EXPECT_EQ(estimator.lateResponses_, 1u);
+    EXPECT_GT(estimator.GetSoftTimeout(key, DEFAULT_TIMEOUT, 0), softTimeout);
+    estimator.OnTimeout(key);
+    EXPECT_EQ(estimator.timeouts_, 1u);
+
+    estimator.Reset();
+    EXPECT_EQ(estimator.GetSoftTimeout(key, DEFAULT_TIMEOUT, 0), DEFAULT_TIMEOUT);
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0015
+ * @tc.desc: Test the asynchronous operations rejected without active tag
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0015, TestSize.Level1)
+{
+    bool isCalled = false;
+    auto callback = [&isCalled](int status, const std::string& response) { isCalled = true; };
+    TagNciAdapterCommon::GetInstance().ResetTag();
+    EXPECT_EQ(TagNciAdapterRw::GetInstance().TransceiveAsync("00A4040000", callback),
+        TagNciAdapterRw::INVALID_REQUEST_ID);
+    EXPECT_EQ(TagNciAdapterRw::GetInstance().TransceiveAsync("00A4040000", nullptr),
+        TagNciAdapterRw::INVALID_REQUEST_ID);
+    EXPECT_EQ(TagNciAdapterRw::GetInstance().ReadNdefAsync(callback), TagNciAdapterRw::INVALID_REQUEST_ID);
+    EXPECT_FALSE(TagNciAdapterRw::GetInstance().HandleAsyncReadComplete(NFA_STATUS_OK));
+    EXPECT_FALSE(isCalled);
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0016
+ * @tc.desc: Test the transceive profiles of the protocols and the hex conversion of the frames
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0016, TestSize.Level1)
+{
+    EXPECT_EQ(TagTransceiveProfile::Get(NFA_PROTOCOL_T2T).rspHandler, TagTransceiveProfile::RSP_T2T_NACK);
+    EXPECT_EQ(TagTransceiveProfile::Get(NFC_PROTOCOL_MIFARE).rspHandler, TagTransceiveProfile::RSP_MFC);
+    EXPECT_EQ(TagTransceiveProfile::Get(NFA_PROTOCOL_ISO_DEP).rfInterface, NFA_INTERFACE_ISO_DEP);
+    EXPECT_EQ(TagTransceiveProfile::Get(NFA_PROTOCOL_T3T).ndefType, KITS::NFC_FORUM_TYPE_3);
+    EXPECT_EQ(TagTransceiveProfile::Get(NFA_PROTOCOL_T5T).ndefType, KITS::NFC_FORUM_TYPE_UNKNOWN);
+    EXPECT_FALSE(TagTransceiveProfile::Get(NFA_PROTOCOL_T5T).canReconnect);
+    EXPECT_FALSE(TagTransceiveProfile::Get(NFA_PROTOCOL_INVALID).canReconnect);
+
+    std::basic_string<uint8_t> bytes;
+    ASSERT_TRUE(TagTransceiveProfile::DecodeHex("00a4040007A0000000041010", bytes));
+    ASSERT_EQ(bytes.size(), 12);
+    EXPECT_EQ(bytes[1], 0xA4);
+    EXPECT_EQ(bytes[11], 0x10);
+    std::string hex = "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF";
+    TagTransceiveProfile::EncodeHex(bytes.data(), bytes.size(), hex);
+    EXPECT_EQ(hex, "00A4040007A0000000041010");
+    EXPECT_FALSE(TagTransceiveProfile::DecodeHex("00G4", bytes));
+    EXPECT_TRUE(bytes.empty());
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0017
+ * @tc.desc: Test the cost of the frame conversion of a transceive, the NfcSdkCommon conversion before and the
+ * reused buffers of TagTransceiveProfile after, both giving the same frames
+ * @tc.type: PERF
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0017, TestSize.Level1)
+{
+    const int loopCount = 10000;
+    const uint32_t rspLen = 258; // a short APDU response with SW
+    const std::string request = "00B0000000";
+    std::vector<uint8_t> rsp(rspLen, 0x5A);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<unsigned char> legacyRequest;
+    std::string legacyResponse;
+    for (int i = 0; i < loopCount; i++) {
+        legacyRequest.clear();
+        KITS::NfcSdkCommon::HexStringToBytes(request, legacyRequest);
+        legacyResponse = KITS::NfcSdkCommon::BytesVecToHexString(rsp.data(), rsp.size());
+    }
+    auto legacyUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    std::basic_string<uint8_t> leanRequest;
+    std::string leanResponse;
+    for (int i = 0; i < loopCount; i++) {
+        ASSERT_TRUE(TagTransceiveProfile::DecodeHex(request, leanRequest));
+        TagTransceiveProfile::EncodeHex(rsp.data(), rsp.size(), leanResponse);
+    }
+    auto leanUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    std::cout << " TagNciAdapterTest0017 " << loopCount << " transceives cost " << legacyUs << " us before, "
+        << leanUs << " us after." << std::endl;
+
+    EXPECT_EQ(std::basic_string<uint8_t>(legacyRequest.begin(), legacyRequest.end()), leanRequest);
+    EXPECT_EQ(legacyResponse, leanResponse);
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0018
+ * @tc.desc: Test the traits of the tag technologies and the default timeouts reset from them
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0018, TestSize.Level1)
+{
+    EXPECT_EQ(KITS::GetTagTechTraits(KITS::TagTechnology::NFC_ISODEP_TECH).maxTransceiveLength, 0xFEFF);
+    EXPECT_EQ(KITS::GetTagTechTraits(KITS::TagTechnology::NFC_NDEF_TECH).maxTransceiveLength, 0);
+    EXPECT_EQ(KITS::GetTagTechTraits(-1).tech, KITS::TagTechnology::NFC_INVALID_TECH);
+    EXPECT_EQ(KITS::GetTagTechTraits(MAX_NUM_TECHNOLOGY).tech, KITS::TagTechnology::NFC_INVALID_TECH);
+
+    TagNciAdapterCommon::GetInstance().ResetTimeout();
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
+    EXPECT_EQ(rw.GetTimeout(TagHost::TARGET_TYPE_ISO14443_3A), static_cast<uint32_t>(ISO14443_3A_DEFAULT_TIMEOUT));
+    EXPECT_EQ(rw.GetTimeout(TagHost::TARGET_TYPE_FELICA),
+        KITS::GetTagTechTraits(TagHost::TARGET_TYPE_FELICA).defaultTimeout);
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0019
+ * @tc.desc: Test the frame waiting time floor, the command codes keying the response times and the response
+ * of an overdue command
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0019, TestSize.Level1)
+{
+    const uint32_t fwtFwi8 = 78; // 4096 * 2^8 / 13.56MHz, rounded up to ms
+    TagNciAdapterCommon& common = TagNciAdapterCommon::GetInstance();
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
+    common.ResetTag();
+    common.ResetTimeout();
+
+    // NFC-B takes the FWI of SENSB_RES as the floor, without changing the configured timeout
+    tNFA_ACTIVATED activated {};
+    activated.activate_ntf.rf_tech_param.mode = NFC_DISCOVERY_TYPE_POLL_B;
+    activated.activate_ntf.rf_tech_param.param.pb.sensb_res_len = 11; // 11 bytes without the first one
+    activated.activate_ntf.rf_tech_param.param.pb.sensb_res[10] = 0x81; // 10 for protocol info byte 3, FWI 8
+    TagNciAdapterNtf::GetInstance().SetIsoDepFwt(activated, TagNciAdapterCommon::TARGET_TYPE_ISO14443_4);
+    common.connectedType_ = TagNciAdapterCommon::TARGET_TYPE_ISO14443_4;
+    common.connectedProtocol_ = NFA_PROTOCOL_ISO_DEP;
+    EXPECT_EQ(rw.GetFwtFloor(), fwtFwi8);
+    EXPECT_EQ(rw.GetFullTimeout(), static_cast<uint32_t>(ISO14443_3A_DEFAULT_TIMEOUT));
+
+    // NFC-A keeps the timeout from FWI as the configured one, the floor is the real frame waiting time
+    activated.activate_ntf.rf_tech_param.mode = NFC_DISCOVERY_TYPE_POLL_A;
+    activated.activate_ntf.intf_param.intf_param.pa_iso.fwi = 0;
+    TagNciAdapterNtf::GetInstance().SetIsoDepFwt(activated, TagNciAdapterCommon::TARGET_TYPE_ISO14443_4);
+    EXPECT_EQ(rw.GetFwtFloor(), 1u);
+    EXPECT_EQ(rw.GetFullTimeout(), static_cast<uint32_t>(ISO14443_3A_DEFAULT_TIMEOUT));
+
+    const uint32_t cmdCodeMask = 0xFF;
+    EXPECT_EQ(rw.GetTransceiveKey({0x00, 0xA4, 0x04, 0x00}) & cmdCodeMask, 0xA4);
+    common.connectedType_ = TagNciAdapterCommon::TARGET_TYPE_FELICA;
+    common.connectedProtocol_ = NFA_PROTOCOL_T3T;
+    EXPECT_EQ(rw.GetTransceiveKey({0x10, 0x06, 0x01}) & cmdCodeMask, 0x06);
+    common.connectedType_ = TagNciAdapterCommon::TARGET_TYPE_V;
+    common.connectedProtocol_ = NFA_PROTOCOL_T5T;
+    EXPECT_EQ(rw.GetTransceiveKey({0x22, 0x20, 0x01}) & cmdCodeMask, 0x20);
+    common.connectedType_ = TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A;
+    common.connectedProtocol_ = NFA_PROTOCOL_T2T;
+    EXPECT_EQ(rw.GetTransceiveKey({0x30, 0x04}) & cmdCodeMask, 0x30);
+
+    // the soft deadline never ends the command, the response after it is taken as the response of the command
+    unsigned char data[] = {0x90, 0x00};
+    rw.isInTransceive_ = true;
+    rw.receivedData_.clear();
+    rw.HandleTranceiveData(NFA_STATUS_CONTINUE, data, sizeof(data));
+    rw.HandleTranceiveData(NFA_STATUS_OK, data, sizeof(data));
+    EXPECT_EQ(rw.receivedData_.size(), sizeof(data) * 2); // 2 fragments
+    rw.isInTransceive_ = false;
+    common.isTimeoutOverridden_[TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A] = true;
+    EXPECT_EQ(rw.GetSoftTimeout(0, rw.GetFullTimeout()), rw.GetFullTimeout());
+    common.isTimeoutOverridden_[TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A] = false;
+    common.ResetTag();
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0020
+ * @tc.desc: Test the async worker completes the transceive through the response handler of the protocol,
+ * keeps an overdue op until its full timeout and reports the timeout
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0020, TestSize.Level1)
+{
+    const uint32_t waitMs = 1000;
+    TagNciAdapterCommon& common = TagNciAdapterCommon::GetInstance();
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
+    common.ResetTag();
+    common.connectedProtocol_ = NFA_PROTOCOL_T2T;
+    auto startOp = [&rw](uint32_t requestId, uint32_t timeout, std::promise<std::pair<int, std::string>>& result,
+        uint32_t softTimeout = 0) {
+        NFC::SynchronizeGuard guard(rw.asyncOpEvent_);
+        auto now = std::chrono::steady_clock::now();
+        rw.asyncOp_ = { requestId, TagNciAdapterRw::AsyncOpType::TRANSCEIVE,
+            [&result](int status, const std::string& response) { result.set_value({ status, response }); },
+            0, timeout, now, now + std::chrono::milliseconds(timeout), softTimeout };
+        rw.receivedData_.clear();
+        rw.isInTransceive_ = true;
+        rw.StartAsyncWorker();
+        rw.asyncOpEvent_.NotifyOne();
+    };
+
+    // a T2T NACK goes to the NACK handler, not to the callback as the response
+    std::promise<std::pair<int, std::string>> nackResult;
+    auto nackFuture = nackResult.get_future();
+    startOp(1, waitMs, nackResult);
+    unsigned char nack[] = {0x00};
+    rw.HandleTranceiveData(NFA_STATUS_OK, nack, sizeof(nack));
+    ASSERT_EQ(nackFuture.wait_for(std::chrono::milliseconds(waitMs)), std::future_status::ready);
+    auto nackRsp = nackFuture.get();
+    EXPECT_EQ(nackRsp.first, NFA_STATUS_OK);
+    EXPECT_TRUE(nackRsp.second.empty());
+    EXPECT_FALSE(rw.IsAsyncOpPending());
+    EXPECT_FALSE(rw.isInTransceive_);
+
+    // an op without response is completed by the worker when it times out
+    std::promise<std::pair<int, std::string>> timeoutResult;
+    auto timeoutFuture = timeoutResult.get_future();
+    startOp(2, 1, timeoutResult);
+    ASSERT_EQ(timeoutFuture.wait_for(std::chrono::milliseconds(waitMs)), std::future_status::ready);
+    EXPECT_EQ(timeoutFuture.get().first, NFA_STATUS_TIMEOUT);
+    EXPECT_FALSE(rw.IsAsyncOpPending());
+
+    // an op past its soft deadline is overdue, and still completed by the response before the full timeout
+    const uint32_t softTimeout = 1;
+    std::promise<std::pair<int, std::string>> overdueResult;
+    auto overdueFuture = overdueResult.get_future();
+    startOp(3, waitMs, overdueResult, softTimeout);
+    std::this_thread::sleep_for(std::chrono::milliseconds(softTimeout * 20)); // 20 times the soft deadline
+    {
+        NFC::SynchronizeGuard guard(rw.asyncOpEvent_);
+        EXPECT_TRUE(rw.asyncOp_.isOverdue);
+        EXPECT_FALSE(rw.asyncOp_.isDone);
+    }
+    unsigned char ack[] = {0x0A};
+    rw.HandleTranceiveData(NFA_STATUS_OK, ack, sizeof(ack));
+    ASSERT_EQ(overdueFuture.wait_for(std::chrono::milliseconds(waitMs)), std::future_status::ready);
+    EXPECT_EQ(overdueFuture.get().first, NFA_STATUS_OK);
+    common.ResetTag();
+}
+
+/**
+ * @tc.name: TagNciAdapterTest0021
+ * @tc.desc: Test the transceive batch serves the selected tag first, and fails the commands of a tag not in field
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagNciAdapterTest, TagNciAdapterTest0021, TestSize.Level1)
+{
+    TagNciAdapterCommon& common = TagNciAdapterCommon::GetInstance();
+    TagNciAdapterRw& rw = TagNciAdapterRw::GetInstance();
+    common.ResetTag();
+    common.AddTagSession(1, NFA_PROTOCOL_ISO_DEP, NFA_INTERFACE_ISO_DEP, "5B7FCFA9",
+        {TagNciAdapterCommon::TARGET_TYPE_ISO14443_4});
+    common.AddTagSession(2, NFA_PROTOCOL_T2T, NFA_INTERFACE_FRAME, "04A1B2C3D4E5F6",
+        {TagNciAdapterCommon::TARGET_TYPE_ISO14443_3A});
+
+    std::vector<INciTagInterface::TagTransceiveItem> items = {
+        {1, "00A4040000"}, {2, "3000"}, {1, "00B0000000"}, {3, "3004"}};
+    std::vector<uint32_t> expected = {2, 1, 3};
+    EXPECT_EQ(rw.GetBatchTagOrder(items), expected);
+
+    // the tag 3 is not in the field, its command is failed without a transceive.
+    std::vector<INciTagInterface::TagTransceiveItem> unknownItems = {{3, "3004"}};
+    EXPECT_EQ(rw.TransceiveBatch(unknownItems), 0);
+    EXPECT_EQ(unknownItems[0].status, NFA_STATUS_FAILED);
+    EXPECT_TRUE(unknownItems[0].response.empty());
+    common.ResetTag();
 }
 }
 }
@@ -77,6 +77,11 @@ public:
     {
         return;
     };
+
+    void Dump(int fd) override
+    {
+        return;
+    };
 };
 }
 }
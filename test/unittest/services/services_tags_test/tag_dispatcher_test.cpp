@@ -16,11 +16,13 @@
 #define protected public
 
 #include <gtest/gtest.h>
+#include <future>
 #include <thread>
 
 #include "nfc_controller.h"
 #include "nfc_controller_impl.h"
 #include "nfc_controller_stub.h"
+#include "nfc_event_handler.h"
 #include "nfc_sdk_common.h"
 #include "nfc_service_ipc_interface_code.h"
 #include "nfc_service_tdd.h"
@@ -391,6 +393,88 @@ HWTEST_F(TagDispatcherTest, IsAllowedVibrator, TestSize.Level1)
     bool isAllowed = tagDispatcher->IsAllowedVibrator(TAG::DISPATCH_FOREGROUND);
     ASSERT_TRUE(isAllowed);
 }
+
+/**
+ * @tc.name: RunTagFoundTail001
+ * @tc.desc: Test TagDispatcher RunTagFoundTail posts the tail to the dispatch lane, or runs it in place
+ * without the event handler.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagDispatcherTest, RunTagFoundTail001, TestSize.Level1)
+{
+    std::shared_ptr<NfcService> service = std::make_shared<NfcService>();
+    std::shared_ptr<NFC::TAG::TagDispatcher> tagDispatcher = std::make_shared<NFC::TAG::TagDispatcher>(service);
+    std::vector<int> techList = {static_cast<int>(KITS::TagTechnology::NFC_A_TECH)};
+    ASSERT_FALSE(tagDispatcher->RunTagFoundTail(false, false, techList));
+
+    service->eventHandler_ = std::make_shared<NfcEventHandler>(
+        AppExecFwk::EventRunner::Create("RunTagFoundTail001"), service);
+    ASSERT_TRUE(tagDispatcher->RunTagFoundTail(false, true, techList));
+    // the lane runs the tasks in order, the tail is done once a later task runs.
+    std::promise<void> laneDrained;
+    ASSERT_TRUE(service->eventHandler_->PostDispatchTask([&laneDrained]() { laneDrained.set_value(); }));
+    ASSERT_EQ(laneDrained.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    service->eventHandler_ = nullptr;
+
+    NFC::TAG::TagDispatcher::TagFoundStages stages;
+    stages.startTime = 1;
+    tagDispatcher->SendTagInfoToVendor(stages, nullptr, TAG::DISPATCH_UNKNOWN);
+}
+
+/**
+ * @tc.name: IsLowLatencyReaderMode001
+ * @tc.desc: Test TagDispatcher IsLowLatencyReaderMode without reader mode.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagDispatcherTest, IsLowLatencyReaderMode001, TestSize.Level1)
+{
+    std::shared_ptr<NfcService> service = std::make_shared<NfcService>();
+    std::shared_ptr<NFC::TAG::TagDispatcher> tagDispatcher = std::make_shared<NFC::TAG::TagDispatcher>(service);
+    ASSERT_EQ(tagDispatcher->GetReaderModeTechMask(), 0);
+    ASSERT_FALSE(tagDispatcher->IsLowLatencyReaderMode());
+    ASSERT_FALSE(tagDispatcher->IsSkipNdefCheck());
+}
+
+/**
+ * @tc.name: PrefetchTagApps001
+ * @tc.desc: Test TagDispatcher GetTagApps takes the apps resolved on the dispatch lane, and resolves them in place
+ * when the prefetch is not done or its techs are not a prefix of the techs of the tag.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagDispatcherTest, PrefetchTagApps001, TestSize.Level1)
+{
+    std::shared_ptr<NfcService> service = std::make_shared<NfcService>();
+    std::shared_ptr<NFC::TAG::TagDispatcher> tagDispatcher = std::make_shared<NFC::TAG::TagDispatcher>(service);
+    std::vector<int> techList = {static_cast<int>(KITS::TagTechnology::NFC_A_TECH)};
+    ASSERT_FALSE(tagDispatcher->PrefetchTagApps(techList));
+    ASSERT_EQ(tagDispatcher->tagAppsPrefetch_, nullptr);
+
+    service->eventHandler_ = std::make_shared<NfcEventHandler>(
+        AppExecFwk::EventRunner::Create("PrefetchTagApps001"), service);
+    ASSERT_TRUE(tagDispatcher->PrefetchTagApps(techList));
+    std::promise<void> laneDrained;
+    ASSERT_TRUE(service->eventHandler_->PostDispatchTask([&laneDrained]() { laneDrained.set_value(); }));
+    ASSERT_EQ(laneDrained.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    service->eventHandler_ = nullptr;
+    ASSERT_TRUE(tagDispatcher->tagAppsPrefetch_->isDone.load());
+
+    // the ndef read appends the ndef tech, the prefetched techs are still a prefix.
+    AppExecFwk::ElementName prefetchedApp("", "com.nfc.prefetched", "MainAbility");
+    tagDispatcher->tagAppsPrefetch_->apps = {prefetchedApp};
+    techList.push_back(static_cast<int>(KITS::TagTechnology::NFC_NDEF_TECH));
+    bool isPrefetched = false;
+    std::vector<AppExecFwk::ElementName> apps = tagDispatcher->GetTagApps(techList, isPrefetched);
+    ASSERT_TRUE(isPrefetched);
+    ASSERT_FALSE(apps.empty());
+    ASSERT_EQ(apps[0].GetBundleName(), "com.nfc.prefetched");
+
+    std::vector<int> otherTechList = {static_cast<int>(KITS::TagTechnology::NFC_B_TECH)};
+    tagDispatcher->GetTagApps(otherTechList, isPrefetched);
+    ASSERT_FALSE(isPrefetched);
+    tagDispatcher->tagAppsPrefetch_->isDone.store(false);
+    tagDispatcher->GetTagApps(techList, isPrefetched);
+    ASSERT_FALSE(isPrefetched);
+}
 }
 }
 }
@@ -31,6 +31,7 @@
 #include "tag_session.h"
 #include "foreground_callback_stub.h"
 #include "reader_mode_callback_stub.h"
+#include "tag_operation_callback_stub.h"
 #include <iostream>
 
 namespace OHOS {
@@ -475,6 +476,105 @@ HWTEST_F(TagSessionTest, SendRawFrame002, TestSize.Level1)
     int result = tagSession->SendRawFrame(tagRfDiscId, hexCmdData, raw, hexRespData);
     ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_NFC_CLOSED);
 }
+/**
+ * @tc.name: SendRawFrameAsync001
+ * @tc.desc: Test TagSession SendRawFrameAsync returns at once and never calls back if not sent.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagSessionTest, SendRawFrameAsync001, TestSize.Level1)
+{
+    bool isCalled = false;
+    sptr<KITS::ITagOperationCallback> callback = new TAG::TagOperationCallbackStub(
+        [&isCalled](int errorCode, const std::string& hexRespData) { isCalled = true; });
+    std::shared_ptr<NfcService> service = std::make_shared<NfcService>();
+    sptr<NFC::TAG::TagSession> tagSession = new NFC::TAG::TagSession(service);
+    int tagRfDiscId = TEST_DISC_ID;
+    std::string hexCmdData = "00A4040000";
+    int result = tagSession->SendRawFrameAsync(tagRfDiscId, hexCmdData, true, nullptr);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_PARAMETERS);
+    result = tagSession->SendRawFrameAsync(tagRfDiscId, hexCmdData, true, callback);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_UNBIND);
+
+    service->Initialize();
+    sptr<NFC::TAG::TagSession> tagSession1 = new NFC::TAG::TagSession(service);
+    result = tagSession1->SendRawFrameAsync(tagRfDiscId, hexCmdData, true, callback);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_NFC_CLOSED);
+    result = tagSession1->NdefReadAsync(tagRfDiscId, callback);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_NFC_CLOSED);
+    ASSERT_TRUE(!isCalled);
+}
+/**
+ * @tc.name: SendRawFrameBytes001
+ * @tc.desc: Test TagSession SendRawFrameBytes returns the same result as SendRawFrame.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagSessionTest, SendRawFrameBytes001, TestSize.Level1)
+{
+    std::shared_ptr<NfcService> service = std::make_shared<NfcService>();
+    sptr<NFC::TAG::TagSession> tagSession = new NFC::TAG::TagSession(service);
+    int tagRfDiscId = TEST_DISC_ID;
+    std::vector<uint8_t> cmdData = {0x00, 0xA4, 0x04, 0x00, 0x00};
+    std::vector<uint8_t> respData = {0x90, 0x00};
+    int result = tagSession->SendRawFrameBytes(tagRfDiscId, cmdData, true, respData);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_UNBIND);
+    ASSERT_TRUE(respData.empty());
+
+    service->Initialize();
+    sptr<NFC::TAG::TagSession> tagSession1 = new NFC::TAG::TagSession(service);
+    result = tagSession1->SendRawFrameBytes(tagRfDiscId, cmdData, true, respData);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_NFC_CLOSED);
+}
+/**
+ * @tc.name: SendRawFrameBatch001
+ * @tc.desc: Test TagSession SendRawFrameBatch checks the batch before the nfc state.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagSessionTest, SendRawFrameBatch001, TestSize.Level1)
+{
+    std::shared_ptr<NfcService> service = std::make_shared<NfcService>();
+    sptr<NFC::TAG::TagSession> tagSession = new NFC::TAG::TagSession(service);
+    int tagRfDiscId = TEST_DISC_ID;
+    std::vector<int32_t> rfDiscIds = {1};
+    std::vector<std::string> hexCmds = {"00A4040000", "3000"};
+    std::vector<std::string> hexResps = {"9000"};
+    std::vector<int32_t> results = {0};
+    // one rf disc id for two commands.
+    int result = tagSession->SendRawFrameBatch(tagRfDiscId, rfDiscIds, hexCmds, hexResps, results);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_PARAMETERS);
+    ASSERT_TRUE(hexResps.empty());
+    ASSERT_TRUE(results.empty());
+
+    rfDiscIds.push_back(2);
+    result = tagSession->SendRawFrameBatch(tagRfDiscId, rfDiscIds, hexCmds, hexResps, results);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_UNBIND);
+
+    service->Initialize();
+    sptr<NFC::TAG::TagSession> tagSession1 = new NFC::TAG::TagSession(service);
+    result = tagSession1->SendRawFrameBatch(tagRfDiscId, rfDiscIds, hexCmds, hexResps, results);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_NFC_CLOSED);
+}
+/**
+ * @tc.name: GetTagInventory001
+ * @tc.desc: Test TagSession GetTagInventory.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagSessionTest, GetTagInventory001, TestSize.Level1)
+{
+    std::shared_ptr<NfcService> service = std::make_shared<NfcService>();
+    sptr<NFC::TAG::TagSession> tagSession = new NFC::TAG::TagSession(service);
+    std::vector<int32_t> rfDiscIds = {1};
+    std::vector<std::string> uids;
+    std::vector<int32_t> techCounts;
+    std::vector<int32_t> techs;
+    int result = tagSession->GetTagInventory(rfDiscIds, uids, techCounts, techs);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_UNBIND);
+    ASSERT_TRUE(rfDiscIds.empty());
+
+    service->Initialize();
+    sptr<NFC::TAG::TagSession> tagSession1 = new NFC::TAG::TagSession(service);
+    result = tagSession1->GetTagInventory(rfDiscIds, uids, techCounts, techs);
+    ASSERT_TRUE(result == NFC::KITS::ErrorCode::ERR_TAG_STATE_NFC_CLOSED);
+}
 /**
  * @tc.name: FormatNdef001
  * @tc.desc: Test TagSession FormatNdef.
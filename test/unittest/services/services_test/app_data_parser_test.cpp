@@ -16,6 +16,9 @@
 #define private public
 #define protected public
 
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <gtest/gtest.h>
 #include <thread>
 #include "app_data_parser.h"
@@ -26,6 +29,7 @@
 
 namespace OHOS {
 namespace NFC {
+extern std::mutex g_mutex;
 namespace TEST {
 using namespace testing::ext;
 using namespace OHOS::NFC;
@@ -36,10 +40,66 @@ public:
     static void TearDownTestCase();
     void SetUp();
     void TearDown();
+    static void AddHceApps(AppDataParser &parser, int appCount, const std::string &aid);
+    static int64_t TimeLookupsUnderWrites(AppDataParser &parser, int readerCount, int loopCount,
+        const std::function<size_t()> &lookup);
 public:
     static constexpr const auto TECH_MASK = 4;
 };
 
+void AppDataParserTest::AddHceApps(AppDataParser &parser, int appCount, const std::string &aid)
+{
+    for (int i = 0; i < appCount; i++) {
+        AppDataParser::HceAppAidInfo appAidInfo;
+        appAidInfo.element.SetBundleName("bundle" + std::to_string(i));
+        appAidInfo.element.SetAbilityName("ability");
+        appAidInfo.appIndex = 0;
+        appAidInfo.customDataAid.push_back({KITS::KEY_OTHER_AID, (i == 0) ? aid : std::to_string(i)});
+        parser.g_hceAppAndAidMap.push_back(appAidInfo);
+    }
+    std::lock_guard<std::mutex> lock(g_mutex);
+    parser.PublishAppTables();
+}
+
+// the cost in us of the lookups of the readers, while a writer keeps republishing the app tables under g_mutex.
+int64_t AppDataParserTest::TimeLookupsUnderWrites(AppDataParser &parser, int readerCount, int loopCount,
+    const std::function<size_t()> &lookup)
+{
+    std::atomic<bool> mismatch = false;
+    std::atomic<bool> writerDone = false;
+    std::atomic<int> publishCount = 0;
+    std::thread writer([&parser, &writerDone, &publishCount]() {
+        while (!writerDone) {
+            std::lock_guard<std::mutex> lock(g_mutex);
+            parser.PublishAppTables();
+            publishCount++;
+        }
+    });
+    while (publishCount == 0) {
+        std::this_thread::yield();
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> readers;
+    for (int i = 0; i < readerCount; i++) {
+        readers.emplace_back([&lookup, &mismatch, loopCount]() {
+            for (int j = 0; j < loopCount; j++) {
+                if (lookup() != 1) {
+                    mismatch = true;
+                }
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    auto costUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    writerDone = true;
+    writer.join();
+    EXPECT_TRUE(!mismatch);
+    return costUs;
+}
+
 void AppDataParserTest::SetUpTestCase()
 {
     std::cout << " SetUpTestCase AppDataParserTest." << std::endl;
@@ -300,6 +360,98 @@ HWTEST_F(AppDataParserTest, UpdateNfcStateToParam001, TestSize.Level1)
     std::string ret = parser.GetBundleNameByUid(uid);
     ASSERT_TRUE(ret == "");
 }
+/**
+ * @tc.name: GetHceAppsByAidContention001
+ * @tc.desc: Test AppDataParser snapshot reads while the app tables are republished concurrently.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AppDataParserTest, GetHceAppsByAidContention001, TestSize.Level1)
+{
+    const int appCount = 64;
+    const int readerCount = 4;
+    const int loopCount = 2000;
+    const std::string aid = "A0000000031010";
+    AppDataParser parser;
+    AddHceApps(parser, appCount, aid);
+
+    std::atomic<bool> mismatch = false;
+    std::atomic<bool> writerDone = false;
+    std::atomic<int> lookupCount = 0;
+    std::atomic<int> publishCount = 0;
+    std::thread writer([&parser, &writerDone, &publishCount]() {
+        while (!writerDone) {
+            std::lock_guard<std::mutex> lock(g_mutex);
+            parser.PublishAppTables();
+            publishCount++;
+        }
+    });
+    // the readers only start once the writer is republishing, so every lookup races a publish.
+    while (publishCount == 0) {
+        std::this_thread::yield();
+    }
+    int publishedBeforeReads = publishCount;
+    std::vector<std::thread> readers;
+    for (int i = 0; i < readerCount; i++) {
+        readers.emplace_back([&parser, &mismatch, &lookupCount, &aid, loopCount]() {
+            for (int j = 0; j < loopCount; j++) {
+                std::vector<AppDataParser::HceAppAidInfo> hceApps;
+                parser.GetHceAppsByAid(aid, hceApps);
+                if (hceApps.size() != 1) {
+                    mismatch = true;
+                }
+                lookupCount++;
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    int publishedDuringReads = publishCount;
+    writerDone = true;
+    writer.join();
+    ASSERT_TRUE(!mismatch);
+    ASSERT_EQ(lookupCount, readerCount * loopCount);
+    ASSERT_GT(publishedDuringReads, publishedBeforeReads);
+}
+
+/**
+ * @tc.name: GetHceAppsByAidContention002
+ * @tc.desc: Test AppDataParser snapshot reads against the reads under g_mutex while a writer republishes.
+ * @tc.type: PERF
+ */
+HWTEST_F(AppDataParserTest, GetHceAppsByAidContention002, TestSize.Level1)
+{
+    const int appCount = 64;
+    const int readerCount = 4;
+    const int loopCount = 2000;
+    const std::string aid = "A0000000031010";
+    AppDataParser parser;
+    AddHceApps(parser, appCount, aid);
+
+    int64_t snapshotCostUs = TimeLookupsUnderWrites(parser, readerCount, loopCount, [&parser, &aid]() {
+        std::vector<AppDataParser::HceAppAidInfo> hceApps;
+        parser.GetHceAppsByAid(aid, hceApps);
+        return hceApps.size();
+    });
+    // the lookup before the snapshots, scanning the writer side apps under g_mutex.
+    int64_t mutexCostUs = TimeLookupsUnderWrites(parser, readerCount, loopCount, [&parser, &aid]() {
+        std::vector<AppDataParser::HceAppAidInfo> hceApps;
+        std::lock_guard<std::mutex> lock(g_mutex);
+        for (const AppDataParser::HceAppAidInfo &appAidInfo : parser.g_hceAppAndAidMap) {
+            for (const AppDataParser::AidInfo &aidInfo : appAidInfo.customDataAid) {
+                if (aid == aidInfo.value) {
+                    hceApps.push_back(appAidInfo);
+                    break;
+                }
+            }
+        }
+        return hceApps.size();
+    });
+    std::cout << " GetHceAppsByAidContention002 " << readerCount * loopCount << " lookups, snapshot cost "
+        << snapshotCostUs << " us, g_mutex cost " << mutexCostUs << " us." << std::endl;
+    ASSERT_GT(snapshotCostUs, 0);
+    ASSERT_GT(mutexCostUs, 0);
+}
+}
 }
 }
-}
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "lock_stats.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+
+class LockStatsTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: GetBucket001
+ * @tc.desc: Test LockStats GetBucket puts the times in the buckets of their upper bounds.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LockStatsTest, GetBucket001, TestSize.Level1)
+{
+    EXPECT_EQ(LockStats::GetBucket(0), 0);
+    EXPECT_EQ(LockStats::GetBucket(9), 0);
+    EXPECT_EQ(LockStats::GetBucket(10), 1);
+    EXPECT_EQ(LockStats::GetBucket(999), 2);
+    EXPECT_EQ(LockStats::GetBucket(100000), LockStats::BUCKET_COUNT - 1);
+}
+
+/**
+ * @tc.name: TimedLockGuard001
+ * @tc.desc: Test TimedLockGuard counts the acquisitions and the contended ones.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LockStatsTest, TimedLockGuard001, TestSize.Level1)
+{
+    std::mutex mutex;
+    LockStats stats("test");
+    {
+        TimedLockGuard lock(mutex, stats);
+    }
+    EXPECT_EQ(stats.GetAcquireCount(), 1);
+    EXPECT_EQ(stats.GetContendedCount(), 0);
+
+    const int holdMs = 20;
+    std::unique_lock<std::mutex> holder(mutex);
+    std::thread waiter([&mutex, &stats]() {
+        TimedLockGuard lock(mutex, stats);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(holdMs));
+    holder.unlock();
+    waiter.join();
+    EXPECT_EQ(stats.GetAcquireCount(), 2);
+    EXPECT_EQ(stats.GetContendedCount(), 1);
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+}
+}
+}
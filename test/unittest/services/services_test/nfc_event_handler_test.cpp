@@ -13,7 +13,9 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <fcntl.h>
 #include <thread>
+#include <unistd.h>
 
 #include "nfc_event_handler.h"
 #include "nci_native_selector.h"
@@ -630,6 +632,46 @@ HWTEST_F(NfcEventHandlerTest, ProcessEvent030, TestSize.Level1)
     nfcEventHandler->ProcessEvent(event);
     ASSERT_TRUE(nfcEventHandler != nullptr);
 }
+
+/**
+ * @tc.name: GetEventLane001
+ * @tc.desc: Test the tag events run on the rf lane with the screen events, off the field and routing events.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NfcEventHandlerTest, GetEventLane001, TestSize.Level1)
+{
+    EXPECT_EQ(NfcEventHandler::GetEventLane(static_cast<uint32_t>(NfcCommonEvent::MSG_TAG_FOUND)),
+        NfcEventHandler::LANE_RF);
+    EXPECT_EQ(NfcEventHandler::GetEventLane(static_cast<uint32_t>(NfcCommonEvent::MSG_TAG_LOST)),
+        NfcEventHandler::LANE_RF);
+    EXPECT_EQ(NfcEventHandler::GetEventLane(static_cast<uint32_t>(NfcCommonEvent::MSG_SCREEN_CHANGED)),
+        NfcEventHandler::LANE_RF);
+    EXPECT_EQ(NfcEventHandler::GetEventLane(static_cast<uint32_t>(NfcCommonEvent::MSG_FIELD_ACTIVATED)),
+        NfcEventHandler::LANE_CE);
+    EXPECT_EQ(NfcEventHandler::GetEventLane(static_cast<uint32_t>(NfcCommonEvent::MSG_NOTIFY_FIELD_OFF_TIMEOUT)),
+        NfcEventHandler::LANE_CE);
+    EXPECT_EQ(NfcEventHandler::GetEventLane(static_cast<uint32_t>(NfcCommonEvent::MSG_COMMIT_ROUTING)),
+        NfcEventHandler::LANE_CE);
+    EXPECT_EQ(NfcEventHandler::GetEventLane(static_cast<uint32_t>(NfcCommonEvent::MSG_PACKAGE_UPDATED)),
+        NfcEventHandler::LANE_CE);
+}
+
+/**
+ * @tc.name: Dump001
+ * @tc.desc: Test NfcEventHandlerTest Dump.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NfcEventHandlerTest, Dump001, TestSize.Level1)
+{
+    std::shared_ptr<AppExecFwk::EventRunner> runner = nullptr;
+    std::shared_ptr<NfcService> service = std::make_shared<NfcService>();
+    std::shared_ptr<NfcEventHandler> nfcEventHandler = std::make_shared<NfcEventHandler>(runner, service);
+    nfcEventHandler->ProcessEvent(AppExecFwk::InnerEvent::Get(static_cast<uint32_t>(NfcCommonEvent::MSG_TAG_LOST), 0));
+    int fd = open("/dev/null", O_WRONLY);
+    ASSERT_GE(fd, 0);
+    nfcEventHandler->Dump(fd);
+    close(fd);
+}
 } // namespace TEST
 } // namespace TAG
 } // namespace NFC
@@ -15,11 +15,13 @@
 #define private public
 #define protected public
 
+#include <chrono>
 #include <gtest/gtest.h>
 #include <thread>
 
 #include "basic_tag_session.h"
 #include "loghelper.h"
+#include "message_parcel.h"
 #include "nfc_controller.h"
 #include "nfc_sdk_common.h"
 #include "tag_session_proxy.h"
@@ -131,6 +133,111 @@ HWTEST_F(BasicTagSessionTest, ResetTimeout001, TestSize.Level1)
     basicTagSession.ResetTimeout();
     ASSERT_TRUE(tagInfo != nullptr);
 }
+
+/**
+ * @tc.name: SendCommand001
+ * @tc.desc: Test BasicTagSessionTest SendCommand in bytes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BasicTagSessionTest, SendCommand001, TestSize.Level1)
+{
+    std::shared_ptr<TagInfo> tagInfo = nullptr;
+    TagTechnology tagTechnology = TagTechnology::NFC_ISODEP_TECH;
+    BasicTagSession basicTagSession{tagInfo, tagTechnology};
+    std::vector<uint8_t> cmdData = {0x00, 0xA4, 0x04, 0x00, 0x00};
+    std::vector<uint8_t> respData;
+    int ret = basicTagSession.SendCommand(cmdData, true, respData);
+    ASSERT_TRUE(ret != ErrorCode::ERR_NONE);
+    ASSERT_TRUE(respData.empty());
+}
+
+/**
+ * @tc.name: SendCommandBenchmark001
+ * @tc.desc: Measure the per-call cost of the hex string command path against the bytes path, each marshalled
+ * through a parcel as the IPC does.
+ * @tc.type: PERF
+ */
+HWTEST_F(BasicTagSessionTest, SendCommandBenchmark001, TestSize.Level1)
+{
+    const uint32_t loops = 10000;
+    const uint32_t apduLen = 261;  // the max short APDU with Lc and Le
+    std::vector<unsigned char> cmdData(apduLen);
+    for (uint32_t i = 0; i < apduLen; i++) {
+        cmdData[i] = static_cast<unsigned char>(i);
+    }
+
+    // the hex path converts the command and the response once each on both sides of the IPC.
+    std::vector<unsigned char> hexResult;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < loops; i++) {
+        MessageParcel parcel;
+        parcel.WriteString(NfcSdkCommon::BytesVecToHexString(cmdData.data(), cmdData.size()));
+        std::vector<unsigned char> serviceCmd;
+        NfcSdkCommon::HexStringToBytes(parcel.ReadString(), serviceCmd);
+        parcel.WriteString(NfcSdkCommon::BytesVecToHexString(serviceCmd.data(), serviceCmd.size()));
+        hexResult.clear();
+        NfcSdkCommon::HexStringToBytes(parcel.ReadString(), hexResult);
+    }
+    auto hexCost = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    // the bytes path only copies the command and the response.
+    std::vector<unsigned char> bytesResult;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < loops; i++) {
+        MessageParcel parcel;
+        parcel.WriteUInt8Vector(cmdData);
+        std::vector<unsigned char> serviceCmd;
+        parcel.ReadUInt8Vector(&serviceCmd);
+        parcel.WriteUInt8Vector(serviceCmd);
+        parcel.ReadUInt8Vector(&bytesResult);
+    }
+    auto bytesCost = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::cout << " SendCommandBenchmark001 hex: " << hexCost / loops << " ns/call, bytes: " <<
+        bytesCost / loops << " ns/call." << std::endl;
+    ASSERT_TRUE(hexResult == cmdData);
+    ASSERT_TRUE(bytesResult == cmdData);
+}
+
+/**
+ * @tc.name: SendCommandBatch001
+ * @tc.desc: Test BasicTagSessionTest SendCommandBatch without the tag session.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BasicTagSessionTest, SendCommandBatch001, TestSize.Level1)
+{
+    std::shared_ptr<TagInfo> tagInfo = nullptr;
+    TagTechnology tagTechnology = TagTechnology::NFC_ISODEP_TECH;
+    BasicTagSession basicTagSession{tagInfo, tagTechnology};
+    std::vector<int> rfDiscIds = {1, 2};
+    std::vector<std::string> hexCmds = {"00A4040000", "3000"};
+    std::vector<std::string> hexResps;
+    std::vector<int> results;
+    int ret = basicTagSession.SendCommandBatch(rfDiscIds, hexCmds, hexResps, results);
+    ASSERT_TRUE(ret != ErrorCode::ERR_NONE);
+    ASSERT_TRUE(hexResps.empty());
+    ASSERT_TRUE(results.empty());
+}
+
+/**
+ * @tc.name: GetTagInventory001
+ * @tc.desc: Test BasicTagSessionTest GetTagInventory without the tag session.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BasicTagSessionTest, GetTagInventory001, TestSize.Level1)
+{
+    std::shared_ptr<TagInfo> tagInfo = nullptr;
+    TagTechnology tagTechnology = TagTechnology::NFC_ISODEP_TECH;
+    BasicTagSession basicTagSession{tagInfo, tagTechnology};
+    std::vector<int> rfDiscIds;
+    std::vector<std::string> uids;
+    std::vector<std::vector<int>> techLists;
+    int ret = basicTagSession.GetTagInventory(rfDiscIds, uids, techLists);
+    ASSERT_TRUE(ret != ErrorCode::ERR_NONE);
+    ASSERT_TRUE(techLists.empty());
+}
 }
 }
 }
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include "ndef_dispatch_rules.h"
+
+namespace OHOS {
+namespace NFC {
+namespace TEST {
+using namespace testing::ext;
+using namespace OHOS::NFC::TAG;
+class NdefDispatchRulesTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void NdefDispatchRulesTest::SetUpTestCase()
+{
+    std::cout << " SetUpTestCase NdefDispatchRulesTest." << std::endl;
+}
+
+void NdefDispatchRulesTest::TearDownTestCase()
+{
+    std::cout << " TearDownTestCase NdefDispatchRulesTest." << std::endl;
+}
+
+void NdefDispatchRulesTest::SetUp()
+{
+    std::cout << " SetUp NdefDispatchRulesTest." << std::endl;
+}
+
+void NdefDispatchRulesTest::TearDown()
+{
+    std::cout << " TearDown NdefDispatchRulesTest." << std::endl;
+}
+
+static AppExecFwk::BundleInfo BuildBundleInfo(const std::string &bundleName, const std::string &scheme,
+    const std::string &type)
+{
+    AppExecFwk::SkillUri skillUri;
+    skillUri.scheme = scheme;
+    skillUri.type = type;
+    AppExecFwk::Skill skill;
+    skill.uris.push_back(skillUri);
+    AppExecFwk::AbilityInfo abilityInfo;
+    abilityInfo.skills.push_back(skill);
+    AppExecFwk::HapModuleInfo hapModuleInfo;
+    hapModuleInfo.abilityInfos.push_back(abilityInfo);
+    AppExecFwk::BundleInfo bundleInfo;
+    bundleInfo.name = bundleName;
+    bundleInfo.hapModuleInfos.push_back(hapModuleInfo);
+    return bundleInfo;
+}
+
+/**
+ * @tc.name: Compile001
+ * @tc.desc: Test NdefDispatchRules matches the bundles, MIME types and uri schemes of the compiled skills.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NdefDispatchRulesTest, Compile001, TestSize.Level1)
+{
+    std::vector<AppExecFwk::BundleInfo> bundleInfos;
+    bundleInfos.push_back(BuildBundleInfo("com.example.reader", "myapp", "application/vnd.example"));
+    bundleInfos.push_back(BuildBundleInfo("com.example.gallery", "", "image/*"));
+    NdefDispatchRules &rules = NdefDispatchRules::GetInstance();
+    rules.Compile(bundleInfos);
+
+    ASSERT_EQ(rules.MatchBundle("com.example.reader"), NdefDispatchRules::RULES_MATCHED);
+    ASSERT_EQ(rules.MatchBundle("com.example.absent"), NdefDispatchRules::RULES_NOT_MATCHED);
+    ASSERT_EQ(rules.MatchMimeType("Application/Vnd.Example"), NdefDispatchRules::RULES_MATCHED);
+    ASSERT_EQ(rules.MatchMimeType("image/png"), NdefDispatchRules::RULES_MATCHED);
+    ASSERT_EQ(rules.MatchMimeType("audio/mpeg"), NdefDispatchRules::RULES_NOT_MATCHED);
+    ASSERT_EQ(rules.MatchUriScheme("myapp"), NdefDispatchRules::RULES_MATCHED);
+    ASSERT_EQ(rules.MatchUriScheme("otherapp"), NdefDispatchRules::RULES_NOT_MATCHED);
+
+    rules.RemoveBundle("com.example.reader");
+    ASSERT_EQ(rules.MatchBundle("com.example.reader"), NdefDispatchRules::RULES_NOT_MATCHED);
+    ASSERT_EQ(rules.MatchUriScheme("myapp"), NdefDispatchRules::RULES_NOT_MATCHED);
+    ASSERT_EQ(rules.MatchMimeType("image/jpeg"), NdefDispatchRules::RULES_MATCHED);
+}
+
+/**
+ * @tc.name: Compile002
+ * @tc.desc: Test NdefDispatchRules matches any MIME type when a skill declares the wildcard type.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NdefDispatchRulesTest, Compile002, TestSize.Level1)
+{
+    std::vector<AppExecFwk::BundleInfo> bundleInfos;
+    bundleInfos.push_back(BuildBundleInfo("com.example.files", "file", "*/*"));
+    NdefDispatchRules &rules = NdefDispatchRules::GetInstance();
+    rules.Compile(bundleInfos);
+    ASSERT_EQ(rules.MatchMimeType("text/x-unknown"), NdefDispatchRules::RULES_MATCHED);
+    ASSERT_EQ(rules.MatchUriScheme("FILE"), NdefDispatchRules::RULES_MATCHED);
+}
+
+/**
+ * @tc.name: Compile003
+ * @tc.desc: Test NdefDispatchRules matches the skills declared by the extension abilities.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NdefDispatchRulesTest, Compile003, TestSize.Level1)
+{
+    AppExecFwk::SkillUri skillUri;
+    skillUri.scheme = "extapp";
+    skillUri.type = "application/vnd.extension";
+    AppExecFwk::Skill skill;
+    skill.uris.push_back(skillUri);
+    AppExecFwk::ExtensionAbilityInfo extensionInfo;
+    extensionInfo.skills.push_back(skill);
+    AppExecFwk::HapModuleInfo hapModuleInfo;
+    hapModuleInfo.extensionInfos.push_back(extensionInfo);
+    AppExecFwk::BundleInfo bundleInfo;
+    bundleInfo.name = "com.example.extension";
+    bundleInfo.hapModuleInfos.push_back(hapModuleInfo);
+    NdefDispatchRules &rules = NdefDispatchRules::GetInstance();
+    rules.Compile({ bundleInfo });
+    ASSERT_EQ(rules.MatchBundle("com.example.extension"), NdefDispatchRules::RULES_MATCHED);
+    ASSERT_EQ(rules.MatchUriScheme("extapp"), NdefDispatchRules::RULES_MATCHED);
+    ASSERT_EQ(rules.MatchMimeType("application/vnd.extension"), NdefDispatchRules::RULES_MATCHED);
+    ASSERT_EQ(rules.MatchMimeType("image/png"), NdefDispatchRules::RULES_NOT_MATCHED);
+}
+}
+}
+}
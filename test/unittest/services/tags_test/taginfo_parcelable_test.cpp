@@ -16,6 +16,8 @@
 #include <thread>
 
 #include "taginfo_parcelable.h"
+#include "tag_tech_extras.h"
+#include "taginfo.h"
 #include "nfc_sdk_common.h"
 #include "parcel.h"
 #include "refbase.h"
@@ -101,6 +103,54 @@ HWTEST_F(TagInfoParcelableTest, ToString002, TestSize.Level1)
     std::string toString = tagInfo->ToString();
     ASSERT_TRUE(toString == "tagTechList: []");
 }
+/**
+ * @tc.name: Marshalling001
+ * @tc.desc: Test TagInfoParcelable Marshalling and Unmarshalling keep the tech extras fields.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagInfoParcelableTest, Marshalling001, TestSize.Level1)
+{
+    std::vector<int> tagTechList = {static_cast<int>(TagTechnology::NFC_A_TECH)};
+    TagTechExtras nfcAExtras;
+    nfcAExtras.PutIntValue(TagTechExtras::SAK, 0x20);
+    nfcAExtras.PutStringValue(TagTechExtras::ATQA, "0400");
+    std::vector<TagTechExtras> tagTechExtras = {nfcAExtras};
+    std::string tagUid = TEST_UID;
+    TagInfoParcelable tagInfo(tagTechList, tagTechExtras, tagUid, TEST_DISC_ID, nullptr);
+
+    Parcel parcel;
+    ASSERT_TRUE(tagInfo.Marshalling(parcel));
+    TagInfoParcelable *result = TagInfoParcelable::Unmarshalling(parcel);
+    ASSERT_TRUE(result != nullptr);
+    ASSERT_TRUE(result->GetTechExtrasList().size() == 1);
+    const TagTechExtras &extras = result->GetTechExtrasList()[0];
+    ASSERT_TRUE(extras.GetIntValue(TagTechExtras::SAK, 0) == 0x20);
+    ASSERT_TRUE(extras.GetStringValue(TagTechExtras::ATQA, "") == "0400");
+    ASSERT_FALSE(extras.HasIntValue(TagTechExtras::DSF_ID));
+    delete result;
+}
+/**
+ * @tc.name: GetTechExtras001
+ * @tc.desc: Test TagInfo GetTechExtras matches the legacy PacMap extras.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TagInfoParcelableTest, GetTechExtras001, TestSize.Level1)
+{
+    std::vector<int> tagTechList = {static_cast<int>(TagTechnology::NFC_A_TECH)};
+    TagTechExtras nfcAExtras;
+    nfcAExtras.PutIntValue(TagTechExtras::SAK, 0x08);
+    nfcAExtras.PutStringValue(TagTechExtras::ATQA, "0044");
+    std::vector<TagTechExtras> tagTechExtras = {nfcAExtras};
+    std::string tagUid = TEST_UID;
+    TagInfo tagInfo(tagTechList, tagTechExtras, tagUid, TEST_DISC_ID, nullptr);
+
+    TagTechExtras extras = tagInfo.GetTechExtras(TagTechnology::NFC_A_TECH);
+    ASSERT_TRUE(extras.GetIntValue(TagTechExtras::SAK, 0) == 0x08);
+    AppExecFwk::PacMap pacMap = tagInfo.GetTechExtrasByTech(TagTechnology::NFC_A_TECH);
+    ASSERT_TRUE(pacMap.GetIntValue(TagInfo::SAK, 0) == 0x08);
+    ASSERT_TRUE(pacMap.GetStringValue(TagInfo::ATQA, "") == "0044");
+    ASSERT_TRUE(tagInfo.GetTechExtras(TagTechnology::NFC_B_TECH).IsEmpty());
+}
 }
 }
 }
@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Replays the "CE capture" section of the nfc service dump, or the records got by HceService::GetCeCapture, on
+// the Linux host, in the recorded order and optionally at the recorded pace. The events are fed through
+// ICeHostListener into a stub checking the order of the session, and the latencies recorded on the device are
+// reported, so a slow terminal session is examined off the field.
+// usage: ce_capture_replay <capture file> [--realtime]
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ce_capture_ring.h"
+#include "inci_ce_interface.h"
+
+using OHOS::NFC::CeCaptureRing;
+using OHOS::NFC::NCI::INciCeInterface;
+
+namespace {
+constexpr int MIN_NUM_INPUT_PARAMETERS = 2;
+constexpr char OPTION_REALTIME[] = "--realtime";
+constexpr double US_PER_MS = 1000.0;
+
+struct LatencyStats {
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+    uint64_t minUs = UINT64_MAX;
+
+    void Add(uint64_t costUs)
+    {
+        count++;
+        totalUs += costUs;
+        maxUs = std::max(maxUs, costUs);
+        minUs = std::min(minUs, costUs);
+    }
+};
+
+// the session being replayed, 0 before its event is seen.
+struct SessionState {
+    uint64_t fieldOnUs = 0;
+    uint64_t activatedUs = 0;
+    uint64_t apduUs = 0;
+};
+
+struct ReplayStats {
+    LatencyStats fieldOnToActivated;
+    LatencyStats apduToResponse;
+    LatencyStats session;
+};
+
+// stands in for CeService, the replay needs no nfc service, controller or HCE app.
+class CeReplayStub : public INciCeInterface::ICeHostListener {
+public:
+    void FieldActivated() override
+    {
+        isFieldOn_ = true;
+    }
+    void FieldDeactivated() override
+    {
+        isFieldOn_ = false;
+    }
+    void OnCardEmulationData(const std::vector<uint8_t> &data) override
+    {
+        apduCount_++;
+        if (!isActivated_) {
+            Report("apdu of " + std::to_string(data.size()) + " bytes out of an activation");
+        }
+        if (isApduPending_) {
+            // the reader gave up the previous command, the service answers the latest one only.
+            unansweredCount_++;
+        }
+        isApduPending_ = true;
+    }
+    void OnCardEmulationActivated() override
+    {
+        if (!isFieldOn_) {
+            Report("activation without the field");
+        }
+        isActivated_ = true;
+        isApduPending_ = false;
+        sessionCount_++;
+    }
+    void OnCardEmulationDeactivated() override
+    {
+        if (isApduPending_) {
+            unansweredCount_++;
+        }
+        isActivated_ = false;
+        isApduPending_ = false;
+    }
+    void OnEeInfoChanged() override {}
+
+    // the responses come from the HCE apps, they are checked against the replayed APDUs.
+    void OnResponse()
+    {
+        if (!isApduPending_) {
+            Report("response without a pending apdu");
+        }
+        isApduPending_ = false;
+    }
+
+    void PrintSummary() const
+    {
+        std::cout << "replayed: " << sessionCount_ << " sessions, " << apduCount_ << " apdus, " << unansweredCount_
+            << " unanswered, " << anomalyCount_ << " out of order events\n";
+    }
+
+private:
+    void Report(const std::string& anomaly)
+    {
+        anomalyCount_++;
+        std::cout << "  ! " << anomaly << "\n";
+    }
+
+    bool isFieldOn_ = false;
+    bool isActivated_ = false;
+    bool isApduPending_ = false;
+    uint64_t sessionCount_ = 0;
+    uint64_t apduCount_ = 0;
+    uint64_t unansweredCount_ = 0;
+    uint64_t anomalyCount_ = 0;
+};
+
+bool LoadCapture(const std::string& path, std::vector<CeCaptureRing::CaptureRecord>& records)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "failed to open " << path << "\n";
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        // the other sections of the dump and the headers are skipped.
+        CeCaptureRing::CaptureRecord record;
+        if (CeCaptureRing::ParseRecord(line, record)) {
+            records.push_back(record);
+        }
+    }
+    std::stable_sort(records.begin(), records.end(),
+        [](const CeCaptureRing::CaptureRecord& a, const CeCaptureRing::CaptureRecord& b) {
+            return a.sequence < b.sequence;
+        });
+    // a dump concatenated with the records got by the IPC carries a record twice, it's replayed once.
+    records.erase(std::unique(records.begin(), records.end(),
+        [](const CeCaptureRing::CaptureRecord& a, const CeCaptureRing::CaptureRecord& b) {
+            return a.sequence == b.sequence;
+        }), records.end());
+    return true;
+}
+
+// the latencies recorded on the device.
+void OnRecordedEvent(const CeCaptureRing::CaptureRecord& record, SessionState& session, ReplayStats& stats)
+{
+    switch (record.type) {
+        case CeCaptureRing::EVENT_FIELD_ON:
+            session = SessionState();
+            session.fieldOnUs = record.timeUs;
+            break;
+        case CeCaptureRing::EVENT_ACTIVATED:
+            session.activatedUs = record.timeUs;
+            if (session.fieldOnUs != 0) {
+                stats.fieldOnToActivated.Add(record.timeUs - session.fieldOnUs);
+            }
+            break;
+        case CeCaptureRing::EVENT_APDU:
+            session.apduUs = record.timeUs;
+            break;
+        case CeCaptureRing::EVENT_RESPONSE:
+            if (session.apduUs != 0) {
+                stats.apduToResponse.Add(record.timeUs - session.apduUs);
+                session.apduUs = 0;
+            }
+            break;
+        case CeCaptureRing::EVENT_DEACTIVATED:
+            if (session.activatedUs != 0) {
+                stats.session.Add(record.timeUs - session.activatedUs);
+            }
+            session.activatedUs = 0;
+            session.apduUs = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+void ReplayEvent(CeReplayStub& stub, const CeCaptureRing::CaptureRecord& record)
+{
+    switch (record.type) {
+        case CeCaptureRing::EVENT_FIELD_ON:
+            stub.FieldActivated();
+            break;
+        case CeCaptureRing::EVENT_FIELD_OFF:
+            stub.FieldDeactivated();
+            break;
+        case CeCaptureRing::EVENT_ACTIVATED:
+            stub.OnCardEmulationActivated();
+            break;
+        case CeCaptureRing::EVENT_DEACTIVATED:
+            stub.OnCardEmulationDeactivated();
+            break;
+        case CeCaptureRing::EVENT_APDU:
+            stub.OnCardEmulationData(CeCaptureRing::BuildFrame(record));
+            break;
+        case CeCaptureRing::EVENT_RESPONSE:
+            stub.OnResponse();
+            break;
+        default:
+            break;
+    }
+}
+
+void PrintStats(const char* name, const LatencyStats& stats)
+{
+    if (stats.count == 0) {
+        std::cout << "  " << name << ": none\n";
+        return;
+    }
+    std::cout << "  " << name << ": count " << stats.count << ", min " << (stats.minUs / US_PER_MS) << " ms, avg "
+        << (stats.totalUs / stats.count / US_PER_MS) << " ms, max " << (stats.maxUs / US_PER_MS) << " ms\n";
+}
+
+void Replay(CeReplayStub& stub, const std::vector<CeCaptureRing::CaptureRecord>& records, bool isRealtime)
+{
+    SessionState session;
+    ReplayStats stats;
+    uint64_t startUs = records.front().timeUs;
+    uint64_t lastUs = startUs;
+    for (const CeCaptureRing::CaptureRecord& record : records) {
+        uint64_t gapUs = (record.timeUs > lastUs) ? (record.timeUs - lastUs) : 0;
+        if (isRealtime && gapUs > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(gapUs));
+        }
+        lastUs = std::max(lastUs, record.timeUs);
+        std::cout << "+" << ((record.timeUs - startUs) / US_PER_MS) << " ms (+" << (gapUs / US_PER_MS) << ") "
+            << CeCaptureRing::FormatRecord(record) << "\n";
+        OnRecordedEvent(record, session, stats);
+        ReplayEvent(stub, record);
+    }
+    std::cout << "summary: " << records.size() << " records over " << ((lastUs - startUs) / US_PER_MS) << " ms\n";
+    std::cout << "recorded:\n";
+    PrintStats("field on to activation", stats.fieldOnToActivated);
+    PrintStats("apdu to response", stats.apduToResponse);
+    PrintStats("activation to deactivation", stats.session);
+    stub.PrintSummary();
+}
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < MIN_NUM_INPUT_PARAMETERS) {
+        std::cerr << "usage: ce_capture_replay <capture file> [" << OPTION_REALTIME << "]\n";
+        return 1;
+    }
+    bool isRealtime = (argc > MIN_NUM_INPUT_PARAMETERS) &&
+        (std::strcmp(argv[MIN_NUM_INPUT_PARAMETERS], OPTION_REALTIME) == 0);
+    std::vector<CeCaptureRing::CaptureRecord> records;
+    if (!LoadCapture(argv[1], records)) {
+        return 1;
+    }
+    if (records.empty()) {
+        std::cerr << "no ce capture in " << argv[1] << "\n";
+        return 1;
+    }
+    CeReplayStub stub;
+    Replay(stub, records, isRealtime);
+    return 0;
+}
@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Replays the "NCI event trace" section of the nfc service dump on the Linux host, in the recorded order and
+// optionally at the recorded pace. The connection events are fed through INciTagInterface::ITagListener into a stub
+// checking the order of the taps, and the latencies recorded on the device are reported, so a slow tap is examined
+// off the field. The trace keeps a few bytes of each event only, not the activation parameters the tag adapters
+// parse, so the events are replayed at the listener and not through the libnfc callbacks.
+// usage: nci_trace_replay <trace file> [--realtime]
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "inci_tag_interface.h"
+#include "nci_event_trace.h"
+#include "nfa_api.h"
+
+using OHOS::NFC::NCI::INciTagInterface;
+using OHOS::NFC::NCI::NciEventTrace;
+
+namespace {
+constexpr int MIN_NUM_INPUT_PARAMETERS = 2;
+constexpr char OPTION_REALTIME[] = "--realtime";
+constexpr double US_PER_MS = 1000.0;
+// the payload of the discovery and the activation, see TraceConnectionEvent.
+constexpr size_t PAYLOAD_RF_DISC_ID = 0;
+constexpr size_t PAYLOAD_DISC_MORE = 3;
+// the payload of the deactivation.
+constexpr size_t PAYLOAD_DEACT_TYPE = 0;
+
+struct TapStats {
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+    uint64_t minUs = UINT64_MAX;
+
+    void Add(uint64_t costUs)
+    {
+        count++;
+        totalUs += costUs;
+        maxUs = std::max(maxUs, costUs);
+        minUs = std::min(minUs, costUs);
+    }
+};
+
+// the tap being replayed, 0 before its event is seen.
+struct TapState {
+    uint64_t discoveryUs = 0;
+    uint64_t activatedUs = 0;
+    uint64_t ndefDetectUs = 0;
+};
+
+// stands in for TagDispatcher, the replay needs no nfc service, controller or tag app.
+class TagReplayStub : public INciTagInterface::ITagListener {
+public:
+    void OnTagDiscovered(uint32_t tagDiscId) override
+    {
+        if (isTagPresent_) {
+            Report("tag " + std::to_string(tagDiscId) + " discovered before tag " + std::to_string(tagDiscId_) +
+                " was lost");
+        }
+        isTagPresent_ = true;
+        tagDiscId_ = tagDiscId;
+        tapCount_++;
+    }
+    void OnTagLost(uint32_t tagDiscId) override
+    {
+        if (!isTagPresent_ || tagDiscId != tagDiscId_) {
+            Report("tag " + std::to_string(tagDiscId) + " lost without being discovered");
+        }
+        isTagPresent_ = false;
+    }
+
+    // the events the tag adapters take while a tag is activated.
+    void OnTagEvent(const char* name, bool isActivated)
+    {
+        if (!isActivated) {
+            Report(std::string(name) + " out of an activation");
+        }
+    }
+    void OnMultiTag()
+    {
+        multiTagCount_++;
+    }
+
+    void PrintSummary() const
+    {
+        std::cout << "replayed: " << tapCount_ << " taps, " << multiTagCount_ << " with several tags, "
+            << anomalyCount_ << " out of order events\n";
+    }
+
+private:
+    void Report(const std::string& anomaly)
+    {
+        anomalyCount_++;
+        std::cout << "  ! " << anomaly << "\n";
+    }
+
+    bool isTagPresent_ = false;
+    uint32_t tagDiscId_ = 0;
+    uint64_t tapCount_ = 0;
+    uint64_t multiTagCount_ = 0;
+    uint64_t anomalyCount_ = 0;
+};
+
+// the state NfccNciAdapter keeps between the connection events of a tap.
+struct AdapterState {
+    bool isActivated = false;
+    bool isSleeping = false;
+    bool isMultiTag = false;
+    uint32_t rfDiscId = 0;
+};
+
+const char* GetEventName(const NciEventTrace::EventRecord& record)
+{
+    if (record.source == NciEventTrace::SOURCE_CONN) {
+        switch (record.event) {
+            case NFA_RF_DISCOVERY_STARTED_EVT:
+                return "RF_DISCOVERY_STARTED";
+            case NFA_RF_DISCOVERY_STOPPED_EVT:
+                return "RF_DISCOVERY_STOPPED";
+            case NFA_DISC_RESULT_EVT:
+                return "DISC_RESULT";
+            case NFA_ACTIVATED_EVT:
+                return "ACTIVATED";
+            case NFA_DEACTIVATED_EVT:
+                return "DEACTIVATED";
+            case NFA_DATA_EVT:
+                return "DATA";
+            case NFA_NDEF_DETECT_EVT:
+                return "NDEF_DETECT";
+            case NFA_PRESENCE_CHECK_EVT:
+                return "PRESENCE_CHECK";
+            default:
+                return "";
+        }
+    }
+    if (record.source == NciEventTrace::SOURCE_CE) {
+        switch (record.event) {
+            case NFA_CE_ACTIVATED_EVT:
+                return "CE_ACTIVATED";
+            case NFA_CE_DEACTIVATED_EVT:
+                return "CE_DEACTIVATED";
+            case NFA_CE_DATA_EVT:
+                return "CE_DATA";
+            default:
+                return "";
+        }
+    }
+    return "";
+}
+
+bool LoadTrace(const std::string& path, std::vector<NciEventTrace::EventRecord>& records)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "failed to open " << path << "\n";
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        // the other sections of the dump and the headers are skipped.
+        NciEventTrace::EventRecord record;
+        if (NciEventTrace::ParseRecord(line, record)) {
+            records.push_back(record);
+        }
+    }
+    std::stable_sort(records.begin(), records.end(),
+        [](const NciEventTrace::EventRecord& a, const NciEventTrace::EventRecord& b) { return a.timeUs < b.timeUs; });
+    return true;
+}
+
+void OnConnectionEvent(const NciEventTrace::EventRecord& record, TapState& tap, TapStats& activation,
+    TapStats& ndefDetect, TapStats& hold)
+{
+    switch (record.event) {
+        case NFA_DISC_RESULT_EVT:
+            if (tap.discoveryUs == 0) {
+                tap.discoveryUs = record.timeUs;
+            }
+            break;
+        case NFA_ACTIVATED_EVT:
+            tap.activatedUs = record.timeUs;
+            if (tap.discoveryUs != 0) {
+                activation.Add(record.timeUs - tap.discoveryUs);
+            }
+            break;
+        case NFA_NDEF_DETECT_EVT:
+            if (tap.activatedUs != 0 && tap.ndefDetectUs == 0) {
+                tap.ndefDetectUs = record.timeUs;
+                ndefDetect.Add(record.timeUs - tap.activatedUs);
+            }
+            break;
+        case NFA_DEACTIVATED_EVT:
+            if (tap.activatedUs != 0) {
+                hold.Add(record.timeUs - tap.activatedUs);
+            }
+            tap = TapState();
+            break;
+        default:
+            break;
+    }
+}
+
+// follows NfccNciAdapter::NfcConnectionCallback, a tag put to sleep to select the next one of a multi tag is kept.
+void ReplayEvent(TagReplayStub& stub, const NciEventTrace::EventRecord& record, AdapterState& adapter)
+{
+    switch (record.event) {
+        case NFA_DISC_RESULT_EVT:
+            if (record.payloadLen > PAYLOAD_DISC_MORE && record.payload[PAYLOAD_DISC_MORE] == NCI_DISCOVER_NTF_MORE &&
+                !adapter.isMultiTag) {
+                adapter.isMultiTag = true;
+                stub.OnMultiTag();
+            }
+            break;
+        case NFA_ACTIVATED_EVT:
+            if (adapter.isActivated) {
+                stub.OnTagEvent("ACTIVATED", false);
+            }
+            adapter.isActivated = true;
+            if (!adapter.isSleeping) {
+                adapter.rfDiscId = record.payload[PAYLOAD_RF_DISC_ID];
+                stub.OnTagDiscovered(adapter.rfDiscId);
+            }
+            adapter.isSleeping = false;
+            break;
+        case NFA_DEACTIVATED_EVT:
+            adapter.isActivated = false;
+            if (record.payloadLen > PAYLOAD_DEACT_TYPE &&
+                record.payload[PAYLOAD_DEACT_TYPE] == NFA_DEACTIVATE_TYPE_SLEEP) {
+                adapter.isSleeping = true;
+                break;
+            }
+            stub.OnTagLost(adapter.rfDiscId);
+            adapter = AdapterState();
+            break;
+        case NFA_DATA_EVT:
+            stub.OnTagEvent("DATA", adapter.isActivated);
+            break;
+        case NFA_NDEF_DETECT_EVT:
+            stub.OnTagEvent("NDEF_DETECT", adapter.isActivated);
+            break;
+        default:
+            break;
+    }
+}
+
+void PrintStats(const char* name, const TapStats& stats)
+{
+    if (stats.count == 0) {
+        std::cout << "  " << name << ": none\n";
+        return;
+    }
+    std::cout << "  " << name << ": count " << stats.count << ", min " << (stats.minUs / US_PER_MS) << " ms, avg "
+        << (stats.totalUs / stats.count / US_PER_MS) << " ms, max " << (stats.maxUs / US_PER_MS) << " ms\n";
+}
+
+void Replay(TagReplayStub& stub, const std::vector<NciEventTrace::EventRecord>& records, bool isRealtime)
+{
+    TapState tap;
+    TapStats activation;
+    TapStats ndefDetect;
+    TapStats hold;
+    AdapterState adapter;
+    uint64_t maxGapUs = 0;
+    uint64_t startUs = records.front().timeUs;
+    uint64_t lastUs = startUs;
+    for (const NciEventTrace::EventRecord& record : records) {
+        uint64_t gapUs = record.timeUs - lastUs;
+        if (isRealtime && gapUs > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(gapUs));
+        }
+        maxGapUs = std::max(maxGapUs, gapUs);
+        lastUs = record.timeUs;
+        std::cout << "+" << ((record.timeUs - startUs) / US_PER_MS) << " ms (+" << (gapUs / US_PER_MS) << ") "
+            << NciEventTrace::FormatRecord(record) << " " << GetEventName(record) << "\n";
+        if (record.source == NciEventTrace::SOURCE_CONN) {
+            OnConnectionEvent(record, tap, activation, ndefDetect, hold);
+            ReplayEvent(stub, record, adapter);
+        }
+    }
+    std::cout << "summary: " << records.size() << " events over " << ((lastUs - startUs) / US_PER_MS)
+        << " ms, max gap " << (maxGapUs / US_PER_MS) << " ms\n";
+    std::cout << "recorded:\n";
+    PrintStats("discovery to activation", activation);
+    PrintStats("activation to ndef detect", ndefDetect);
+    PrintStats("activation to deactivation", hold);
+    stub.PrintSummary();
+}
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < MIN_NUM_INPUT_PARAMETERS) {
+        std::cerr << "usage: nci_trace_replay <trace file> [" << OPTION_REALTIME << "]\n";
+        return 1;
+    }
+    bool isRealtime = (argc > MIN_NUM_INPUT_PARAMETERS) &&
+        (std::strcmp(argv[MIN_NUM_INPUT_PARAMETERS], OPTION_REALTIME) == 0);
+    std::vector<NciEventTrace::EventRecord> records;
+    if (!LoadTrace(argv[1], records)) {
+        return 1;
+    }
+    if (records.empty()) {
+        std::cerr << "no nci event trace in " << argv[1] << "\n";
+        return 1;
+    }
+    TagReplayStub stub;
+    Replay(stub, records, isRealtime);
+    return 0;
+}